@@ -0,0 +1,206 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "micro_batcher.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ovms {
+namespace client {
+
+namespace {
+bool isCompatible(const std::vector<BatchInput>& a, const std::vector<BatchInput>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].name != b[i].name || a[i].datatype != b[i].datatype || a[i].shape.size() != b[i].shape.size()) {
+            return false;
+        }
+        for (size_t dim = 1; dim < a[i].shape.size(); dim++) {
+            if (a[i].shape[dim] != b[i].shape[dim]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+grpc::Status validateBatchedOutputs(const ::inference::ModelInferResponse& response, int64_t samples) {
+    if (response.raw_output_contents_size() != response.outputs_size()) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "Batched response has to use raw_output_contents");
+    }
+    for (int i = 0; i < response.outputs_size(); i++) {
+        const auto& output = response.outputs(i);
+        if (output.shape_size() == 0 || output.shape(0) != samples || response.raw_output_contents(i).size() % samples != 0) {
+            return grpc::Status(grpc::StatusCode::INTERNAL, "Output " + output.name() + " can not be split along batch dimension");
+        }
+    }
+    return grpc::Status::OK;
+}
+}  // namespace
+
+MicroBatcher::MicroBatcher(Client& client, const std::string& modelName, const std::string& modelVersion, size_t maxBatchSize, std::chrono::microseconds maxDelay) :
+    client(client),
+    modelName(modelName),
+    modelVersion(modelVersion),
+    maxBatchSize(std::max<int64_t>(static_cast<int64_t>(maxBatchSize), 1)),
+    maxDelay(maxDelay),
+    flushThread(&MicroBatcher::flushLoop, this) {}
+
+MicroBatcher::~MicroBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_one();
+    flushThread.join();
+}
+
+std::future<InferResult> MicroBatcher::infer(std::vector<BatchInput> inputs) {
+    PendingRequest request;
+    auto future = request.promise.get_future();
+    request.samples = (inputs.empty() || inputs[0].shape.empty()) ? 0 : inputs[0].shape[0];
+    for (const auto& input : inputs) {
+        if (input.shape.empty() || input.shape[0] != request.samples) {
+            request.samples = 0;
+        }
+    }
+    if (request.samples <= 0) {
+        InferResult result;
+        result.status = grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "All inputs need the same positive batch dimension");
+        request.promise.set_value(std::move(result));
+        return future;
+    }
+    request.inputs = std::move(inputs);
+    request.enqueued = std::chrono::steady_clock::now();
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queuedSamples += request.samples;
+        notify = queue.empty() || queuedSamples >= maxBatchSize;
+        queue.push_back(std::move(request));
+    }
+    if (notify) {
+        condition.notify_one();
+    }
+    return future;
+}
+
+void MicroBatcher::flushLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        condition.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (queue.empty()) {
+            return;
+        }
+        const auto deadline = queue.front().enqueued + maxDelay;
+        condition.wait_until(lock, deadline, [this] { return stopping || queuedSamples >= maxBatchSize; });
+        auto batch = takeBatch();
+        lock.unlock();
+        send(std::move(batch));
+        lock.lock();
+    }
+}
+
+std::vector<MicroBatcher::PendingRequest> MicroBatcher::takeBatch() {
+    std::vector<PendingRequest> batch;
+    int64_t samples = 0;
+    for (auto it = queue.begin(); it != queue.end();) {
+        if (!batch.empty() && (samples + it->samples > maxBatchSize || !isCompatible(batch.front().inputs, it->inputs))) {
+            ++it;
+            continue;
+        }
+        samples += it->samples;
+        queuedSamples -= it->samples;
+        batch.push_back(std::move(*it));
+        it = queue.erase(it);
+        if (samples >= maxBatchSize) {
+            break;
+        }
+    }
+    return batch;
+}
+
+void MicroBatcher::send(std::vector<PendingRequest> batch) {
+    InferRequest request(modelName, modelVersion);
+    if (batch.size() == 1) {
+        // Nothing to merge, caller buffers are sent as they are
+        for (const auto& input : batch.front().inputs) {
+            request.addInput(input.name, input.datatype, input.shape, input.data, input.size);
+        }
+        auto pending = std::make_shared<PendingRequest>(std::move(batch.front()));
+        client.inferAsync(request, [pending](InferResult& result) {
+            pending->promise.set_value(std::move(result));
+        });
+        return;
+    }
+
+    const auto& first = batch.front().inputs;
+    int64_t samples = 0;
+    for (const auto& pending : batch) {
+        samples += pending.samples;
+    }
+    auto storage = std::make_shared<std::vector<std::string>>(first.size());
+    for (size_t i = 0; i < first.size(); i++) {
+        std::string& buffer = (*storage)[i];
+        size_t size = 0;
+        for (const auto& pending : batch) {
+            size += pending.inputs[i].size;
+        }
+        buffer.reserve(size);
+        for (const auto& pending : batch) {
+            buffer.append(static_cast<const char*>(pending.inputs[i].data), pending.inputs[i].size);
+        }
+        std::vector<int64_t> shape = first[i].shape;
+        shape[0] = samples;
+        request.addInput(first[i].name, first[i].datatype, shape, buffer.data(), buffer.size());
+    }
+
+    auto requests = std::make_shared<std::vector<PendingRequest>>(std::move(batch));
+    client.inferAsync(request, [storage, requests, samples](InferResult& result) {
+        if (result.ok()) {
+            result.status = validateBatchedOutputs(result.response, samples);
+        }
+        if (!result.ok()) {
+            for (auto& pending : *requests) {
+                InferResult failed;
+                failed.status = result.status;
+                pending.promise.set_value(std::move(failed));
+            }
+            return;
+        }
+        int64_t offset = 0;
+        for (auto& pending : *requests) {
+            InferResult part;
+            part.response.set_model_name(result.response.model_name());
+            part.response.set_model_version(result.response.model_version());
+            for (int i = 0; i < result.response.outputs_size(); i++) {
+                auto* output = part.response.add_outputs();
+                *output = result.response.outputs(i);
+                output->set_shape(0, pending.samples);
+                const std::string& data = result.response.raw_output_contents(i);
+                const size_t sampleBytes = data.size() / samples;
+                part.response.add_raw_output_contents(data.substr(offset * sampleBytes, pending.samples * sampleBytes));
+            }
+            offset += pending.samples;
+            pending.promise.set_value(std::move(part));
+        }
+    });
+}
+
+}  // namespace client
+}  // namespace ovms
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ovms_client.hpp"
+
+namespace ovms {
+namespace client {
+
+struct BatchInput {
+    std::string name;
+    std::string datatype;
+    // First dimension is the batch dimension
+    std::vector<int64_t> shape;
+    const void* data;
+    size_t size;
+};
+
+/**
+ * @brief Groups small requests to the same model into one request along the first dimension.
+ * Batch is sent when it reaches maxBatchSize samples or when the oldest request waited maxDelay.
+ * Outputs are split back along the first dimension, so the model has to return batch dimension first
+ * and raw_output_contents. Only requests with matching input names, datatypes and remaining dimensions
+ * are batched together. Input buffers must stay valid until the result of the request is ready.
+ */
+class MicroBatcher {
+    struct PendingRequest {
+        std::vector<BatchInput> inputs;
+        int64_t samples;
+        std::chrono::steady_clock::time_point enqueued;
+        std::promise<InferResult> promise;
+    };
+
+    Client& client;
+    const std::string modelName;
+    const std::string modelVersion;
+    const int64_t maxBatchSize;
+    const std::chrono::microseconds maxDelay;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<PendingRequest> queue;
+    int64_t queuedSamples = 0;
+    bool stopping = false;
+    std::thread flushThread;
+
+    void flushLoop();
+    std::vector<PendingRequest> takeBatch();
+    void send(std::vector<PendingRequest> batch);
+
+public:
+    MicroBatcher(Client& client, const std::string& modelName, const std::string& modelVersion, size_t maxBatchSize, std::chrono::microseconds maxDelay);
+    /**
+     * @brief Sends remaining requests and waits until they are issued
+     */
+    ~MicroBatcher();
+    MicroBatcher(const MicroBatcher&) = delete;
+    MicroBatcher& operator=(const MicroBatcher&) = delete;
+
+    std::future<InferResult> infer(std::vector<BatchInput> inputs);
+};
+
+}  // namespace client
+}  // namespace ovms
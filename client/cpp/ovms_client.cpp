@@ -0,0 +1,232 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "ovms_client.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "grpcpp/client_context.h"
+#include "grpcpp/create_channel.h"
+#include "grpcpp/impl/codegen/proto_utils.h"
+#include "grpcpp/support/channel_arguments.h"
+#include "grpcpp/support/slice.h"
+
+namespace ovms {
+namespace client {
+
+namespace {
+const char MODEL_INFER_METHOD[] = "/inference.GRPCInferenceService/ModelInfer";
+const char PREDICT_METHOD[] = "/tensorflow.serving.PredictionService/Predict";
+const char CHANNEL_ID_ARG[] = "ovms.client.channel_id";
+
+// Field number 7 (raw_input_contents) with length delimited wire type
+const char RAW_INPUT_CONTENTS_TAG = (7 << 3) | 2;
+
+void appendVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+struct AsyncCall {
+    grpc::ClientContext context;
+    grpc::ByteBuffer response;
+    grpc::Status status;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<grpc::ByteBuffer>> reader;
+    std::function<void(grpc::Status&, grpc::ByteBuffer&)> onDone;
+};
+
+template <typename ResponseType>
+grpc::Status deserialize(grpc::Status& status, grpc::ByteBuffer& buffer, ResponseType& response) {
+    if (!status.ok()) {
+        return status;
+    }
+    return grpc::SerializationTraits<ResponseType>::Deserialize(&buffer, &response);
+}
+}  // namespace
+
+ChannelPool::ChannelPool(const std::string& address, const ClientOptions& options) {
+    const size_t count = std::max<size_t>(options.channels, 1);
+    for (size_t i = 0; i < count; i++) {
+        grpc::ChannelArguments args;
+        args.SetMaxReceiveMessageSize(options.maxMessageSize);
+        args.SetMaxSendMessageSize(options.maxMessageSize);
+        // Channels with equal arguments would share subchannels and therefore a single connection
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        args.SetInt(CHANNEL_ID_ARG, static_cast<int>(i));
+        auto channel = grpc::CreateCustomChannel(address, options.credentials, args);
+        stubs.push_back(std::make_unique<grpc::GenericStub>(channel));
+        channels.push_back(std::move(channel));
+    }
+}
+
+grpc::GenericStub& ChannelPool::getStub() {
+    return *stubs[next.fetch_add(1, std::memory_order_relaxed) % stubs.size()];
+}
+
+InferRequest::InferRequest(const std::string& modelName, const std::string& modelVersion) {
+    header.set_model_name(modelName);
+    header.set_model_version(modelVersion);
+}
+
+InferRequest& InferRequest::addInput(const std::string& name, const std::string& datatype, const std::vector<int64_t>& shape, const void* data, size_t size) {
+    auto* input = header.add_inputs();
+    input->set_name(name);
+    input->set_datatype(datatype);
+    for (const auto dim : shape) {
+        input->add_shape(dim);
+    }
+    buffers.emplace_back(data, size);
+    return *this;
+}
+
+InferRequest& InferRequest::addOutput(const std::string& name) {
+    header.add_outputs()->set_name(name);
+    return *this;
+}
+
+InferRequest& InferRequest::setId(const std::string& id) {
+    header.set_id(id);
+    return *this;
+}
+
+grpc::ByteBuffer InferRequest::serialize() const {
+    // Repeated fields appended to serialized message are parsed as if they were part of it,
+    // so raw_input_contents can follow the header as separate slices pointing to caller buffers.
+    std::vector<grpc::Slice> slices;
+    slices.reserve(1 + 2 * buffers.size());
+    slices.emplace_back(header.SerializeAsString());
+    for (const auto& buffer : buffers) {
+        std::string prefix(1, RAW_INPUT_CONTENTS_TAG);
+        appendVarint(prefix, buffer.second);
+        slices.emplace_back(prefix);
+        if (buffer.second > 0) {
+            slices.emplace_back(buffer.first, buffer.second, grpc::Slice::STATIC_SLICE);
+        }
+    }
+    return grpc::ByteBuffer(slices.data(), slices.size());
+}
+
+const ::inference::ModelInferResponse::InferOutputTensor* InferResult::getOutput(const std::string& name) const {
+    for (const auto& output : response.outputs()) {
+        if (output.name() == name) {
+            return &output;
+        }
+    }
+    return nullptr;
+}
+
+const std::string* InferResult::getOutputData(const std::string& name) const {
+    for (int i = 0; i < response.outputs_size(); i++) {
+        if (response.outputs(i).name() == name) {
+            return i < response.raw_output_contents_size() ? &response.raw_output_contents(i) : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+Client::Client(const std::string& address, ClientOptions options) :
+    options(options),
+    pool(address, options) {
+    const size_t threads = std::max<size_t>(options.completionThreads, 1);
+    for (size_t i = 0; i < threads; i++) {
+        completionThreads.emplace_back(&Client::pollCompletionQueue, this);
+    }
+}
+
+Client::~Client() {
+    // Calls in flight are completed before the queue is drained
+    completionQueue.Shutdown();
+    for (auto& thread : completionThreads) {
+        thread.join();
+    }
+}
+
+void Client::pollCompletionQueue() {
+    void* tag = nullptr;
+    bool ok = false;
+    while (completionQueue.Next(&tag, &ok)) {
+        std::unique_ptr<AsyncCall> call(static_cast<AsyncCall*>(tag));
+        call->onDone(call->status, call->response);
+    }
+}
+
+void Client::startCall(const std::string& method, const grpc::ByteBuffer& request, std::function<void(grpc::Status&, grpc::ByteBuffer&)> onDone) {
+    auto* call = new AsyncCall;
+    call->onDone = std::move(onDone);
+    if (options.timeout.count() > 0) {
+        call->context.set_deadline(std::chrono::system_clock::now() + options.timeout);
+    }
+    call->reader = pool.getStub().PrepareUnaryCall(&call->context, method, request, &completionQueue);
+    call->reader->StartCall();
+    call->reader->Finish(&call->response, &call->status, call);
+}
+
+void Client::inferAsync(const InferRequest& request, InferCallback callback) {
+    startCall(MODEL_INFER_METHOD, request.serialize(), [callback = std::move(callback)](grpc::Status& status, grpc::ByteBuffer& buffer) {
+        InferResult result;
+        result.status = deserialize(status, buffer, result.response);
+        callback(result);
+    });
+}
+
+std::future<InferResult> Client::inferAsync(const InferRequest& request) {
+    auto promise = std::make_shared<std::promise<InferResult>>();
+    auto future = promise->get_future();
+    inferAsync(request, [promise](InferResult& result) {
+        promise->set_value(std::move(result));
+    });
+    return future;
+}
+
+InferResult Client::infer(const InferRequest& request) {
+    return inferAsync(request).get();
+}
+
+void Client::predictAsync(const tensorflow::serving::PredictRequest& request, PredictCallback callback) {
+    grpc::ByteBuffer buffer;
+    bool ownBuffer = false;
+    grpc::Status status = grpc::SerializationTraits<tensorflow::serving::PredictRequest>::Serialize(request, &buffer, &ownBuffer);
+    if (!status.ok()) {
+        PredictResult result;
+        result.status = status;
+        callback(result);
+        return;
+    }
+    startCall(PREDICT_METHOD, buffer, [callback = std::move(callback)](grpc::Status& status, grpc::ByteBuffer& buffer) {
+        PredictResult result;
+        result.status = deserialize(status, buffer, result.response);
+        callback(result);
+    });
+}
+
+std::future<PredictResult> Client::predictAsync(const tensorflow::serving::PredictRequest& request) {
+    auto promise = std::make_shared<std::promise<PredictResult>>();
+    auto future = promise->get_future();
+    predictAsync(request, [promise](PredictResult& result) {
+        promise->set_value(std::move(result));
+    });
+    return future;
+}
+
+PredictResult Client::predict(const tensorflow::serving::PredictRequest& request) {
+    return predictAsync(request).get();
+}
+
+}  // namespace client
+}  // namespace ovms
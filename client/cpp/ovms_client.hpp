@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "grpcpp/channel.h"
+#include "grpcpp/completion_queue.h"
+#include "grpcpp/generic/generic_stub.h"
+#include "grpcpp/security/credentials.h"
+#include "grpcpp/support/byte_buffer.h"
+#include "grpcpp/support/status.h"
+#include "src/kfserving_api/grpc_predict_v2.pb.h"
+#include "tensorflow_serving/apis/predict.pb.h"
+
+namespace ovms {
+namespace client {
+
+struct ClientOptions {
+    // Number of gRPC channels, each with its own TCP connection. Requests are spread round robin.
+    size_t channels = 1;
+    // Number of threads polling completion queue and running callbacks
+    size_t completionThreads = 1;
+    // Deadline of each call; zero means no deadline
+    std::chrono::milliseconds timeout{0};
+    int maxMessageSize = std::numeric_limits<int32_t>::max();
+    std::shared_ptr<grpc::ChannelCredentials> credentials = grpc::InsecureChannelCredentials();
+};
+
+/**
+ * @brief Set of channels to the same server. Channels are created with distinct arguments and local
+ * subchannel pools, so each of them opens a separate connection instead of sharing one HTTP/2 connection.
+ */
+class ChannelPool {
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    std::vector<std::unique_ptr<grpc::GenericStub>> stubs;
+    std::atomic<size_t> next{0};
+
+public:
+    ChannelPool(const std::string& address, const ClientOptions& options);
+
+    grpc::GenericStub& getStub();
+    const std::vector<std::shared_ptr<grpc::Channel>>& getChannels() const { return channels; }
+    size_t size() const { return channels.size(); }
+};
+
+/**
+ * @brief KServe inference request which does not copy input data. Tensor metadata is kept in the
+ * ModelInferRequest header, while raw_input_contents are referenced from caller buffers when the
+ * request is serialized. Buffers must stay valid and unmodified until the call completes.
+ */
+class InferRequest {
+    ::inference::ModelInferRequest header;
+    std::vector<std::pair<const void*, size_t>> buffers;
+
+public:
+    InferRequest(const std::string& modelName, const std::string& modelVersion = "");
+
+    /**
+     * @brief Adds input with raw data in row-major order
+     *
+     * @param datatype KServe datatype, e.g. FP32
+     * @param data buffer referenced until the call completes
+     */
+    InferRequest& addInput(const std::string& name, const std::string& datatype, const std::vector<int64_t>& shape, const void* data, size_t size);
+    InferRequest& addOutput(const std::string& name);
+    InferRequest& setId(const std::string& id);
+
+    const ::inference::ModelInferRequest& getHeader() const { return header; }
+    const std::vector<std::pair<const void*, size_t>>& getBuffers() const { return buffers; }
+
+    /**
+     * @brief Produces wire format of ModelInferRequest with input buffers attached as static slices
+     */
+    grpc::ByteBuffer serialize() const;
+};
+
+struct InferResult {
+    grpc::Status status;
+    ::inference::ModelInferResponse response;
+
+    bool ok() const { return status.ok(); }
+    const ::inference::ModelInferResponse::InferOutputTensor* getOutput(const std::string& name) const;
+    /**
+     * @brief Returns raw data of the output or nullptr when the output is missing
+     */
+    const std::string* getOutputData(const std::string& name) const;
+};
+
+struct PredictResult {
+    grpc::Status status;
+    tensorflow::serving::PredictResponse response;
+
+    bool ok() const { return status.ok(); }
+};
+
+using InferCallback = std::function<void(InferResult&)>;
+using PredictCallback = std::function<void(PredictResult&)>;
+
+/**
+ * @brief Asynchronous client of KServe and TensorFlow Serving gRPC APIs. Calls are issued on the pooled
+ * channels and completed by threads polling a shared completion queue. Callbacks are run on those threads,
+ * so they should not block.
+ */
+class Client {
+    ClientOptions options;
+    ChannelPool pool;
+    grpc::CompletionQueue completionQueue;
+    std::vector<std::thread> completionThreads;
+
+    void startCall(const std::string& method, const grpc::ByteBuffer& request, std::function<void(grpc::Status&, grpc::ByteBuffer&)> onDone);
+    void pollCompletionQueue();
+
+public:
+    Client(const std::string& address, ClientOptions options = ClientOptions());
+    ~Client();
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+
+    void inferAsync(const InferRequest& request, InferCallback callback);
+    std::future<InferResult> inferAsync(const InferRequest& request);
+    InferResult infer(const InferRequest& request);
+
+    void predictAsync(const tensorflow::serving::PredictRequest& request, PredictCallback callback);
+    std::future<PredictResult> predictAsync(const tensorflow::serving::PredictRequest& request);
+    PredictResult predict(const tensorflow::serving::PredictRequest& request);
+
+    ChannelPool& getChannelPool() { return pool; }
+};
+
+}  // namespace client
+}  // namespace ovms
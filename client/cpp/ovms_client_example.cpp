@@ -0,0 +1,133 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "micro_batcher.hpp"
+#include "ovms_client.hpp"
+#include "tensorflow/core/util/command_line_flags.h"
+
+using ovms::client::BatchInput;
+using ovms::client::Client;
+using ovms::client::ClientOptions;
+using ovms::client::InferRequest;
+using ovms::client::InferResult;
+using ovms::client::MicroBatcher;
+
+namespace {
+bool parseShape(const std::string& text, std::vector<int64_t>& shape) {
+    std::stringstream ss(text);
+    std::string dim;
+    while (std::getline(ss, dim, ',')) {
+        try {
+            shape.push_back(std::stoll(dim));
+        } catch (const std::exception&) {
+            return false;
+        }
+        if (shape.back() <= 0) {
+            return false;
+        }
+    }
+    return !shape.empty();
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    tensorflow::string address = "localhost";
+    tensorflow::string port = "9000";
+    tensorflow::string modelName = "resnet";
+    tensorflow::string inputName = "0";
+    tensorflow::string shapeText = "1,3,224,224";
+    tensorflow::int32 iterations = 1000;
+    tensorflow::int32 channels = 2;
+    tensorflow::int32 completionThreads = 2;
+    tensorflow::int32 maxBatchSize = 1;
+    tensorflow::int32 maxDelayUs = 1000;
+    std::vector<tensorflow::Flag> flagList = {
+        tensorflow::Flag("grpc_address", &address, "url to grpc service"),
+        tensorflow::Flag("grpc_port", &port, "port to grpc service"),
+        tensorflow::Flag("model_name", &modelName, "model name to request"),
+        tensorflow::Flag("input_name", &inputName, "name of FP32 model input filled with synthetic data"),
+        tensorflow::Flag("shape", &shapeText, "shape of single request input, comma separated"),
+        tensorflow::Flag("iterations", &iterations, "number of requests to send"),
+        tensorflow::Flag("channels", &channels, "number of gRPC channels in the pool"),
+        tensorflow::Flag("completion_threads", &completionThreads, "number of threads receiving responses"),
+        tensorflow::Flag("max_batch_size", &maxBatchSize, "maximum number of samples grouped on the client side; 1=no batching"),
+        tensorflow::Flag("max_delay_us", &maxDelayUs, "maximum time the first request waits for a batch to fill")};
+
+    tensorflow::string usage = tensorflow::Flags::Usage(argv[0], flagList);
+    std::vector<int64_t> shape;
+    const bool result = tensorflow::Flags::Parse(&argc, argv, flagList);
+    if (!result || !parseShape(shapeText, shape) || iterations <= 0) {
+        std::cout << usage;
+        return -1;
+    }
+
+    size_t elements = 1;
+    for (const auto dim : shape) {
+        elements *= dim;
+    }
+    // Input buffer is shared by all requests, as it is only referenced by them
+    std::vector<float> data(elements, 1.0f);
+
+    ClientOptions options;
+    options.channels = channels;
+    options.completionThreads = completionThreads;
+    Client client(address + ":" + port, options);
+    std::unique_ptr<MicroBatcher> batcher;
+    if (maxBatchSize > 1) {
+        batcher = std::make_unique<MicroBatcher>(client, modelName, "", maxBatchSize, std::chrono::microseconds(maxDelayUs));
+    }
+
+    std::cout << "Address: " << address << ":" << port << std::endl
+              << "Model name: " << modelName << std::endl;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::future<InferResult>> results;
+    results.reserve(iterations);
+    for (tensorflow::int32 i = 0; i < iterations; i++) {
+        if (batcher) {
+            results.push_back(batcher->infer({BatchInput{inputName, "FP32", shape, data.data(), data.size() * sizeof(float)}}));
+        } else {
+            InferRequest request(modelName);
+            request.addInput(inputName, "FP32", shape, data.data(), data.size() * sizeof(float));
+            results.push_back(client.inferAsync(request));
+        }
+    }
+    size_t failed = 0;
+    for (auto& future : results) {
+        InferResult inferResult = future.get();
+        if (!inferResult.ok()) {
+            if (failed == 0) {
+                std::cout << "Request failed: " << inferResult.status.error_message() << std::endl;
+            }
+            failed++;
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    std::cout << "Total time: " << duration << "ms" << std::endl
+              << "Total iterations: " << iterations << std::endl
+              << "Failed iterations: " << failed << std::endl
+              << "Avg FPS: " << (duration > 0 ? iterations * 1000.0 / duration : 0) << std::endl;
+    return failed == 0 ? 0 : -1;
+}
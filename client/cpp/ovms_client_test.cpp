@@ -0,0 +1,340 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "grpcpp/generic/async_generic_service.h"
+#include "grpcpp/impl/codegen/proto_utils.h"
+#include "grpcpp/security/server_credentials.h"
+#include "grpcpp/server.h"
+#include "grpcpp/server_builder.h"
+#include "micro_batcher.hpp"
+#include "ovms_client.hpp"
+
+using namespace ovms::client;
+
+namespace {
+const char MODEL_INFER_METHOD[] = "/inference.GRPCInferenceService/ModelInfer";
+const auto RESULT_TIMEOUT = std::chrono::seconds(10);
+const auto LONG_DELAY = std::chrono::microseconds(10'000'000);
+
+/**
+ * @brief In-process server answering ModelInfer calls with a handler. Received requests are recorded.
+ */
+class FakeInferenceServer {
+public:
+    using Handler = std::function<::inference::ModelInferResponse(const ::inference::ModelInferRequest&)>;
+
+    explicit FakeInferenceServer(Handler handler) :
+        handler(std::move(handler)) {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+        builder.RegisterAsyncGenericService(&service);
+        completionQueue = builder.AddCompletionQueue();
+        server = builder.BuildAndStart();
+        thread = std::thread(&FakeInferenceServer::serve, this);
+    }
+
+    ~FakeInferenceServer() {
+        {
+            // No new calls can be requested after shutdown
+            std::lock_guard<std::mutex> lock(mutex);
+            shuttingDown = true;
+        }
+        server->Shutdown();
+        completionQueue->Shutdown();
+        thread.join();
+    }
+
+    std::string getAddress() const { return "localhost:" + std::to_string(port); }
+
+    std::vector<::inference::ModelInferRequest> getReceivedRequests() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return received;
+    }
+
+private:
+    struct Call {
+        enum class Step { REQUESTED,
+            READ,
+            FINISHED };
+        grpc::GenericServerContext context;
+        grpc::GenericServerAsyncReaderWriter stream{&context};
+        grpc::ByteBuffer buffer;
+        Step step = Step::REQUESTED;
+    };
+
+    void requestCall() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (shuttingDown) {
+            return;
+        }
+        auto* call = new Call;
+        service.RequestCall(&call->context, &call->stream, completionQueue.get(), completionQueue.get(), call);
+    }
+
+    void serve() {
+        requestCall();
+        void* tag = nullptr;
+        bool ok = false;
+        while (completionQueue->Next(&tag, &ok)) {
+            auto* call = static_cast<Call*>(tag);
+            if (!ok || call->step == Call::Step::FINISHED) {
+                delete call;
+                continue;
+            }
+            if (call->step == Call::Step::REQUESTED) {
+                requestCall();
+                call->step = Call::Step::READ;
+                call->stream.Read(&call->buffer, call);
+                continue;
+            }
+            call->step = Call::Step::FINISHED;
+            grpc::ByteBuffer response;
+            grpc::Status status = answer(call->context.method(), call->buffer, response);
+            if (status.ok()) {
+                call->stream.WriteAndFinish(response, grpc::WriteOptions(), status, call);
+            } else {
+                call->stream.Finish(status, call);
+            }
+        }
+    }
+
+    grpc::Status answer(const std::string& method, grpc::ByteBuffer& requestBuffer, grpc::ByteBuffer& responseBuffer) {
+        if (method != MODEL_INFER_METHOD) {
+            return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, method);
+        }
+        ::inference::ModelInferRequest request;
+        grpc::Status status = grpc::SerializationTraits<::inference::ModelInferRequest>::Deserialize(&requestBuffer, &request);
+        if (!status.ok()) {
+            return status;
+        }
+        auto response = handler(request);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            received.push_back(std::move(request));
+        }
+        bool ownBuffer = false;
+        return grpc::SerializationTraits<::inference::ModelInferResponse>::Serialize(response, &responseBuffer, &ownBuffer);
+    }
+
+    Handler handler;
+    int port = 0;
+    grpc::AsyncGenericService service;
+    std::unique_ptr<grpc::ServerCompletionQueue> completionQueue;
+    std::unique_ptr<grpc::Server> server;
+    std::thread thread;
+    std::mutex mutex;
+    bool shuttingDown = false;
+    std::vector<::inference::ModelInferRequest> received;
+};
+
+// Returns each input as output named <input>_out with the same shape and data
+::inference::ModelInferResponse echo(const ::inference::ModelInferRequest& request) {
+    ::inference::ModelInferResponse response;
+    response.set_model_name(request.model_name());
+    response.set_model_version("1");
+    for (int i = 0; i < request.inputs_size(); i++) {
+        auto* output = response.add_outputs();
+        output->set_name(request.inputs(i).name() + "_out");
+        output->set_datatype(request.inputs(i).datatype());
+        *output->mutable_shape() = request.inputs(i).shape();
+        response.add_raw_output_contents(i < request.raw_input_contents_size() ? request.raw_input_contents(i) : "");
+    }
+    return response;
+}
+
+std::string toWireFormat(const grpc::ByteBuffer& buffer) {
+    std::vector<grpc::Slice> slices;
+    EXPECT_TRUE(buffer.Dump(&slices).ok());
+    std::string wire;
+    for (const auto& slice : slices) {
+        wire.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+    }
+    return wire;
+}
+
+std::string asBytes(const std::vector<float>& data) {
+    return std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+}
+
+BatchInput makeInput(const std::vector<float>& data, int64_t samples) {
+    return BatchInput{"in", "FP32", {samples, static_cast<int64_t>(data.size()) / samples}, data.data(), data.size() * sizeof(float)};
+}
+}  // namespace
+
+TEST(InferRequest, SerializedRequestIsParsedByModelInferRequest) {
+    const std::vector<float> small{1.0, 2.0, 3.0, 4.0};
+    // Length of raw contents above 127 bytes needs multi byte varint
+    const std::vector<float> large(300, 7.5);
+    InferRequest request("dummy", "2");
+    request.setId("request-1")
+        .addInput("a", "FP32", {1, 4}, small.data(), small.size() * sizeof(float))
+        .addInput("b", "FP32", {3, 100}, large.data(), large.size() * sizeof(float))
+        .addInput("empty", "FP32", {0, 4}, nullptr, 0)
+        .addOutput("c");
+
+    ::inference::ModelInferRequest parsed;
+    ASSERT_TRUE(parsed.ParseFromString(toWireFormat(request.serialize())));
+
+    EXPECT_EQ(parsed.model_name(), "dummy");
+    EXPECT_EQ(parsed.model_version(), "2");
+    EXPECT_EQ(parsed.id(), "request-1");
+    ASSERT_EQ(parsed.inputs_size(), 3);
+    EXPECT_EQ(parsed.inputs(0).name(), "a");
+    EXPECT_EQ(parsed.inputs(1).name(), "b");
+    EXPECT_EQ(parsed.inputs(2).name(), "empty");
+    EXPECT_EQ(parsed.inputs(1).datatype(), "FP32");
+    ASSERT_EQ(parsed.inputs(1).shape_size(), 2);
+    EXPECT_EQ(parsed.inputs(1).shape(0), 3);
+    EXPECT_EQ(parsed.inputs(1).shape(1), 100);
+    ASSERT_EQ(parsed.outputs_size(), 1);
+    EXPECT_EQ(parsed.outputs(0).name(), "c");
+    ASSERT_EQ(parsed.raw_input_contents_size(), 3);
+    EXPECT_EQ(parsed.raw_input_contents(0), asBytes(small));
+    EXPECT_EQ(parsed.raw_input_contents(1), asBytes(large));
+    EXPECT_TRUE(parsed.raw_input_contents(2).empty());
+}
+
+TEST(InferRequest, SerializedRequestMatchesHeaderWithRawContents) {
+    const std::vector<float> data{1.0, 2.0};
+    InferRequest request("dummy");
+    request.addInput("a", "FP32", {1, 2}, data.data(), data.size() * sizeof(float));
+
+    ::inference::ModelInferRequest expected = request.getHeader();
+    expected.add_raw_input_contents(asBytes(data));
+    ::inference::ModelInferRequest parsed;
+    ASSERT_TRUE(parsed.ParseFromString(toWireFormat(request.serialize())));
+    EXPECT_EQ(parsed.SerializeAsString(), expected.SerializeAsString());
+}
+
+class MicroBatcherTest : public ::testing::Test {
+protected:
+    FakeInferenceServer server{echo};
+    Client client{server.getAddress()};
+};
+
+TEST_F(MicroBatcherTest, RequestsAreConcatenatedAlongBatchDimension) {
+    const std::vector<float> first{1.0, 2.0};
+    const std::vector<float> second{3.0, 4.0};
+    const std::vector<float> third{5.0, 6.0, 7.0, 8.0};
+    std::vector<std::future<InferResult>> results;
+    {
+        MicroBatcher batcher(client, "dummy", "", 4, LONG_DELAY);
+        results.push_back(batcher.infer({makeInput(first, 1)}));
+        results.push_back(batcher.infer({makeInput(second, 1)}));
+        results.push_back(batcher.infer({makeInput(third, 2)}));
+        for (auto& result : results) {
+            ASSERT_EQ(result.wait_for(RESULT_TIMEOUT), std::future_status::ready);
+        }
+    }
+
+    auto received = server.getReceivedRequests();
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_EQ(received[0].model_name(), "dummy");
+    ASSERT_EQ(received[0].inputs_size(), 1);
+    ASSERT_EQ(received[0].inputs(0).shape_size(), 2);
+    EXPECT_EQ(received[0].inputs(0).shape(0), 4);
+    EXPECT_EQ(received[0].inputs(0).shape(1), 2);
+    ASSERT_EQ(received[0].raw_input_contents_size(), 1);
+    EXPECT_EQ(received[0].raw_input_contents(0), asBytes(first) + asBytes(second) + asBytes(third));
+}
+
+TEST_F(MicroBatcherTest, OutputsAreSplitPerCaller) {
+    const std::vector<float> first{1.0, 2.0};
+    const std::vector<float> second{3.0, 4.0, 5.0, 6.0};
+    const std::vector<float> third{7.0, 8.0};
+    MicroBatcher batcher(client, "dummy", "", 4, LONG_DELAY);
+    auto firstResult = batcher.infer({makeInput(first, 1)});
+    auto secondResult = batcher.infer({makeInput(second, 2)});
+    auto thirdResult = batcher.infer({makeInput(third, 1)});
+
+    const std::vector<std::pair<std::future<InferResult>*, const std::vector<float>*>> expected{
+        {&firstResult, &first}, {&secondResult, &second}, {&thirdResult, &third}};
+    for (auto& [future, data] : expected) {
+        ASSERT_EQ(future->wait_for(RESULT_TIMEOUT), std::future_status::ready);
+        InferResult result = future->get();
+        ASSERT_TRUE(result.ok()) << result.status.error_message();
+        const auto* output = result.getOutput("in_out");
+        ASSERT_NE(output, nullptr);
+        ASSERT_EQ(output->shape_size(), 2);
+        EXPECT_EQ(output->shape(0), static_cast<int64_t>(data->size()) / 2);
+        EXPECT_EQ(output->shape(1), 2);
+        const std::string* outputData = result.getOutputData("in_out");
+        ASSERT_NE(outputData, nullptr);
+        EXPECT_EQ(*outputData, asBytes(*data));
+    }
+    EXPECT_EQ(server.getReceivedRequests().size(), 1);
+}
+
+TEST_F(MicroBatcherTest, IncompleteBatchIsFlushedAfterMaxDelay) {
+    const std::vector<float> first{1.0, 2.0};
+    const std::vector<float> second{3.0, 4.0};
+    const auto maxDelay = std::chrono::milliseconds(50);
+    MicroBatcher batcher(client, "dummy", "", 8, maxDelay);
+    const auto start = std::chrono::steady_clock::now();
+    auto firstResult = batcher.infer({makeInput(first, 1)});
+    auto secondResult = batcher.infer({makeInput(second, 1)});
+
+    ASSERT_EQ(firstResult.wait_for(RESULT_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(secondResult.wait_for(RESULT_TIMEOUT), std::future_status::ready);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, maxDelay);
+    EXPECT_TRUE(firstResult.get().ok());
+    EXPECT_TRUE(secondResult.get().ok());
+
+    auto received = server.getReceivedRequests();
+    ASSERT_EQ(received.size(), 1);
+    ASSERT_EQ(received[0].inputs_size(), 1);
+    EXPECT_EQ(received[0].inputs(0).shape(0), 2);
+}
+
+TEST_F(MicroBatcherTest, IncompatibleRequestsAreSentSeparately) {
+    const std::vector<float> first{1.0, 2.0};
+    const std::vector<float> second{3.0, 4.0, 5.0};
+    MicroBatcher batcher(client, "dummy", "", 2, std::chrono::milliseconds(20));
+    auto firstResult = batcher.infer({makeInput(first, 1)});
+    auto secondResult = batcher.infer({makeInput(second, 1)});
+
+    ASSERT_EQ(firstResult.wait_for(RESULT_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(secondResult.wait_for(RESULT_TIMEOUT), std::future_status::ready);
+    InferResult result = secondResult.get();
+    ASSERT_TRUE(result.ok()) << result.status.error_message();
+    ASSERT_NE(result.getOutputData("in_out"), nullptr);
+    EXPECT_EQ(*result.getOutputData("in_out"), asBytes(second));
+    EXPECT_EQ(server.getReceivedRequests().size(), 2);
+}
+
+TEST_F(MicroBatcherTest, RequestWithoutCommonBatchDimensionIsRejected) {
+    const std::vector<float> first{1.0, 2.0};
+    const std::vector<float> second{3.0, 4.0};
+    MicroBatcher batcher(client, "dummy", "", 4, LONG_DELAY);
+    BatchInput other = makeInput(second, 2);
+    other.name = "other";
+    auto result = batcher.infer({makeInput(first, 1), other});
+
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(result.get().status.error_code(), grpc::StatusCode::INVALID_ARGUMENT);
+    EXPECT_TRUE(server.getReceivedRequests().empty());
+}
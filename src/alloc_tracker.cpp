@@ -0,0 +1,241 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "alloc_tracker.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "logging.hpp"
+#include "metric.hpp"
+#include "metric_config.hpp"
+#include "metric_family.hpp"
+#include "metric_registry.hpp"
+
+namespace {
+// Last slot collects allocations made outside of any tracked stage.
+// Constant initialized, so it is safe to use from operator new at any point of thread lifetime.
+struct ThreadAllocState {
+    uint64_t counts[ovms::ALLOC_STAGES_COUNT + 1];
+    uint64_t bytes[ovms::ALLOC_STAGES_COUNT + 1];
+    uint32_t activeScopes[ovms::ALLOC_STAGES_COUNT];
+    size_t stage;
+};
+thread_local ThreadAllocState threadAllocState = {{}, {}, {}, ovms::ALLOC_STAGES_COUNT};
+}  // namespace
+
+#ifdef OVMS_ALLOC_TRACKING
+static inline void countAllocation(std::size_t size) {
+    ThreadAllocState& state = threadAllocState;
+    state.counts[state.stage]++;
+    state.bytes[state.stage] += size;
+}
+
+// Array and nothrow variants of libstdc++ forward to the replaced versions
+void* operator new(std::size_t size) {
+    countAllocation(size);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        void* ptr = std::malloc(size);
+        if (ptr) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    countAllocation(size);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    if (align < sizeof(void*)) {
+        align = sizeof(void*);
+    }
+    // aligned_alloc requires size to be a multiple of alignment
+    std::size_t alignedSize = ((size ? size : 1) + align - 1) & ~(align - 1);
+    while (true) {
+        void* ptr = std::aligned_alloc(align, alignedSize);
+        if (ptr) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+#endif
+
+namespace ovms {
+
+static const std::string ALLOCATIONS = "ovms_allocations";
+static const std::string ALLOCATED_BYTES = "ovms_allocated_bytes";
+
+const char* getAllocStageName(AllocStage stage) {
+    switch (stage) {
+    case ALLOC_STAGE_REST_PARSE:
+        return "rest_parse";
+    case ALLOC_STAGE_PROTO_BUILD:
+        return "proto_build";
+    case ALLOC_STAGE_VALIDATION:
+        return "validation";
+    case ALLOC_STAGE_DESERIALIZE:
+        return "deserialize";
+    case ALLOC_STAGE_INFER:
+        return "infer";
+    case ALLOC_STAGE_SERIALIZE:
+        return "serialize";
+    case ALLOC_STAGE_JSON_WRITE:
+        return "json_write";
+    case ALLOC_STAGE_DAG_NODE:
+        return "dag_node";
+    default:
+        return "unknown";
+    }
+}
+
+struct AllocMetrics {
+    std::array<std::unique_ptr<MetricCounter>, ALLOC_STAGES_COUNT> counts;
+    std::array<std::unique_ptr<MetricCounter>, ALLOC_STAGES_COUNT> bytes;
+};
+
+AllocTracker::AllocTracker() = default;
+AllocTracker::~AllocTracker() = default;
+
+AllocTracker& AllocTracker::instance() {
+    static AllocTracker tracker;
+    return tracker;
+}
+
+void AllocTracker::setMetrics(const MetricConfig* metricConfig, MetricRegistry* registry) {
+    // Metrics created in registry of previous model manager are dropped
+    std::atomic_store(&this->metrics, std::shared_ptr<const AllocMetrics>());
+    if (!registry || !metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+    bool countsEnabled = metricConfig->isFamilyEnabled(ALLOCATIONS);
+    bool bytesEnabled = metricConfig->isFamilyEnabled(ALLOCATED_BYTES);
+    if (!countsEnabled && !bytesEnabled) {
+        return;
+    }
+    if (!isCompiledIn()) {
+        SPDLOG_WARN("Metrics {} and {} require model server built with allocation tracking; these will not be reported", ALLOCATIONS, ALLOCATED_BYTES);
+        return;
+    }
+    auto newMetrics = std::make_shared<AllocMetrics>();
+    if (countsEnabled) {
+        auto family = registry->createFamily<MetricCounter>(ALLOCATIONS,
+            "Number of heap allocations made by request processing stages.");
+        if (family) {
+            for (size_t stage = 0; stage < ALLOC_STAGES_COUNT; stage++) {
+                newMetrics->counts[stage] = family->addMetric({{"stage", getAllocStageName(static_cast<AllocStage>(stage))}});
+            }
+        }
+    }
+    if (bytesEnabled) {
+        auto family = registry->createFamily<MetricCounter>(ALLOCATED_BYTES,
+            "Number of bytes allocated on heap by request processing stages.");
+        if (family) {
+            for (size_t stage = 0; stage < ALLOC_STAGES_COUNT; stage++) {
+                newMetrics->bytes[stage] = family->addMetric({{"stage", getAllocStageName(static_cast<AllocStage>(stage))}});
+            }
+        }
+    }
+    std::atomic_store(&this->metrics, std::shared_ptr<const AllocMetrics>(std::move(newMetrics)));
+}
+
+void AllocTracker::record(AllocStage stage, const AllocStats& delta) {
+    counts[stage] += delta.count;
+    bytes[stage] += delta.bytes;
+    auto currentMetrics = std::atomic_load(&this->metrics);
+    if (!currentMetrics) {
+        return;
+    }
+    if (currentMetrics->counts[stage] && delta.count) {
+        currentMetrics->counts[stage]->increment(delta.count);
+    }
+    if (currentMetrics->bytes[stage] && delta.bytes) {
+        currentMetrics->bytes[stage]->increment(delta.bytes);
+    }
+}
+
+AllocStats AllocTracker::getStageTotals(AllocStage stage) const {
+    AllocStats stats;
+    stats.count = counts[stage].load();
+    stats.bytes = bytes[stage].load();
+    return stats;
+}
+
+AllocStats AllocTracker::getThreadStats(AllocStage stage) {
+    AllocStats stats;
+    stats.count = threadAllocState.counts[stage];
+    stats.bytes = threadAllocState.bytes[stage];
+    return stats;
+}
+
+#ifdef OVMS_ALLOC_TRACKING
+AllocTrackingScope::AllocTrackingScope(AllocStage stage) :
+    stage(stage),
+    previousStage(threadAllocState.stage),
+    start(AllocTracker::getThreadStats(stage)),
+    outermost(threadAllocState.activeScopes[stage]++ == 0) {
+    threadAllocState.stage = stage;
+}
+
+void AllocTrackingScope::stop() {
+    if (stopped) {
+        return;
+    }
+    stopped = true;
+    AllocStats end = AllocTracker::getThreadStats(stage);
+    threadAllocState.stage = previousStage;
+    threadAllocState.activeScopes[stage]--;
+    if (!outermost) {
+        // Allocations are recorded by the outer scope of the same stage
+        return;
+    }
+    AllocStats delta;
+    delta.count = end.count - start.count;
+    delta.bytes = end.bytes - start.bytes;
+    AllocTracker::instance().record(stage, delta);
+}
+#endif
+
+}  // namespace ovms
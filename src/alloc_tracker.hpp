@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ovms {
+
+class MetricConfig;
+class MetricRegistry;
+struct AllocMetrics;
+
+enum AllocStage : size_t {
+    ALLOC_STAGE_REST_PARSE,
+    ALLOC_STAGE_PROTO_BUILD,
+    ALLOC_STAGE_VALIDATION,
+    ALLOC_STAGE_DESERIALIZE,
+    ALLOC_STAGE_INFER,
+    ALLOC_STAGE_SERIALIZE,
+    ALLOC_STAGE_JSON_WRITE,
+    ALLOC_STAGE_DAG_NODE,
+    ALLOC_STAGES_COUNT
+};
+
+const char* getAllocStageName(AllocStage stage);
+
+struct AllocStats {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Aggregates heap allocations made by request processing stages. Allocations are counted
+ * only in builds with OVMS_ALLOC_TRACKING defined, which replaces global operator new. Only
+ * allocations made with operator new on the thread executing the stage are counted.
+ */
+class AllocTracker {
+    std::array<std::atomic<uint64_t>, ALLOC_STAGES_COUNT> counts = {};
+    std::array<std::atomic<uint64_t>, ALLOC_STAGES_COUNT> bytes = {};
+    // Replaced with std::atomic_store, so that record() running on other threads keeps using previous metrics
+    std::shared_ptr<const AllocMetrics> metrics;
+
+    AllocTracker();
+
+public:
+    ~AllocTracker();
+    static AllocTracker& instance();
+
+    static constexpr bool isCompiledIn() {
+#ifdef OVMS_ALLOC_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void setMetrics(const MetricConfig* metricConfig, MetricRegistry* registry);
+    void record(AllocStage stage, const AllocStats& delta);
+    AllocStats getStageTotals(AllocStage stage) const;
+
+    /**
+     * @brief Allocations of the calling thread attributed to the stage since thread start
+     */
+    static AllocStats getThreadStats(AllocStage stage);
+};
+
+/**
+ * @brief Attributes allocations of the calling thread to the stage until stopped or destroyed.
+ * Nested scopes take over attribution, so each allocation is counted in one stage only. When a scope
+ * of the stage is already active on the thread, only the outermost one records the allocations.
+ * Compiles to nothing without OVMS_ALLOC_TRACKING.
+ */
+class AllocTrackingScope {
+#ifdef OVMS_ALLOC_TRACKING
+    AllocStage stage;
+    size_t previousStage;
+    AllocStats start;
+    bool outermost;
+    bool stopped = false;
+
+public:
+    explicit AllocTrackingScope(AllocStage stage);
+    ~AllocTrackingScope() { stop(); }
+    void stop();
+#else
+public:
+    explicit AllocTrackingScope(AllocStage stage) {}
+    void stop() {}
+#endif
+    AllocTrackingScope(const AllocTrackingScope&) = delete;
+    AllocTrackingScope& operator=(const AllocTrackingScope&) = delete;
+};
+
+}  // namespace ovms
@@ -15,11 +15,13 @@
 //*****************************************************************************
 #include "azurefilesystem.hpp"
 
+#include <map>
 #include <memory>
 #include <set>
 #include <vector>
 
 #include "logging.hpp"
+#include "model_archive.hpp"
 #include "stringutils.hpp"
 
 namespace ovms {
@@ -220,6 +222,14 @@ StatusCode AzureFileSystem::downloadModelVersions(const std::string& path,
         return sc;
     }
 
+    std::map<model_version_t, std::string> archives;
+    sc = ModelVersionArchive::findVersionArchives(*this, path, archives);
+    if (sc != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(azurestorage_logger, "Failed to list model version archives in {}", path);
+        return sc;
+    }
+
+    std::vector<ModelVersionArchive::Extraction> extractions;
     for (auto& ver : versions) {
         std::string versionpath = path;
         if (!endsWith(versionpath, "/")) {
@@ -232,6 +242,11 @@ StatusCode AzureFileSystem::downloadModelVersions(const std::string& path,
         }
         lpath.append(std::to_string(ver));
         fs::create_directory(lpath);
+        auto archive = archives.find(ver);
+        if (archive != archives.end()) {
+            extractions.push_back({archive->second, lpath});
+            continue;
+        }
 
         auto factory = std::make_shared<ovms::AzureStorageFactory>();
         auto azureStorageObj = factory.get()->getNewAzureStorageObject(versionpath, account_);
@@ -249,6 +264,12 @@ StatusCode AzureFileSystem::downloadModelVersions(const std::string& path,
         }
     }
 
+    sc = ModelVersionArchive::extractAll(*this, extractions);
+    if (sc != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(azurestorage_logger, "Failed to download model version archives from {}", path);
+        return sc;
+    }
+
     return StatusCode::OK;
 }
 
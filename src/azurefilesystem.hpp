@@ -131,6 +131,10 @@ public:
    */
     StatusCode deleteFileFolder(const std::string& path) override;
 
+    bool supportsModelVersionArchives() const override {
+        return true;
+    }
+
     static const std::string AZURE_URL_FILE_PREFIX;
 
     static const std::string AZURE_URL_BLOB_PREFIX;
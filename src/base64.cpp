@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "base64.hpp"
+
+#include <cstdint>
+
+#include "absl/strings/escaping.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define OVMS_BASE64_AVX2
+#include <immintrin.h>
+#endif
+
+namespace ovms {
+
+namespace {
+constexpr unsigned char INVALID_CHAR = 0xFF;
+
+struct DecodeTable {
+    unsigned char values[256];
+    constexpr DecodeTable() :
+        values() {
+        for (int i = 0; i < 256; i++) {
+            values[i] = INVALID_CHAR;
+        }
+        for (int i = 0; i < 26; i++) {
+            values['A' + i] = i;
+            values['a' + i] = 26 + i;
+        }
+        for (int i = 0; i < 10; i++) {
+            values['0' + i] = 52 + i;
+        }
+        values['+'] = 62;
+        values['/'] = 63;
+    }
+};
+
+constexpr DecodeTable DECODE_TABLE;
+
+inline bool decodeQuad(const unsigned char* src, unsigned char* dst) {
+    uint32_t a = DECODE_TABLE.values[src[0]];
+    uint32_t b = DECODE_TABLE.values[src[1]];
+    uint32_t c = DECODE_TABLE.values[src[2]];
+    uint32_t d = DECODE_TABLE.values[src[3]];
+    if ((a | b | c | d) & 0x80) {
+        return false;
+    }
+    uint32_t value = (a << 18) | (b << 12) | (c << 6) | d;
+    dst[0] = static_cast<unsigned char>(value >> 16);
+    dst[1] = static_cast<unsigned char>(value >> 8);
+    dst[2] = static_cast<unsigned char>(value);
+    return true;
+}
+
+#ifdef OVMS_BASE64_AVX2
+/**
+ * Decodes 32 characters into 24 bytes per iteration, following vectorized base64 decoding
+ * by W. Mula and D. Lemire. Each store writes 32 bytes, so at least 48 characters are left
+ * unprocessed behind to keep stores within destination buffer.
+ * Returns number of consumed characters, stops at the first block with invalid characters.
+ */
+__attribute__((target("avx2"))) size_t decodeAvx2(const unsigned char* src, size_t size, unsigned char* dst) {
+    const __m256i lutLo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lutHi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lutRoll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71,
+        0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2F);
+    const __m256i packShuffle = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i packPermute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+    size_t consumed = 0;
+    while (size - consumed >= 48) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + consumed));
+        const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask2F);
+        const __m256i loNibbles = _mm256_and_si256(chars, mask2F);
+        const __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+        const __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+        if (!_mm256_testz_si256(lo, hi)) {
+            break;
+        }
+        const __m256i eq2F = _mm256_cmpeq_epi8(chars, mask2F);
+        const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, hiNibbles));
+        __m256i values = _mm256_add_epi8(chars, roll);
+        // Merge 6 bit values into 24 bit groups and pack them together
+        values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+        values = _mm256_shuffle_epi8(values, packShuffle);
+        values = _mm256_permutevar8x32_epi32(values, packPermute);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + consumed / 4 * 3), values);
+        consumed += 32;
+    }
+    return consumed;
+}
+
+const bool AVX2_SUPPORTED = __builtin_cpu_supports("avx2");
+#endif
+}  // namespace
+
+size_t getBase64DecodedSizeUpperBound(size_t encodedSize) {
+    return (encodedSize + 3) / 4 * 3;
+}
+
+bool decodeBase64Strict(const char* src, size_t size, char* dst, size_t& decodedSize) {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(src);
+    unsigned char* out = reinterpret_cast<unsigned char*>(dst);
+    size_t padding = 0;
+    if (size >= 4 && size % 4 == 0 && in[size - 1] == '=') {
+        padding = in[size - 2] == '=' ? 2 : 1;
+    }
+    size_t length = size - padding;
+    size_t tail = length % 4;
+    if (tail == 1) {
+        return false;
+    }
+    size_t fullQuads = length - tail;
+    size_t i = 0;
+#ifdef OVMS_BASE64_AVX2
+    if (AVX2_SUPPORTED) {
+        i = decodeAvx2(in, fullQuads, out);
+    }
+#endif
+    size_t o = i / 4 * 3;
+    for (; i < fullQuads; i += 4, o += 3) {
+        if (!decodeQuad(in + i, out + o)) {
+            return false;
+        }
+    }
+    if (tail > 0) {
+        uint32_t a = DECODE_TABLE.values[in[i]];
+        uint32_t b = DECODE_TABLE.values[in[i + 1]];
+        uint32_t c = tail == 3 ? DECODE_TABLE.values[in[i + 2]] : 0;
+        if ((a | b | c) & 0x80) {
+            return false;
+        }
+        uint32_t value = (a << 18) | (b << 12) | (c << 6);
+        // Bits below the last decoded byte have to be zero in canonical encoding
+        if (value & (tail == 2 ? 0xFFFF : 0xFF)) {
+            return false;
+        }
+        out[o++] = static_cast<unsigned char>(value >> 16);
+        if (tail == 3) {
+            out[o++] = static_cast<unsigned char>(value >> 8);
+        }
+    }
+    decodedSize = o;
+    return true;
+}
+
+Status decodeBase64(const char* encoded, size_t size, std::string& decoded) {
+    decoded.resize(getBase64DecodedSizeUpperBound(size));
+    size_t decodedSize = 0;
+    if (decodeBase64Strict(encoded, size, decoded.data(), decodedSize)) {
+        decoded.resize(decodedSize);
+        return StatusCode::OK;
+    }
+    if (absl::Base64Unescape(absl::string_view(encoded, size), &decoded)) {
+        return StatusCode::OK;
+    }
+    return StatusCode::REST_BASE64_DECODE_ERROR;
+}
+
+}  // namespace ovms
@@ -0,0 +1,42 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "status.hpp"
+
+namespace ovms {
+
+size_t getBase64DecodedSizeUpperBound(size_t encodedSize);
+
+/**
+ * @brief Decodes standard base64 with optional padding. Uses AVX2 when available on the CPU.
+ *
+ * @param dst buffer of at least getBase64DecodedSizeUpperBound(size) bytes
+ * @param decodedSize number of bytes written to dst
+ * @return false when input contains whitespace, misplaced padding or characters outside of the alphabet
+ */
+bool decodeBase64Strict(const char* src, size_t size, char* dst, size_t& decodedSize);
+
+/**
+ * @brief Decodes base64 directly into decoded buffer. Inputs rejected by the strict decoder
+ * are passed to the generic decoder, which accepts e.g. embedded whitespace.
+ */
+Status decodeBase64(const char* encoded, size_t size, std::string& decoded);
+
+}  // namespace ovms
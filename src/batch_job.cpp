@@ -0,0 +1,826 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "batch_job.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <spdlog/spdlog.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "executingstreamidguard.hpp"
+#include "execution_context.hpp"
+#include "filesystem.hpp"
+#include "modelinstance.hpp"
+#include "modelinstanceunloadguard.hpp"
+#include "modelmanager.hpp"
+#include "numpy_utils.hpp"
+#include "pipeline.hpp"
+#include "precision.hpp"
+#include "stringutils.hpp"
+#include "tfs_frontend/tfs_utils.hpp"
+
+namespace ovms {
+
+const size_t BatchJobManager::MAX_QUEUED_JOBS = 16;
+const size_t BatchJobManager::MAX_FINISHED_JOBS = 64;
+const uint32_t BatchJobManager::MAX_IN_FLIGHT = 64;
+const uint32_t BatchJobManager::MAX_BATCH_SIZE = 1024;
+const int BatchJobManager::JOB_THREAD_NICE_VALUE = 10;
+
+namespace {
+const std::string MANIFEST_FILE_NAME = "manifest.jsonl";
+const std::set<std::string> IMAGE_EXTENSIONS{".jpg", ".jpeg", ".png", ".bmp", ".tif", ".tiff"};
+// Number of items buffered between stages for each request in flight
+const size_t ITEMS_BUFFERED_PER_IN_FLIGHT = 2;
+
+enum class ItemFormat {
+    NPY,
+    NPZ,
+    IMAGES
+};
+
+struct BatchJobItem {
+    std::string name;
+    ItemFormat format;
+    std::vector<std::filesystem::path> files;
+    std::vector<std::string> contents;
+    tensorflow::serving::PredictRequest request;
+    tensorflow::serving::PredictResponse response;
+    size_t samples = 0;
+    Status status;
+};
+
+using BatchJobItemPtr = std::unique_ptr<BatchJobItem>;
+
+/**
+ * @brief Blocking queue connecting job stages. Producer waits when queue is full, so stages cannot
+ * run far ahead of inference and memory usage stays bounded.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    BoundedQueue(size_t capacity) :
+        capacity(std::max<size_t>(capacity, 1)) {}
+
+    void push(T element) {
+        std::unique_lock<std::mutex> lock(mtx);
+        notFull.wait(lock, [this]() { return queue.size() < capacity; });
+        queue.push_back(std::move(element));
+        notEmpty.notify_one();
+    }
+
+    // Returns nullopt when queue is closed and drained
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mtx);
+        notEmpty.wait(lock, [this]() { return !queue.empty() || closed; });
+        if (queue.empty()) {
+            return std::nullopt;
+        }
+        T element = std::move(queue.front());
+        queue.pop_front();
+        notFull.notify_one();
+        return std::optional<T>{std::move(element)};
+    }
+
+    void close() {
+        std::unique_lock<std::mutex> lock(mtx);
+        closed = true;
+        notEmpty.notify_all();
+    }
+
+private:
+    const size_t capacity;
+    std::mutex mtx;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<T> queue;
+    bool closed = false;
+};
+
+void lowerThreadPriority() {
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), BatchJobManager::JOB_THREAD_NICE_VALUE) != 0) {
+        SPDLOG_DEBUG("Failed to lower priority of batch job thread: {}", std::strerror(errno));
+    }
+}
+
+std::string toLower(std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    return str;
+}
+
+// Output names may contain characters not allowed in file names
+std::string toFileName(const std::string& name) {
+    std::string result = name;
+    for (auto& c : result) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-' && c != '_') {
+            c = '_';
+        }
+    }
+    return result;
+}
+
+Status resolvePath(const std::string& rootPath, const std::string& relativePath, std::filesystem::path& resolved) {
+    if (relativePath.empty() || relativePath[0] == '/' || relativePath == ".." || FileSystem::isPathEscaped(relativePath)) {
+        return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "path has to be relative to batch job directory: " + relativePath);
+    }
+    std::error_code ec;
+    const auto root = std::filesystem::weakly_canonical(rootPath, ec);
+    if (ec) {
+        return Status(StatusCode::PATH_INVALID, rootPath);
+    }
+    resolved = std::filesystem::weakly_canonical(root / relativePath, ec);
+    if (ec) {
+        return Status(StatusCode::PATH_INVALID, relativePath);
+    }
+    // Symbolic links must not lead outside of the root directory
+    auto rootEnd = std::mismatch(root.begin(), root.end(), resolved.begin(), resolved.end()).first;
+    if (rootEnd != root.end()) {
+        return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "path leads outside of batch job directory: " + relativePath);
+    }
+    return StatusCode::OK;
+}
+
+Status readFile(const std::filesystem::path& path, std::string& content) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return Status(StatusCode::FILE_INVALID, path.string());
+    }
+    content.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(content.data(), content.size())) {
+        return Status(StatusCode::FILE_INVALID, path.string());
+    }
+    return StatusCode::OK;
+}
+
+Status writeFile(const std::filesystem::path& path, const std::string& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open() || !file.write(content.data(), content.size())) {
+        return Status(StatusCode::FILESYSTEM_ERROR, "could not write: " + path.string());
+    }
+    return StatusCode::OK;
+}
+
+Status fillTensorProto(const NumpyArray& array, tensorflow::TensorProto& proto) {
+    if (array.precision == Precision::U32) {
+        return Status(StatusCode::NUMPY_INVALID_FORMAT, "uint32 arrays are not supported by TensorFlow Serving API");
+    }
+    proto.set_dtype(getPrecisionAsDataType(array.precision));
+    for (const auto dim : array.shape) {
+        proto.mutable_tensor_shape()->add_dim()->set_size(dim);
+    }
+    // 16 bit types are expected in repeated fields instead of tensor content
+    if (array.precision == Precision::FP16 || array.precision == Precision::U16) {
+        const size_t count = array.data.size() / sizeof(uint16_t);
+        auto* values = array.precision == Precision::FP16 ? proto.mutable_half_val() : proto.mutable_int_val();
+        values->Reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            uint16_t value;
+            std::memcpy(&value, array.data.data() + i * sizeof(uint16_t), sizeof(uint16_t));
+            values->Add(value);
+        }
+    } else {
+        proto.set_tensor_content(array.data.data(), array.data.size());
+    }
+    return StatusCode::OK;
+}
+
+size_t getSamples(const NumpyArray& array) {
+    return array.shape.empty() ? 1 : array.shape[0];
+}
+
+class BatchJobRunner {
+public:
+    BatchJobRunner(ModelManager& manager, BatchJob& job, const std::string& rootPath) :
+        manager(manager),
+        job(job),
+        spec(job.getSpec()),
+        rootPath(rootPath),
+        decodeQueue(spec.maxInFlight * ITEMS_BUFFERED_PER_IN_FLIGHT),
+        inferQueue(spec.maxInFlight * ITEMS_BUFFERED_PER_IN_FLIGHT),
+        writeQueue(spec.maxInFlight * ITEMS_BUFFERED_PER_IN_FLIGHT) {}
+
+    Status run() {
+        auto status = prepare();
+        if (!status.ok()) {
+            return status;
+        }
+        job.setRunning(items.size());
+        SPDLOG_INFO("Started batch job: {}; servable: {}; items: {}; requests in flight: {}", job.getId(), spec.servableName, items.size(), spec.maxInFlight);
+
+        std::thread reader([this]() { readStage(); });
+        std::thread decoder([this]() { decodeStage(); });
+        std::vector<std::thread> inferWorkers;
+        for (uint32_t i = 0; i < spec.maxInFlight; i++) {
+            inferWorkers.emplace_back([this]() { inferStage(); });
+        }
+        std::thread writer([this]() { writeStage(); });
+
+        reader.join();
+        decoder.join();
+        for (auto& worker : inferWorkers) {
+            worker.join();
+        }
+        writeQueue.close();
+        writer.join();
+        return writeStatus;
+    }
+
+private:
+    Status prepare() {
+        std::filesystem::path inputPath;
+        auto status = resolvePath(rootPath, spec.inputPath, inputPath);
+        if (!status.ok()) {
+            return status;
+        }
+        status = resolvePath(rootPath, spec.outputPath, outputPath);
+        if (!status.ok()) {
+            return status;
+        }
+        std::error_code ec;
+        std::vector<std::filesystem::path> files;
+        if (std::filesystem::is_directory(inputPath, ec)) {
+            for (const auto& entry : std::filesystem::directory_iterator(inputPath, ec)) {
+                if (entry.is_regular_file()) {
+                    files.push_back(entry.path());
+                }
+            }
+            std::sort(files.begin(), files.end());
+        } else if (std::filesystem::is_regular_file(inputPath, ec)) {
+            files.push_back(inputPath);
+        } else {
+            return Status(StatusCode::PATH_INVALID, "input path does not exist: " + spec.inputPath);
+        }
+
+        std::vector<std::filesystem::path> images;
+        for (const auto& file : files) {
+            const std::string extension = toLower(file.extension().string());
+            if (extension == ".npy" || extension == ".npz") {
+                auto item = std::make_unique<BatchJobItem>();
+                item->name = file.filename().string();
+                item->format = extension == ".npy" ? ItemFormat::NPY : ItemFormat::NPZ;
+                item->files.push_back(file);
+                items.push_back(std::move(item));
+            } else if (IMAGE_EXTENSIONS.count(extension)) {
+                images.push_back(file);
+            } else {
+                SPDLOG_DEBUG("Batch job: {}; skipping unsupported file: {}", job.getId(), file.string());
+            }
+        }
+        for (size_t i = 0; i < images.size(); i += spec.batchSize) {
+            auto item = std::make_unique<BatchJobItem>();
+            item->name = images[i].filename().string();
+            item->format = ItemFormat::IMAGES;
+            item->files.assign(images.begin() + i, images.begin() + std::min(images.size(), i + spec.batchSize));
+            items.push_back(std::move(item));
+        }
+        if (items.empty()) {
+            return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "no .npy, .npz or image files found in: " + spec.inputPath);
+        }
+
+        inputName = spec.inputName;
+        if (inputName.empty()) {
+            std::shared_ptr<ModelInstance> modelInstance;
+            std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+            status = manager.getModelInstance(spec.servableName, spec.servableVersion, modelInstance, unloadGuard);
+            if (status.ok() && modelInstance->getInputsInfo().size() == 1) {
+                inputName = modelInstance->getInputsInfo().begin()->first;
+            }
+        }
+        const bool inputNameRequired = std::any_of(items.begin(), items.end(), [](const BatchJobItemPtr& item) { return item->format != ItemFormat::NPZ; });
+        if (inputName.empty() && inputNameRequired) {
+            return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "input_name is required unless servable is a model with single input");
+        }
+
+        std::filesystem::create_directories(outputPath, ec);
+        if (ec) {
+            return Status(StatusCode::FILESYSTEM_ERROR, "could not create output directory: " + ec.message());
+        }
+        manifest.open(outputPath / MANIFEST_FILE_NAME, std::ios::trunc);
+        if (!manifest.is_open()) {
+            return Status(StatusCode::FILESYSTEM_ERROR, "could not create manifest in: " + spec.outputPath);
+        }
+        return StatusCode::OK;
+    }
+
+    void readStage() {
+        lowerThreadPriority();
+        for (auto& item : items) {
+            if (job.isCancelRequested()) {
+                break;
+            }
+            item->contents.resize(item->files.size());
+            for (size_t i = 0; i < item->files.size() && item->status.ok(); i++) {
+                item->status = readFile(item->files[i], item->contents[i]);
+            }
+            decodeQueue.push(std::move(item));
+        }
+        decodeQueue.close();
+    }
+
+    void decodeStage() {
+        lowerThreadPriority();
+        while (auto item = decodeQueue.pop()) {
+            if ((*item)->status.ok() && !job.isCancelRequested()) {
+                (*item)->status = decode(**item);
+            }
+            inferQueue.push(std::move(*item));
+        }
+        inferQueue.close();
+    }
+
+    void inferStage() {
+        lowerThreadPriority();
+        while (auto item = inferQueue.pop()) {
+            if ((*item)->status.ok() && !job.isCancelRequested()) {
+                (*item)->status = infer(**item);
+            }
+            // Inputs are not needed anymore, release memory before outputs are written
+            (*item)->request.Clear();
+            (*item)->contents.clear();
+            writeQueue.push(std::move(*item));
+        }
+    }
+
+    void writeStage() {
+        lowerThreadPriority();
+        while (auto item = writeQueue.pop()) {
+            if (job.isCancelRequested()) {
+                continue;
+            }
+            if ((*item)->status.ok()) {
+                (*item)->status = write(**item);
+            }
+            appendToManifest(**item);
+            job.reportItem((*item)->status.ok(), (*item)->samples);
+            if (!(*item)->status.ok()) {
+                SPDLOG_DEBUG("Batch job: {}; item: {} failed: {}", job.getId(), (*item)->name, (*item)->status.string());
+            }
+        }
+        manifest.flush();
+        if (!manifest.good()) {
+            writeStatus = Status(StatusCode::FILESYSTEM_ERROR, "could not write manifest");
+        }
+    }
+
+    Status decode(BatchJobItem& item) {
+        auto& request = item.request;
+        request.mutable_model_spec()->set_name(spec.servableName);
+        if (spec.servableVersion > 0) {
+            request.mutable_model_spec()->mutable_version()->set_value(spec.servableVersion);
+        }
+        auto& inputs = *request.mutable_inputs();
+        if (item.format == ItemFormat::NPY) {
+            NumpyArray array;
+            auto status = parseNpy(item.contents[0], array);
+            if (!status.ok()) {
+                return status;
+            }
+            item.samples = getSamples(array);
+            return fillTensorProto(array, inputs[inputName]);
+        }
+        if (item.format == ItemFormat::NPZ) {
+            numpy_arrays_t arrays;
+            auto status = parseNpz(item.contents[0], arrays);
+            if (!status.ok()) {
+                return status;
+            }
+            if (arrays.empty()) {
+                return Status(StatusCode::NUMPY_INVALID_FORMAT, "npz archive is empty");
+            }
+            item.samples = getSamples(arrays.front().second);
+            for (const auto& [name, array] : arrays) {
+                status = fillTensorProto(array, inputs[name]);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+            return StatusCode::OK;
+        }
+        // Images are decoded and resized to model shape by binary input handling during inference
+        auto& proto = inputs[inputName];
+        proto.set_dtype(tensorflow::DataType::DT_STRING);
+        proto.mutable_tensor_shape()->add_dim()->set_size(item.contents.size());
+        for (auto& content : item.contents) {
+            proto.add_string_val(std::move(content));
+        }
+        item.samples = item.contents.size();
+        return StatusCode::OK;
+    }
+
+    Status infer(BatchJobItem& item) {
+        // Online requests waiting for infer request of a model or a DAG node take precedence over batch job
+        LowPriorityInferenceScope lowPriorityScope;
+        std::shared_ptr<ModelInstance> modelInstance;
+        std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+        auto status = manager.getModelInstance(spec.servableName, spec.servableVersion, modelInstance, unloadGuard);
+        if (status == StatusCode::MODEL_NAME_MISSING) {
+            std::unique_ptr<Pipeline> pipeline;
+            status = manager.createPipeline(pipeline, spec.servableName, &item.request, &item.response);
+            if (!status.ok()) {
+                return status;
+            }
+            return pipeline->execute(ExecutionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::Predict});
+        }
+        if (!status.ok()) {
+            return status;
+        }
+        return modelInstance->infer(&item.request, &item.response, unloadGuard);
+    }
+
+    Status write(BatchJobItem& item) {
+        const auto itemPath = outputPath / toFileName(item.name);
+        std::error_code ec;
+        std::filesystem::create_directories(itemPath, ec);
+        if (ec) {
+            return Status(StatusCode::FILESYSTEM_ERROR, "could not create directory: " + itemPath.string());
+        }
+        std::string content;
+        for (const auto& [name, proto] : item.response.outputs()) {
+            shape_t shape;
+            for (const auto& dim : proto.tensor_shape().dim()) {
+                shape.push_back(dim.size());
+            }
+            auto status = makeNpy(TFSPrecisionToOvmsPrecision(proto.dtype()), shape, proto.tensor_content(), content);
+            if (!status.ok()) {
+                return Status(StatusCode::NUMPY_INVALID_FORMAT, "output " + name + " can not be stored in npy");
+            }
+            status = writeFile(itemPath / (toFileName(name) + ".npy"), content);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        return StatusCode::OK;
+    }
+
+    void appendToManifest(const BatchJobItem& item) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        writer.StartObject();
+        writer.Key("item");
+        writer.String(item.name.c_str());
+        writer.Key("inputs");
+        writer.StartArray();
+        for (const auto& file : item.files) {
+            writer.String(file.filename().string().c_str());
+        }
+        writer.EndArray();
+        writer.Key("status");
+        writer.String(item.status.ok() ? "OK" : item.status.string().c_str());
+        writer.EndObject();
+        manifest << buffer.GetString() << '\n';
+    }
+
+    ModelManager& manager;
+    BatchJob& job;
+    const BatchJobSpec& spec;
+    const std::string rootPath;
+    std::filesystem::path outputPath;
+    std::string inputName;
+    std::vector<BatchJobItemPtr> items;
+    std::ofstream manifest;
+    Status writeStatus;
+
+    BoundedQueue<BatchJobItemPtr> decodeQueue;
+    BoundedQueue<BatchJobItemPtr> inferQueue;
+    BoundedQueue<BatchJobItemPtr> writeQueue;
+};
+}  // namespace
+
+const std::string& toString(BatchJobState state) {
+    static const std::unordered_map<BatchJobState, std::string> names{
+        {BatchJobState::QUEUED, "QUEUED"},
+        {BatchJobState::RUNNING, "RUNNING"},
+        {BatchJobState::COMPLETED, "COMPLETED"},
+        {BatchJobState::FAILED, "FAILED"},
+        {BatchJobState::CANCELLED, "CANCELLED"}};
+    return names.at(state);
+}
+
+Status BatchJobSpec::fromJson(const std::string& json, BatchJobSpec& spec) {
+    rapidjson::Document doc;
+    if (doc.Parse(json.c_str()).HasParseError() || !doc.IsObject()) {
+        return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "body is not a json object");
+    }
+    auto getString = [&doc](const char* key, std::string& value, bool required) -> Status {
+        auto it = doc.FindMember(key);
+        if (it == doc.MemberEnd()) {
+            return required ? Status(StatusCode::BATCH_JOB_INVALID_REQUEST, std::string(key) + " is required") : StatusCode::OK;
+        }
+        if (!it->value.IsString()) {
+            return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, std::string(key) + " has to be a string");
+        }
+        value = it->value.GetString();
+        return StatusCode::OK;
+    };
+    auto getUint = [&doc](const char* key, uint32_t& value, uint32_t max) -> Status {
+        auto it = doc.FindMember(key);
+        if (it == doc.MemberEnd()) {
+            return StatusCode::OK;
+        }
+        if (!it->value.IsUint() || it->value.GetUint() == 0 || it->value.GetUint() > max) {
+            return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, std::string(key) + " has to be an integer in range 1-" + std::to_string(max));
+        }
+        value = it->value.GetUint();
+        return StatusCode::OK;
+    };
+    BatchJobSpec result;
+    Status status;
+    if (!(status = getString("servable_name", result.servableName, true)).ok() ||
+        !(status = getString("input_path", result.inputPath, true)).ok() ||
+        !(status = getString("output_path", result.outputPath, true)).ok() ||
+        !(status = getString("input_name", result.inputName, false)).ok() ||
+        !(status = getUint("batch_size", result.batchSize, BatchJobManager::MAX_BATCH_SIZE)).ok() ||
+        !(status = getUint("max_in_flight", result.maxInFlight, BatchJobManager::MAX_IN_FLIGHT)).ok()) {
+        return status;
+    }
+    auto it = doc.FindMember("servable_version");
+    if (it != doc.MemberEnd()) {
+        if (!it->value.IsInt64() || it->value.GetInt64() < 0) {
+            return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "servable_version has to be a non negative integer");
+        }
+        result.servableVersion = it->value.GetInt64();
+    }
+    spec = std::move(result);
+    return StatusCode::OK;
+}
+
+BatchJob::BatchJob(const std::string& id, const BatchJobSpec& spec) :
+    id(id),
+    spec(spec),
+    createdAt(std::chrono::system_clock::now()) {}
+
+bool BatchJob::isFinished() const {
+    auto current = state.load();
+    return current == BatchJobState::COMPLETED || current == BatchJobState::FAILED || current == BatchJobState::CANCELLED;
+}
+
+void BatchJob::cancel() {
+    cancelRequested = true;
+    auto expected = BatchJobState::QUEUED;
+    if (state.compare_exchange_strong(expected, BatchJobState::CANCELLED)) {
+        std::lock_guard<std::mutex> lock(mtx);
+        startedAt = finishedAt = std::chrono::steady_clock::now();
+    }
+}
+
+void BatchJob::setRunning(size_t itemsTotal) {
+    this->itemsTotal = itemsTotal;
+    std::lock_guard<std::mutex> lock(mtx);
+    startedAt = std::chrono::steady_clock::now();
+    state = BatchJobState::RUNNING;
+}
+
+void BatchJob::setFinished(const Status& status) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (startedAt == std::chrono::steady_clock::time_point{}) {
+        startedAt = std::chrono::steady_clock::now();
+    }
+    finishedAt = std::chrono::steady_clock::now();
+    if (!status.ok()) {
+        error = status.string();
+        state = BatchJobState::FAILED;
+    } else if (cancelRequested) {
+        state = BatchJobState::CANCELLED;
+    } else {
+        state = BatchJobState::COMPLETED;
+    }
+}
+
+void BatchJob::reportItem(bool succeeded, size_t samples) {
+    itemsProcessed++;
+    if (succeeded) {
+        samplesProcessed += samples;
+    } else {
+        itemsFailed++;
+    }
+}
+
+std::string BatchJob::toJson() const {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    std::unique_lock<std::mutex> lock(mtx);
+    const auto currentState = state.load();
+    const auto end = isFinished() ? finishedAt : std::chrono::steady_clock::now();
+    const double elapsedSeconds = currentState == BatchJobState::QUEUED ? 0 : std::chrono::duration<double>(end - startedAt).count();
+    writer.StartObject();
+    writer.Key("id");
+    writer.String(id.c_str());
+    writer.Key("state");
+    writer.String(toString(currentState).c_str());
+    writer.Key("servable_name");
+    writer.String(spec.servableName.c_str());
+    writer.Key("servable_version");
+    writer.Int64(spec.servableVersion);
+    writer.Key("input_path");
+    writer.String(spec.inputPath.c_str());
+    writer.Key("output_path");
+    writer.String(spec.outputPath.c_str());
+    writer.Key("created_at");
+    writer.Int64(std::chrono::duration_cast<std::chrono::seconds>(createdAt.time_since_epoch()).count());
+    writer.Key("items_total");
+    writer.Uint64(itemsTotal.load());
+    writer.Key("items_processed");
+    writer.Uint64(itemsProcessed.load());
+    writer.Key("items_failed");
+    writer.Uint64(itemsFailed.load());
+    writer.Key("samples_processed");
+    writer.Uint64(samplesProcessed.load());
+    writer.Key("elapsed_seconds");
+    writer.Double(elapsedSeconds);
+    writer.Key("samples_per_second");
+    writer.Double(elapsedSeconds > 0 ? samplesProcessed.load() / elapsedSeconds : 0);
+    if (!error.empty()) {
+        writer.Key("error");
+        writer.String(error.c_str());
+    }
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+BatchJobManager::BatchJobManager(ModelManager& manager) :
+    manager(manager) {}
+
+BatchJobManager::~BatchJobManager() {
+    stop();
+}
+
+Status BatchJobManager::start(const std::string& rootPath) {
+    if (rootPath.empty()) {
+        return StatusCode::OK;
+    }
+    std::error_code ec;
+    if (!std::filesystem::is_directory(rootPath, ec)) {
+        SPDLOG_ERROR("Batch job directory does not exist: {}", rootPath);
+        return StatusCode::PATH_INVALID;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    if (runner.joinable()) {
+        return StatusCode::OK;
+    }
+    this->rootPath = rootPath;
+    this->stopRequested = false;
+    runner = std::thread([this]() { runLoop(); });
+    SPDLOG_INFO("Batch jobs enabled in directory: {}", rootPath);
+    return StatusCode::OK;
+}
+
+void BatchJobManager::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopRequested = true;
+        for (auto& [id, job] : jobs) {
+            if (!job->isFinished()) {
+                job->cancel();
+            }
+        }
+        queue.clear();
+    }
+    queueCv.notify_all();
+    if (runner.joinable()) {
+        runner.join();
+        SPDLOG_INFO("Shutdown batch job runner");
+    }
+}
+
+Status BatchJobManager::submit(const BatchJobSpec& spec, std::shared_ptr<BatchJob>& job) {
+    if (!isEnabled()) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    if (spec.servableName.empty()) {
+        return Status(StatusCode::BATCH_JOB_INVALID_REQUEST, "servable_name is required");
+    }
+    if (!manager.modelExists(spec.servableName) && !manager.pipelineDefinitionExists(spec.servableName)) {
+        return StatusCode::MODEL_NAME_MISSING;
+    }
+    std::filesystem::path path;
+    auto status = resolvePath(rootPath, spec.inputPath, path);
+    if (!status.ok()) {
+        return status;
+    }
+    status = resolvePath(rootPath, spec.outputPath, path);
+    if (!status.ok()) {
+        return status;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    if (stopRequested) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    if (queue.size() >= MAX_QUEUED_JOBS) {
+        return StatusCode::BATCH_JOB_LIMIT_REACHED;
+    }
+    removeOldestFinishedJobs();
+    const uint64_t id = nextId++;
+    job = std::make_shared<BatchJob>(std::to_string(id), spec);
+    jobs[id] = job;
+    queue.push_back(job);
+    queueCv.notify_one();
+    SPDLOG_DEBUG("Queued batch job: {}; servable: {}; input: {}; output: {}", job->getId(), spec.servableName, spec.inputPath, spec.outputPath);
+    return StatusCode::OK;
+}
+
+Status BatchJobManager::get(const std::string& id, std::shared_ptr<BatchJob>& job) const {
+    if (!isEnabled()) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    auto numericId = stoi64(id);
+    if (!numericId.has_value()) {
+        return StatusCode::BATCH_JOB_NOT_FOUND;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = jobs.find(numericId.value());
+    if (it == jobs.end()) {
+        return StatusCode::BATCH_JOB_NOT_FOUND;
+    }
+    job = it->second;
+    return StatusCode::OK;
+}
+
+Status BatchJobManager::cancel(const std::string& id, std::shared_ptr<BatchJob>& job) {
+    auto status = get(id, job);
+    if (!status.ok()) {
+        return status;
+    }
+    job->cancel();
+    SPDLOG_DEBUG("Requested cancellation of batch job: {}", id);
+    return StatusCode::OK;
+}
+
+std::vector<std::shared_ptr<BatchJob>> BatchJobManager::list() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<std::shared_ptr<BatchJob>> result;
+    for (const auto& [id, job] : jobs) {
+        result.push_back(job);
+    }
+    return result;
+}
+
+// Jobs are ordered by id, so oldest finished jobs are removed first
+void BatchJobManager::removeOldestFinishedJobs() {
+    size_t finished = std::count_if(jobs.begin(), jobs.end(), [](const auto& entry) { return entry.second->isFinished(); });
+    for (auto it = jobs.begin(); it != jobs.end() && finished >= MAX_FINISHED_JOBS;) {
+        if (it->second->isFinished()) {
+            it = jobs.erase(it);
+            finished--;
+        } else {
+            ++it;
+        }
+    }
+}
+
+void BatchJobManager::runLoop() {
+    SPDLOG_DEBUG("Started batch job runner thread");
+    while (true) {
+        std::shared_ptr<BatchJob> job;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            queueCv.wait(lock, [this]() { return stopRequested || !queue.empty(); });
+            if (stopRequested) {
+                return;
+            }
+            job = queue.front();
+            queue.pop_front();
+        }
+        if (job->isFinished()) {
+            continue;  // cancelled while queued
+        }
+        BatchJobRunner runner(manager, *job, rootPath);
+        auto status = runner.run();
+        job->setFinished(status);
+        SPDLOG_INFO("Finished batch job: {}; state: {}; {}", job->getId(), toString(job->getState()), status.string());
+    }
+}
+
+}  // namespace ovms
@@ -0,0 +1,153 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "modelversion.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+class ModelManager;
+
+/**
+ * @brief Offline scoring job parameters. Paths are relative to the batch job root directory.
+ */
+struct BatchJobSpec {
+    std::string servableName;
+    model_version_t servableVersion = 0;
+    // File or directory with .npy/.npz shards or images
+    std::string inputPath;
+    // Directory where outputs and manifest.jsonl are written
+    std::string outputPath;
+    // Input fed from .npy files and images. Not required for single input models and .npz files.
+    std::string inputName;
+    // Number of images sent in single request
+    uint32_t batchSize = 1;
+    // Number of requests executed in parallel
+    uint32_t maxInFlight = 1;
+
+    static Status fromJson(const std::string& json, BatchJobSpec& spec);
+};
+
+enum class BatchJobState {
+    QUEUED,
+    RUNNING,
+    COMPLETED,
+    FAILED,
+    CANCELLED
+};
+
+const std::string& toString(BatchJobState state);
+
+class BatchJob {
+public:
+    BatchJob(const std::string& id, const BatchJobSpec& spec);
+
+    const std::string& getId() const { return id; }
+    const BatchJobSpec& getSpec() const { return spec; }
+    BatchJobState getState() const { return state.load(); }
+    bool isFinished() const;
+
+    /**
+     * @brief Requests cancellation. Queued job is cancelled right away, running job stops after requests in flight.
+     */
+    void cancel();
+    bool isCancelRequested() const { return cancelRequested.load(); }
+
+    void setRunning(size_t itemsTotal);
+    void setFinished(const Status& status);
+    void reportItem(bool succeeded, size_t samples);
+
+    std::string toJson() const;
+
+private:
+    const std::string id;
+    const BatchJobSpec spec;
+    std::atomic<BatchJobState> state{BatchJobState::QUEUED};
+    std::atomic<bool> cancelRequested{false};
+    std::atomic<size_t> itemsTotal{0};
+    std::atomic<size_t> itemsProcessed{0};
+    std::atomic<size_t> itemsFailed{0};
+    std::atomic<size_t> samplesProcessed{0};
+
+    mutable std::mutex mtx;
+    std::string error;
+    std::chrono::system_clock::time_point createdAt;
+    std::chrono::steady_clock::time_point startedAt;
+    std::chrono::steady_clock::time_point finishedAt;
+};
+
+/**
+ * @brief Runs offline scoring jobs one at a time in background. Each job streams inputs from local storage
+ * through read, decode, infer and write stages running in parallel. Job threads run with lowered priority
+ * and inference is held back while online requests wait for an infer request of the model.
+ */
+class BatchJobManager {
+public:
+    static const size_t MAX_QUEUED_JOBS;
+    static const size_t MAX_FINISHED_JOBS;
+    static const uint32_t MAX_IN_FLIGHT;
+    static const uint32_t MAX_BATCH_SIZE;
+    static const int JOB_THREAD_NICE_VALUE;
+
+    BatchJobManager(ModelManager& manager);
+    ~BatchJobManager();
+
+    /**
+     * @brief Enables batch jobs reading and writing files under rootPath. Jobs are disabled when rootPath is empty.
+     */
+    Status start(const std::string& rootPath);
+    /**
+     * @brief Cancels queued and running jobs and waits for the runner thread
+     */
+    void stop();
+    bool isEnabled() const { return !rootPath.empty(); }
+
+    Status submit(const BatchJobSpec& spec, std::shared_ptr<BatchJob>& job);
+    Status get(const std::string& id, std::shared_ptr<BatchJob>& job) const;
+    Status cancel(const std::string& id, std::shared_ptr<BatchJob>& job);
+    std::vector<std::shared_ptr<BatchJob>> list() const;
+
+    const std::string& getRootPath() const { return rootPath; }
+
+private:
+    void runLoop();
+    void removeOldestFinishedJobs();
+
+    ModelManager& manager;
+    std::string rootPath;
+    mutable std::mutex mtx;
+    std::condition_variable queueCv;
+    std::map<uint64_t, std::shared_ptr<BatchJob>> jobs;
+    std::deque<std::shared_ptr<BatchJob>> queue;
+    uint64_t nextId = 1;
+    bool stopRequested = false;
+    std::thread runner;
+};
+
+}  // namespace ovms
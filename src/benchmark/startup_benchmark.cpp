@@ -0,0 +1,360 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Measures servables startup and reload time on generated model repository.
+// For each iteration following scenarios are executed:
+//  - cold_start - models are loaded without model cache,
+//  - cache_fill - models are loaded with empty cache_dir,
+//  - warm_start - models are loaded with cache_dir filled by previous scenario,
+//  - config_reload - config with changed nireq is reloaded on already started model manager.
+// Wall time of each scenario is reported with per phase breakdown.
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <openvino/openvino.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/manager.hpp>
+#include <openvino/pass/serialize.hpp>
+
+#include "../load_phase_profiler.hpp"
+#include "../logging.hpp"
+#include "../metric_registry.hpp"
+#include "../modelmanager.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+namespace {
+
+struct BenchmarkParameters {
+    uint32_t models;
+    uint32_t versions;
+    uint32_t pipelines;
+    uint32_t iterations;
+    uint32_t layers;
+    uint32_t size;
+    uint32_t nireq;
+    std::string repositoryPath;
+    std::string targetDevice;
+    std::string customNodeLibraryPath;
+    std::string outputCsv;
+};
+
+class BenchmarkModelManager : public ModelManager {
+    MetricRegistry registry;
+
+public:
+    // Empty cache directory disables model cache instead of falling back to the default one
+    BenchmarkModelManager(const std::string& modelCacheDirectory) :
+        ModelManager(modelCacheDirectory, &registry) {
+        if (modelCacheDirectory.empty()) {
+            disableModelCache();
+        }
+    }
+    ~BenchmarkModelManager() {
+        join();
+        models.clear();
+    }
+    Status load(const std::string& jsonFilename) {
+        return loadConfig(jsonFilename);
+    }
+};
+
+struct ScenarioResult {
+    std::string name;
+    uint32_t iteration;
+    double wallMs;
+    std::vector<LoadPhaseStatistics> phases;
+};
+
+std::shared_ptr<ov::Model> createModel(uint32_t layers, uint32_t size) {
+    auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, size});
+    input->output(0).set_names({"input"});
+    ov::Output<ov::Node> last = input;
+    for (uint32_t i = 0; i < layers; ++i) {
+        auto constant = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, size}, std::vector<float>(size, static_cast<float>(i + 1)));
+        last = std::make_shared<ov::opset8::Add>(last, constant);
+    }
+    last.set_names({"output"});
+    return std::make_shared<ov::Model>(ov::OutputVector{last}, ov::ParameterVector{input}, "startup_benchmark");
+}
+
+std::string modelName(uint32_t i) {
+    return "model_" + std::to_string(i);
+}
+
+// Marks directories generated by the benchmark, only those are removed before a run
+const char* REPOSITORY_MARKER_FILENAME = ".ovms_startup_benchmark";
+
+bool prepareRepositoryDirectory(const std::string& repositoryPath) {
+    const std::filesystem::path path(repositoryPath);
+    std::error_code ec;
+    if (std::filesystem::exists(path, ec)) {
+        if (!std::filesystem::is_directory(path, ec)) {
+            std::cerr << "repository_path: " << repositoryPath << " is not a directory" << std::endl;
+            return false;
+        }
+        if (!std::filesystem::is_empty(path, ec)) {
+            if (!std::filesystem::exists(path / REPOSITORY_MARKER_FILENAME, ec)) {
+                std::cerr << "repository_path: " << repositoryPath << " is not empty and was not generated by the benchmark, refusing to remove it" << std::endl;
+                return false;
+            }
+            std::filesystem::remove_all(path, ec);
+            if (ec) {
+                std::cerr << "Failed to remove repository_path: " << repositoryPath << "; " << ec.message() << std::endl;
+                return false;
+            }
+        }
+    }
+    std::filesystem::create_directories(path, ec);
+    std::ofstream marker(path / REPOSITORY_MARKER_FILENAME);
+    if (ec || !marker) {
+        std::cerr << "Failed to create repository_path: " << repositoryPath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void generateModels(const BenchmarkParameters& params) {
+    auto model = createModel(params.layers, params.size);
+    for (uint32_t i = 0; i < params.models; ++i) {
+        for (uint32_t version = 1; version <= params.versions; ++version) {
+            const auto versionPath = std::filesystem::path(params.repositoryPath) / modelName(i) / std::to_string(version);
+            std::filesystem::create_directories(versionPath);
+            ov::pass::Manager manager;
+            manager.register_pass<ov::pass::Serialize>((versionPath / "model.xml").string(), (versionPath / "model.bin").string());
+            manager.run_passes(model);
+        }
+    }
+}
+
+// Pipeline i chains two consecutive models with optional custom node in between
+std::string createPipelineConfig(const BenchmarkParameters& params, uint32_t i) {
+    const bool withCustomNode = !params.customNodeLibraryPath.empty();
+    const std::string first = modelName(i % params.models);
+    const std::string second = modelName((i + 1) % params.models);
+    std::stringstream ss;
+    ss << R"({"name": "pipeline_)" << i << R"(", "inputs": ["pipeline_input"], "nodes": [)";
+    ss << R"({"name": "first", "model_name": ")" << first << R"(", "type": "DL model",)"
+       << R"( "inputs": [{"input": {"node_name": "request", "data_item": "pipeline_input"}}],)"
+       << R"( "outputs": [{"data_item": "output", "alias": "first_output"}]},)";
+    std::string secondSource = "first";
+    std::string secondDataItem = "first_output";
+    if (withCustomNode) {
+        ss << R"({"name": "add_sub", "library_name": "lib_add_sub", "type": "custom",)"
+           << R"( "params": {"add_value": "1.5", "sub_value": "0.5"},)"
+           << R"( "inputs": [{"input_numbers": {"node_name": "first", "data_item": "first_output"}}],)"
+           << R"( "outputs": [{"data_item": "output_numbers", "alias": "add_sub_output"}]},)";
+        secondSource = "add_sub";
+        secondDataItem = "add_sub_output";
+    }
+    ss << R"({"name": "second", "model_name": ")" << second << R"(", "type": "DL model",)"
+       << R"( "inputs": [{"input": {"node_name": ")" << secondSource << R"(", "data_item": ")" << secondDataItem << R"("}}],)"
+       << R"( "outputs": [{"data_item": "output", "alias": "second_output"}]}],)";
+    ss << R"( "outputs": [{"pipeline_output": {"node_name": "second", "data_item": "second_output"}}]})";
+    return ss.str();
+}
+
+std::string createConfig(const BenchmarkParameters& params, uint32_t nireq) {
+    std::stringstream ss;
+    ss << "{\n";
+    if (!params.customNodeLibraryPath.empty()) {
+        ss << R"("custom_node_library_config_list": [{"name": "lib_add_sub", "base_path": ")" << params.customNodeLibraryPath << "\"}],\n";
+    }
+    ss << "\"model_config_list\": [\n";
+    for (uint32_t i = 0; i < params.models; ++i) {
+        ss << R"({"config": {"name": ")" << modelName(i)
+           << R"(", "base_path": ")" << (std::filesystem::path(params.repositoryPath) / modelName(i)).string()
+           << R"(", "target_device": ")" << params.targetDevice
+           << R"(", "model_version_policy": {"all": {}}, "nireq": )" << nireq << "}}"
+           << (i + 1 < params.models ? ",\n" : "\n");
+    }
+    ss << "]";
+    if (params.pipelines > 0) {
+        ss << ",\n\"pipeline_config_list\": [\n";
+        for (uint32_t i = 0; i < params.pipelines; ++i) {
+            ss << createPipelineConfig(params, i) << (i + 1 < params.pipelines ? ",\n" : "\n");
+        }
+        ss << "]";
+    }
+    ss << "\n}\n";
+    return ss.str();
+}
+
+void writeConfig(const std::string& path, const std::string& content) {
+    std::ofstream file(path);
+    file << content;
+}
+
+std::vector<LoadPhaseStatistics> collectPhases() {
+    std::vector<LoadPhaseStatistics> phases;
+    for (size_t i = 0; i < static_cast<size_t>(LoadPhase::PHASES_COUNT); ++i) {
+        phases.emplace_back(LoadPhaseProfiler::instance().getStatistics(static_cast<LoadPhase>(i)));
+    }
+    return phases;
+}
+
+template <typename Function>
+bool runScenario(const std::string& name, uint32_t iteration, std::vector<ScenarioResult>& results, Function scenario) {
+    LoadPhaseProfiler::instance().reset();
+    auto start = std::chrono::steady_clock::now();
+    Status status = scenario();
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (!status.ok()) {
+        std::cerr << "Scenario " << name << " failed: " << status.string() << std::endl;
+        return false;
+    }
+    results.push_back({name, iteration, wallMs, collectPhases()});
+    return true;
+}
+
+void printResults(const std::vector<ScenarioResult>& results) {
+    std::cout << std::left << std::setw(16) << "scenario" << std::setw(6) << "iter" << std::right << std::setw(12) << "wall_ms";
+    for (size_t i = 0; i < static_cast<size_t>(LoadPhase::PHASES_COUNT); ++i) {
+        std::cout << std::setw(30) << std::string(toString(static_cast<LoadPhase>(i))) + "_ms(count)";
+    }
+    std::cout << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& result : results) {
+        std::cout << std::left << std::setw(16) << result.name << std::setw(6) << result.iteration << std::right << std::setw(12) << result.wallMs;
+        for (const auto& phase : result.phases) {
+            std::stringstream cell;
+            cell << std::fixed << std::setprecision(2) << phase.totalMs << "(" << phase.count << ")";
+            std::cout << std::setw(30) << cell.str();
+        }
+        std::cout << std::endl;
+    }
+}
+
+void writeCsv(const std::string& path, const std::vector<ScenarioResult>& results) {
+    std::ofstream file(path);
+    file << "scenario,iteration,wall_ms";
+    for (size_t i = 0; i < static_cast<size_t>(LoadPhase::PHASES_COUNT); ++i) {
+        const std::string phase = toString(static_cast<LoadPhase>(i));
+        file << "," << phase << "_total_ms," << phase << "_count," << phase << "_max_ms";
+    }
+    file << "\n";
+    for (const auto& result : results) {
+        file << result.name << "," << result.iteration << "," << result.wallMs;
+        for (const auto& phase : result.phases) {
+            file << "," << phase.totalMs << "," << phase.count << "," << phase.maxMs;
+        }
+        file << "\n";
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "OpenVINO Model Server startup and reload benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help", "Show this help message and exit")
+        ("models", "Number of generated models", cxxopts::value<uint32_t>()->default_value("8"), "MODELS")
+        ("versions", "Number of versions of each model", cxxopts::value<uint32_t>()->default_value("1"), "VERSIONS")
+        ("pipelines", "Number of generated pipelines, each chaining two models", cxxopts::value<uint32_t>()->default_value("4"), "PIPELINES")
+        ("iterations", "Number of benchmark iterations", cxxopts::value<uint32_t>()->default_value("3"), "ITERATIONS")
+        ("layers", "Number of Add layers in each generated model", cxxopts::value<uint32_t>()->default_value("16"), "LAYERS")
+        ("size", "Size of input of each generated model", cxxopts::value<uint32_t>()->default_value("1024"), "SIZE")
+        ("nireq", "Number of inference requests of each model", cxxopts::value<uint32_t>()->default_value("4"), "NIREQ")
+        ("repository_path", "Directory where model repository, config and cache are generated. Existing directory has to be empty or generated by previous benchmark run", cxxopts::value<std::string>()->default_value("/tmp/ovms_startup_benchmark"), "REPOSITORY_PATH")
+        ("target_device", "Target device of generated models", cxxopts::value<std::string>()->default_value("CPU"), "TARGET_DEVICE")
+        ("custom_node_library", "Path to lib_node_add_sub.so; when set it is added between models of each pipeline", cxxopts::value<std::string>()->default_value(""), "CUSTOM_NODE_LIBRARY")
+        ("output_csv", "Path of CSV file with results", cxxopts::value<std::string>()->default_value(""), "OUTPUT_CSV")
+        ("log_level", "Server log level: TRACE, DEBUG, INFO, WARNING, ERROR", cxxopts::value<std::string>()->default_value("ERROR"), "LOG_LEVEL");
+    // clang-format on
+
+    BenchmarkParameters params;
+    try {
+        auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::cout << options.help() << std::endl;
+            return EXIT_SUCCESS;
+        }
+        params = {
+            result["models"].as<uint32_t>(),
+            result["versions"].as<uint32_t>(),
+            result["pipelines"].as<uint32_t>(),
+            result["iterations"].as<uint32_t>(),
+            result["layers"].as<uint32_t>(),
+            result["size"].as<uint32_t>(),
+            result["nireq"].as<uint32_t>(),
+            result["repository_path"].as<std::string>(),
+            result["target_device"].as<std::string>(),
+            result["custom_node_library"].as<std::string>(),
+            result["output_csv"].as<std::string>()};
+        configure_logger(result["log_level"].as<std::string>(), "");
+    } catch (const cxxopts::OptionException& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (params.models == 0 || params.versions == 0 || params.layers == 0 || params.size == 0 || params.nireq == 0) {
+        std::cerr << "models, versions, layers, size and nireq have to be greater than 0" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!prepareRepositoryDirectory(params.repositoryPath)) {
+        return EXIT_FAILURE;
+    }
+    generateModels(params);
+    const std::string configPath = (std::filesystem::path(params.repositoryPath) / "config.json").string();
+    const std::string reloadConfigPath = (std::filesystem::path(params.repositoryPath) / "config_reload.json").string();
+    const std::string cachePath = (std::filesystem::path(params.repositoryPath) / "cache").string();
+    writeConfig(configPath, createConfig(params, params.nireq));
+    writeConfig(reloadConfigPath, createConfig(params, params.nireq + 1));
+
+    std::vector<ScenarioResult> results;
+    for (uint32_t iteration = 0; iteration < params.iterations; ++iteration) {
+        // Managers are destroyed outside of measured scenarios so that unloading is not included in results
+        std::unique_ptr<BenchmarkModelManager> manager;
+        bool success = runScenario("cold_start", iteration, results, [&]() {
+            manager = std::make_unique<BenchmarkModelManager>("");
+            return manager->load(configPath);
+        });
+        manager.reset();
+        std::filesystem::remove_all(cachePath);
+        success = success && runScenario("cache_fill", iteration, results, [&]() {
+            manager = std::make_unique<BenchmarkModelManager>(cachePath);
+            return manager->load(configPath);
+        });
+        manager.reset();
+        success = success && runScenario("warm_start", iteration, results, [&]() {
+            manager = std::make_unique<BenchmarkModelManager>(cachePath);
+            return manager->load(configPath);
+        });
+        success = success && runScenario("config_reload", iteration, results, [&]() {
+            return manager->load(reloadConfigPath);
+        });
+        if (!success) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    printResults(results);
+    if (!params.outputCsv.empty()) {
+        writeCsv(params.outputCsv, results);
+    }
+    return EXIT_SUCCESS;
+}
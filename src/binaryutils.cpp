@@ -71,13 +71,85 @@ bool isPrecisionEqual(int matPrecision, ovms::Precision tensorPrecision) {
     return false;
 }
 
-cv::Mat convertStringToMat(const std::string& image) {
+bool readJpegHeader(const std::string& image, int& height, int& width, int& components) {
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(image.data());
+    const size_t size = image.size();
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return false;
+    }
+    size_t pos = 2;
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) {
+            return false;
+        }
+        unsigned char marker = data[pos + 1];
+        if (marker == 0xFF) {
+            // fill byte
+            pos++;
+            continue;
+        }
+        pos += 2;
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            // markers without segment
+            continue;
+        }
+        if (marker == 0xD9 || marker == 0xDA) {
+            // end of image or start of scan before frame header
+            return false;
+        }
+        size_t length = (data[pos] << 8) | data[pos + 1];
+        if (length < 2) {
+            return false;
+        }
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            // Scaled decoding is available for baseline, extended and progressive frames only
+            bool dctBased = marker == 0xC0 || marker == 0xC1 || marker == 0xC2 || marker == 0xC9 || marker == 0xCA;
+            if (!dctBased || length < 8 || pos + 8 > size) {
+                return false;
+            }
+            height = (data[pos + 3] << 8) | data[pos + 4];
+            width = (data[pos + 5] << 8) | data[pos + 6];
+            components = data[pos + 7];
+            return true;
+        }
+        pos += length;
+    }
+    return false;
+}
+
+int getImageDecodeFlags(const std::string& image, const Dimension& targetHeight, const Dimension& targetWidth) {
+    if (!targetHeight.isStatic() || !targetWidth.isStatic()) {
+        return cv::IMREAD_UNCHANGED;
+    }
+    int height = 0, width = 0, components = 0;
+    if (!readJpegHeader(image, height, width, components)) {
+        return cv::IMREAD_UNCHANGED;
+    }
+    // Reduced modes convert to grayscale or BGR, which is what IMREAD_UNCHANGED returns for such JPEGs
+    if (components != 1 && components != 3) {
+        return cv::IMREAD_UNCHANGED;
+    }
+    static const std::vector<std::pair<int, std::pair<int, int>>> reducedModes = {
+        {8, {cv::IMREAD_REDUCED_GRAYSCALE_8, cv::IMREAD_REDUCED_COLOR_8}},
+        {4, {cv::IMREAD_REDUCED_GRAYSCALE_4, cv::IMREAD_REDUCED_COLOR_4}},
+        {2, {cv::IMREAD_REDUCED_GRAYSCALE_2, cv::IMREAD_REDUCED_COLOR_2}}};
+    for (const auto& [factor, modes] : reducedModes) {
+        if (height / factor >= targetHeight.getStaticValue() && width / factor >= targetWidth.getStaticValue()) {
+            SPDLOG_DEBUG("Decoding JPEG image of resolution {}x{} with scale 1/{}", width, height, factor);
+            // EXIF orientation is ignored in IMREAD_UNCHANGED mode
+            return (components == 1 ? modes.first : modes.second) | cv::IMREAD_IGNORE_ORIENTATION;
+        }
+    }
+    return cv::IMREAD_UNCHANGED;
+}
+
+cv::Mat convertStringToMat(const std::string& image, int decodeFlags = cv::IMREAD_UNCHANGED) {
     OVMS_PROFILE_FUNCTION();
-    std::vector<unsigned char> data(image.begin(), image.end());
-    cv::Mat dataMat(data, true);
+    // imdecode only reads the buffer, so it is wrapped without copying
+    cv::Mat dataMat(1, static_cast<int>(image.size()), CV_8UC1, const_cast<char*>(image.data()));
 
     try {
-        return cv::imdecode(dataMat, cv::IMREAD_UNCHANGED);
+        return cv::imdecode(dataMat, decodeFlags);
     } catch (const cv::Exception& e) {
         SPDLOG_DEBUG("Error during string_val to mat conversion: {}", e.what());
         return cv::Mat{};
@@ -339,9 +411,13 @@ Status convertTensorToMatsMatchingTensorInfo(const TensorType& src, std::vector<
     // Enforce resolution alignment against first image in the batch if resize is not supported.
     bool resizeSupported = isResizeSupported(tensorInfo);
     bool enforceResolutionAlignment = !resizeSupported;
+    // Target resolution has to be known before decoding the first image to decode it downscaled
+    bool reducedDecodingAllowed = resizeSupported && targetHeight.isStatic() && targetWidth.isStatic();
 
     for (int i = 0; i < getBinaryInputsSize(src); i++) {
-        cv::Mat image = convertStringToMat(getBinaryInput(src, i));
+        const std::string& binaryInput = getBinaryInput(src, i);
+        int decodeFlags = reducedDecodingAllowed ? getImageDecodeFlags(binaryInput, targetHeight, targetWidth) : cv::IMREAD_UNCHANGED;
+        cv::Mat image = convertStringToMat(binaryInput, decodeFlags);
         if (image.data == nullptr)
             return StatusCode::IMAGE_PARSING_FAILED;
         cv::Mat* firstImage = images.size() == 0 ? nullptr : &images.at(0);
@@ -16,11 +16,25 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "status.hpp"
 #include "tensorinfo.hpp"
 
 namespace ovms {
+/**
+ * @brief Reads resolution and number of color components from the frame header of DCT based JPEG
+ * without decoding the image
+ */
+bool readJpegHeader(const std::string& image, int& height, int& width, int& components);
+
+/**
+ * @brief Selects imdecode flags. JPEG images at least twice as big as static target resolution are
+ * downscaled by libjpeg in DCT domain by 1/2, 1/4 or 1/8 while decoding, so the final resize starts
+ * from an image still not smaller than the target.
+ */
+int getImageDecodeFlags(const std::string& image, const Dimension& targetHeight, const Dimension& targetWidth);
+
 template <typename TensorType>
 Status convertBinaryRequestTensorToOVTensor(const TensorType& src, ov::Tensor& tensor, const std::shared_ptr<TensorInfo>& tensorInfo);
 }  // namespace ovms
@@ -0,0 +1,91 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "color_format_configuration.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "stringutils.hpp"
+
+namespace ovms {
+
+namespace {
+const std::unordered_map<std::string, SourceColorFormat> SOURCE_COLOR_FORMATS{
+    {"NV12", SourceColorFormat::NV12},
+    {"NV12_TWO_PLANES", SourceColorFormat::NV12_TWO_PLANES},
+    {"I420", SourceColorFormat::I420},
+    {"I420_THREE_PLANES", SourceColorFormat::I420_THREE_PLANES}};
+
+const std::unordered_map<std::string, TargetColorFormat> TARGET_COLOR_FORMATS{
+    {"BGR", TargetColorFormat::BGR},
+    {"RGB", TargetColorFormat::RGB}};
+}  // namespace
+
+std::vector<std::string> ColorFormatConfiguration::getPlaneNames() const {
+    switch (source) {
+    case SourceColorFormat::NV12_TWO_PLANES:
+        return {"y", "uv"};
+    case SourceColorFormat::I420_THREE_PLANES:
+        return {"y", "u", "v"};
+    default:
+        return {};
+    }
+}
+
+Status ColorFormatConfiguration::fromString(const std::string& configurationStr, ColorFormatConfiguration& configOut) {
+    std::string configurationCopy = configurationStr;
+    erase_spaces(configurationCopy);
+    std::transform(configurationCopy.begin(), configurationCopy.end(), configurationCopy.begin(), ::toupper);
+
+    std::vector<std::string> tokens = tokenize(configurationCopy, COLOR_FORMAT_CONFIGURATION_DELIMETER);
+    size_t delimCount = std::count(configurationCopy.begin(), configurationCopy.end(), COLOR_FORMAT_CONFIGURATION_DELIMETER);
+    if (tokens.empty() || tokens.size() > 2 || delimCount != tokens.size() - 1)
+        return StatusCode::COLOR_FORMAT_WRONG_FORMAT;
+
+    auto source = SOURCE_COLOR_FORMATS.find(tokens[0]);
+    if (source == SOURCE_COLOR_FORMATS.end())
+        return StatusCode::COLOR_FORMAT_WRONG_FORMAT;
+    TargetColorFormat target = TargetColorFormat::BGR;
+    if (tokens.size() == 2) {
+        auto it = TARGET_COLOR_FORMATS.find(tokens[1]);
+        if (it == TARGET_COLOR_FORMATS.end())
+            return StatusCode::COLOR_FORMAT_WRONG_FORMAT;
+        target = it->second;
+    }
+    configOut = ColorFormatConfiguration(source->second, target);
+    return StatusCode::OK;
+}
+
+std::string ColorFormatConfiguration::toString() const {
+    std::stringstream ss;
+    for (const auto& [name, format] : SOURCE_COLOR_FORMATS) {
+        if (format == source) {
+            ss << name;
+        }
+    }
+    ss << COLOR_FORMAT_CONFIGURATION_DELIMETER << (target == TargetColorFormat::BGR ? "BGR" : "RGB");
+    return ss.str();
+}
+
+bool ColorFormatConfiguration::operator==(const ColorFormatConfiguration& rhs) const {
+    return this->source == rhs.source && this->target == rhs.target;
+}
+
+bool ColorFormatConfiguration::operator!=(const ColorFormatConfiguration& rhs) const {
+    return !(this->operator==(rhs));
+}
+
+}  // namespace ovms
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "status.hpp"
+
+namespace ovms {
+
+static const char COLOR_FORMAT_CONFIGURATION_DELIMETER = ':';
+
+enum class SourceColorFormat {
+    NV12,
+    NV12_TWO_PLANES,
+    I420,
+    I420_THREE_PLANES
+};
+
+enum class TargetColorFormat {
+    BGR,
+    RGB
+};
+
+/**
+ * @brief Color format of raw frames accepted by model input, in form SOURCE[:TARGET], e.g. NV12 or NV12_TWO_PLANES:RGB.
+ * Frames are converted to target color format (BGR by default) and resized to model resolution inside compiled model.
+ */
+class ColorFormatConfiguration {
+    SourceColorFormat source = SourceColorFormat::NV12;
+    TargetColorFormat target = TargetColorFormat::BGR;
+
+public:
+    ColorFormatConfiguration() = default;
+    ColorFormatConfiguration(SourceColorFormat source, TargetColorFormat target = TargetColorFormat::BGR) :
+        source(source),
+        target(target) {}
+
+    SourceColorFormat getSource() const { return source; }
+    TargetColorFormat getTarget() const { return target; }
+
+    /**
+     * @brief Suffixes of inputs created for separate planes, empty when frame is sent as single tensor
+     */
+    std::vector<std::string> getPlaneNames() const;
+
+    bool operator==(const ColorFormatConfiguration& rhs) const;
+    bool operator!=(const ColorFormatConfiguration& rhs) const;
+
+    static Status fromString(const std::string& configurationStr, ColorFormatConfiguration& configOut);
+    std::string toString() const;
+};
+
+using color_format_configurations_map_t = std::unordered_map<std::string, ColorFormatConfiguration>;
+
+}  // namespace ovms
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "condition_node.hpp"
+
+#include <utility>
+
+#include "conditionnodesession.hpp"
+#include "logging.hpp"
+#include "profiler.hpp"
+
+namespace ovms {
+
+ConditionNode::ConditionNode(
+    const std::string& nodeName,
+    const NodeCondition& condition,
+    const std::unordered_map<std::string, std::string>& nodeOutputNameAlias) :
+    Node(nodeName),
+    condition(condition),
+    nodeOutputNameAlias(nodeOutputNameAlias) {
+}
+
+Status ConditionNode::execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
+    OVMS_PROFILE_FUNCTION();
+    auto& conditionNodeSession = static_cast<ConditionNodeSession&>(getNodeSession(sessionKey));
+    const auto& inputs = conditionNodeSession.getInputTensors();
+    auto it = inputs.find(condition.inputName);
+    if (it == inputs.end()) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} is missing condition input: {}", getName(), sessionKey, condition.inputName);
+        return StatusCode::PIPELINE_CONDITION_INPUT_MISSING;
+    }
+    bool result = false;
+    auto status = condition.evaluate(it->second, result);
+    if (!status.ok()) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} failed to evaluate condition: {}; {}", getName(), sessionKey, condition.toString(), status.string());
+        return status;
+    }
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} condition: {} evaluated to: {}", getName(), sessionKey, condition.toString(), result);
+    if (!result) {
+        conditionNodeSession.markSkipped();
+        conditionNodeSession.clearInputs();
+    }
+    notifyEndQueue.push(NodeSessionKeyPair(*this, sessionKey));
+    return StatusCode::OK;
+}
+
+Status ConditionNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) {
+    auto& conditionNodeSession = static_cast<ConditionNodeSession&>(nodeSession);
+    const auto& sessionMetadata = nodeSession.getNodeSessionMetadata();
+    auto it = nodeSessionOutputs.emplace(sessionMetadata.getSessionKey(), SessionResult{sessionMetadata, {}});
+    if (!it.second) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to put node: {} session: {} results in node session outputs",
+            getName(), nodeSession.getSessionKey());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    auto& outputs = it.first->second.second;
+    for (const auto& node : this->next) {
+        for (const auto& [outputName, dependantInputName] : node.get().getMappingByDependency(*this)) {
+            if (outputs.find(outputName) != outputs.end()) {
+                continue;
+            }
+            const auto& realOutputName = this->getRealOutputName(outputName);
+            // Source tensor is passed on as well, since it keeps data of the input alive after inputs are cleared
+            auto input = conditionNodeSession.getInputWithSource(realOutputName);
+            if (!input) {
+                SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} is missing input: {} to pass through",
+                    getName(), nodeSession.getSessionKey(), realOutputName);
+                return StatusCode::PIPELINE_CONDITION_OUTPUT_NOT_INPUT;
+            }
+            outputs.emplace(outputName, std::move(*input));
+        }
+    }
+    conditionNodeSession.clearInputs();
+    return StatusCode::OK;
+}
+
+std::unique_ptr<NodeSession> ConditionNode::createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails) {
+    return std::make_unique<ConditionNodeSession>(metadata, getName(), previous.size(), collapsingDetails);
+}
+
+}  // namespace ovms
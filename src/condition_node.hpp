@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "node.hpp"
+#include "nodecondition.hpp"
+#include "pipelineeventqueue.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Passes its inputs through to dependant nodes when condition evaluated
+ * on one of the inputs is met. Otherwise results are marked as skipped and
+ * all nodes depending on them are not executed.
+ */
+class ConditionNode : public Node {
+    NodeCondition condition;
+    std::unordered_map<std::string, std::string> nodeOutputNameAlias;
+
+public:
+    ConditionNode(
+        const std::string& nodeName,
+        const NodeCondition& condition,
+        const std::unordered_map<std::string, std::string>& nodeOutputNameAlias = {});
+
+    Status execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) override;
+
+    Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override;
+
+    const std::string& getRealOutputName(const std::string& alias) const {
+        auto it = nodeOutputNameAlias.find(alias);
+        return it != nodeOutputNameAlias.end() ? it->second : alias;
+    }
+
+    std::unique_ptr<NodeSession> createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails) override;
+};
+
+}  // namespace ovms
@@ -0,0 +1,39 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "conditionnodesession.hpp"
+
+#include "nodeinputhandler.hpp"
+
+namespace ovms {
+
+ConditionNodeSession::ConditionNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails) :
+    NodeSession(metadata, nodeName, inputsCount, collapsingDetails) {}
+
+ConditionNodeSession::~ConditionNodeSession() = default;
+
+const TensorMap& ConditionNodeSession::getInputTensors() const {
+    return this->inputHandler->getInputs();
+}
+
+std::optional<TensorWithSource> ConditionNodeSession::getInputWithSource(const std::string& inputName) const {
+    return this->inputHandler->getInputWithSource(inputName);
+}
+
+void ConditionNodeSession::clearInputs() {
+    this->inputHandler->clearInputs();
+}
+
+}  // namespace ovms
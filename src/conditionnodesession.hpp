@@ -0,0 +1,36 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "nodesession.hpp"
+#include "nodesessionmetadata.hpp"
+#include "tensormap.hpp"
+
+namespace ovms {
+
+class ConditionNodeSession : public NodeSession {
+public:
+    ConditionNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails);
+    virtual ~ConditionNodeSession();
+    const TensorMap& getInputTensors() const;
+    std::optional<TensorWithSource> getInputWithSource(const std::string& inputName) const;
+    void clearInputs();
+};
+
+}  // namespace ovms
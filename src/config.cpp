@@ -24,6 +24,7 @@
 #include <boost/algorithm/string.hpp>
 #include <sysexits.h>
 
+#include "cpu_topology.hpp"
 #include "logging.hpp"
 #include "version.hpp"
 
@@ -70,6 +71,14 @@ Config& Config::parse(int argc, char** argv) {
                 "Number of worker threads in REST server - has no effect if rest_port is not set. Default value depends on number of CPUs. ",
                 cxxopts::value<uint>()->default_value(DEFAULT_REST_WORKERS_STRING.c_str()),
                 "REST_WORKERS")
+            ("rest_async_inference",
+                "Flag enabling asynchronous completion of REST predict and KServe infer requests to single models. Worker thread is released while inference runs. Default false.",
+                cxxopts::value<bool>()->default_value("false"),
+                "REST_ASYNC_INFERENCE")
+            ("worker_processes",
+                "Number of server processes accepting requests on the same ports. Each process loads models on its own. Default 1 - single process. Values above 1 enable prefork mode with supervisor process restarting failed workers.",
+                cxxopts::value<uint32_t>()->default_value("1"),
+                "WORKER_PROCESSES")
             ("log_level",
                 "serving log level - one of TRACE, DEBUG, INFO, WARNING, ERROR",
                 cxxopts::value<std::string>()->default_value("INFO"), "LOG_LEVEL")
@@ -84,6 +93,10 @@ Config& Config::parse(int argc, char** argv) {
             ("grpc_channel_arguments",
                 "A comma separated list of arguments to be passed to the grpc server. (e.g. grpc.max_connection_age_ms=2000)",
                 cxxopts::value<std::string>(), "GRPC_CHANNEL_ARGUMENTS")
+            ("grpc_streamed_upload_max_bytes",
+                "Maximal total size in bytes of inputs uploaded in chunks with ModelStreamUpload gRPC call. Default: 17179869184 (16GB).",
+                cxxopts::value<uint64_t>()->default_value("17179869184"),
+                "GRPC_STREAMED_UPLOAD_MAX_BYTES")
             ("file_system_poll_wait_seconds",
                 "Time interval between config and model versions changes detection. Default is 1. Zero or negative value disables changes monitoring.",
                 cxxopts::value<uint>()->default_value("1"),
@@ -103,7 +116,47 @@ Config& Config::parse(int argc, char** argv) {
             ("cpu_extension",
                 "A path to shared library containing custom CPU layer implementation. Default: empty.",
                 cxxopts::value<std::string>()->default_value(""),
-                "CPU_EXTENSION");
+                "CPU_EXTENSION")
+            ("frontend_cpu_cores",
+                "List of CPU cores reserved for gRPC and REST threads, in cpuset format eg. 0-3,8. Default: empty - threads are not pinned.",
+                cxxopts::value<std::string>(),
+                "FRONTEND_CPU_CORES")
+            ("inference_cpu_cores",
+                "List of CPU cores reserved for OpenVINO CPU plugin streams, in cpuset format eg. 4-7,9. Default: empty - streams are not pinned.",
+                cxxopts::value<std::string>(),
+                "INFERENCE_CPU_CORES")
+            ("deserialization_threads",
+                "Number of threads deserializing large inputs of a single request in parallel. Default: 4. 0 - inputs are deserialized on the request thread.",
+                cxxopts::value<uint32_t>()->default_value("4"),
+                "DESERIALIZATION_THREADS")
+            ("deserialization_parallel_threshold",
+                "Minimal size in bytes of input data requiring conversion or decoding, for the input to be deserialized on a separate thread. Parallel deserialization is used for requests with at least two such inputs. Default: 1048576.",
+                cxxopts::value<uint64_t>()->default_value("1048576"),
+                "DESERIALIZATION_PARALLEL_THRESHOLD")
+            ("tenant_header",
+                "Name of gRPC metadata key or HTTP header identifying the tenant of inference request. When set, rate limits and concurrency quotas are applied per tenant. Default: empty - tenant isolation disabled.",
+                cxxopts::value<std::string>(),
+                "TENANT_HEADER")
+            ("tenant_rate_limit",
+                "Number of inference requests per second allowed for each tenant of a model or a DAG. Default: 0 - unlimited.",
+                cxxopts::value<double>()->default_value("0"),
+                "TENANT_RATE_LIMIT")
+            ("tenant_burst",
+                "Number of inference requests each tenant can send at once above tenant_rate_limit. Default: 0 - equal to tenant_rate_limit.",
+                cxxopts::value<double>()->default_value("0"),
+                "TENANT_BURST")
+            ("tenant_max_concurrency",
+                "Number of inference requests of each tenant processed in parallel by a model or a DAG. Default: 0 - unlimited.",
+                cxxopts::value<uint32_t>()->default_value("0"),
+                "TENANT_MAX_CONCURRENCY")
+            ("tenant_max_tracked",
+                "Number of tenants of a model or a DAG with separate quota and metrics. Above it idle tenants are evicted, and when none is idle, new tenants share quota of tenant named other. Default: 1000.",
+                cxxopts::value<uint32_t>()->default_value("1000"),
+                "TENANT_MAX_TRACKED")
+            ("batch_job_path",
+                "Local directory with datasets processed by offline batch jobs submitted via REST API. Job input and output paths are relative to this directory. Default: empty - batch jobs disabled.",
+                cxxopts::value<std::string>(),
+                "BATCH_JOB_PATH");
         options->add_options("multi model")
             ("config_path",
                 "Absolute path to json configuration file",
@@ -130,6 +183,10 @@ Config& Config::parse(int argc, char** argv) {
                 "Resets model layout.",
                 cxxopts::value<std::string>(),
                 "LAYOUT")
+            ("color_format",
+                "Color format of raw frame inputs converted inside the model, in json format, e.g. {\"image\":\"NV12\"}.",
+                cxxopts::value<std::string>(),
+                "COLOR_FORMAT")
             ("model_version_policy",
                 "Model version policy",
                 cxxopts::value<std::string>(),
@@ -155,7 +212,7 @@ Config& Config::parse(int argc, char** argv) {
                 cxxopts::value<bool>()->default_value("false"),
                 "METRICS")
             ("metrics_list",
-                "Comma separated list of metrics. If unset, only default metrics will be enabled. Default metrics: ovms_requests_success, ovms_requests_fail, ovms_request_time_us, ovms_streams, ovms_inference_time_us, ovms_wait_for_infer_req_time_us. When set, only the listed metrics will be enabled. Optional metrics: ovms_infer_req_queue_size, ovms_infer_req_active.",
+                "Comma separated list of metrics. If unset, only default metrics will be enabled. Default metrics: ovms_requests_success, ovms_requests_fail, ovms_request_time_us, ovms_streams, ovms_inference_time_us, ovms_wait_for_infer_req_time_us. When set, only the listed metrics will be enabled. Optional metrics: ovms_infer_req_queue_size, ovms_infer_req_active, ovms_infer_req_waiting, ovms_infer_req_busy_time_us, ovms_inference_batch_size, ovms_dag_executor_threads, ovms_dag_deferred_node_sessions, ovms_hw_events, ovms_memory_bytes, ovms_allocations, ovms_allocated_bytes, ovms_tenant_requests_admitted, ovms_tenant_requests_rejected, ovms_tenant_current_requests.",
                 cxxopts::value<std::string>()->default_value(""),
                 "METRICS_LIST")
             ("idle_sequence_cleanup",
@@ -233,11 +290,26 @@ void Config::validate() {
 
     if (result->count("config_path") && (result->count("batch_size") || result->count("shape") ||
                                             result->count("nireq") || result->count("model_version_policy") || result->count("target_device") ||
-                                            result->count("plugin_config"))) {
+                                            result->count("plugin_config") || result->count("color_format"))) {
         std::cerr << "Model parameters in CLI are exclusive with the config file" << std::endl;
         exit(EX_USAGE);
     }
 
+    if (result->count("batch_job_path") && this->restPort() == 0) {
+        std::cerr << "batch_job_path is set but rest_port is not set. Batch jobs are submitted via REST API" << std::endl;
+        exit(EX_USAGE);
+    }
+
+    if (result->count("worker_processes") && ((this->workerProcesses() > AVAILABLE_CORES) || (this->workerProcesses() < 1))) {
+        std::cerr << "worker_processes count should be from 1 to CPU core count : " << AVAILABLE_CORES << std::endl;
+        exit(EX_USAGE);
+    }
+
+    if (result->count("batch_job_path") && this->workerProcesses() > 1) {
+        std::cerr << "batch_job_path cannot be used with worker_processes greater than 1. Batch job state is not shared between processes" << std::endl;
+        exit(EX_USAGE);
+    }
+
     // check grpc_workers value
     if (result->count("grpc_workers") && ((this->grpcWorkers() > AVAILABLE_CORES) || (this->grpcWorkers() < 1))) {
         std::cerr << "grpc_workers count should be from 1 to CPU core count : " << AVAILABLE_CORES << std::endl;
@@ -309,6 +381,35 @@ void Config::validate() {
         exit(EX_USAGE);
     }
 
+    // check core lists
+    cpu_list_t cores;
+    if (result->count("frontend_cpu_cores") && (!CpuTopology::parseCpuList(this->frontendCpuCores(), cores).ok() || cores.empty())) {
+        std::cerr << "frontend_cpu_cores has invalid format: comma separated list of core ids or ranges expected eg. 0-3,8" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("inference_cpu_cores") && (!CpuTopology::parseCpuList(this->inferenceCpuCores(), cores).ok() || cores.empty())) {
+        std::cerr << "inference_cpu_cores has invalid format: comma separated list of core ids or ranges expected eg. 4-7,9" << std::endl;
+        exit(EX_USAGE);
+    }
+
+    // check tenant quotas
+    if (result->count("tenant_rate_limit") && this->tenantRateLimit() < 0) {
+        std::cerr << "tenant_rate_limit must not be negative" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("tenant_burst") && this->tenantBurst() < 0) {
+        std::cerr << "tenant_burst must not be negative" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("tenant_max_tracked") && this->tenantMaxTracked() == 0) {
+        std::cerr << "tenant_max_tracked must be greater than 0" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("tenant_header") && this->tenantHeader().empty()) {
+        std::cerr << "tenant_header must not be empty" << std::endl;
+        exit(EX_USAGE);
+    }
+
     // check log_level values
     if (result->count("log_level")) {
         std::vector v({"TRACE", "DEBUG", "INFO", "WARNING", "ERROR"});
@@ -107,6 +107,102 @@ public:
         return result->operator[]("port").as<uint64_t>();
     }
 
+    /**
+         * @brief Get the name of header identifying tenant of inference request
+         *
+         * @return const std::string
+         */
+    const std::string tenantHeader() const {
+        if (result != nullptr && result->count("tenant_header")) {
+            return result->operator[]("tenant_header").as<std::string>();
+        }
+        return "";
+    }
+
+    /**
+         * @brief Get the directory with datasets of offline batch jobs
+         *
+         * @return const std::string
+         */
+    const std::string batchJobPath() const {
+        if (result != nullptr && result->count("batch_job_path")) {
+            return result->operator[]("batch_job_path").as<std::string>();
+        }
+        return "";
+    }
+
+    /**
+         * @brief Get the number of requests per second allowed for each tenant
+         *
+         * @return double
+         */
+    double tenantRateLimit() const {
+        if (result != nullptr && result->count("tenant_rate_limit")) {
+            return result->operator[]("tenant_rate_limit").as<double>();
+        }
+        return 0;
+    }
+
+    /**
+         * @brief Get the token bucket capacity of each tenant
+         *
+         * @return double
+         */
+    double tenantBurst() const {
+        if (result != nullptr && result->count("tenant_burst")) {
+            return result->operator[]("tenant_burst").as<double>();
+        }
+        return 0;
+    }
+
+    /**
+         * @brief Get the number of requests of each tenant processed in parallel
+         *
+         * @return uint32_t
+         */
+    uint32_t tenantMaxConcurrency() const {
+        if (result != nullptr && result->count("tenant_max_concurrency")) {
+            return result->operator[]("tenant_max_concurrency").as<uint32_t>();
+        }
+        return 0;
+    }
+
+    /**
+         * @brief Get the number of tenants of each servable tracked separately
+         *
+         * @return uint32_t
+         */
+    uint32_t tenantMaxTracked() const {
+        if (result != nullptr && result->count("tenant_max_tracked")) {
+            return result->operator[]("tenant_max_tracked").as<uint32_t>();
+        }
+        return 1000;
+    }
+
+    /**
+         * @brief Get the number of threads deserializing large inputs in parallel
+         *
+         * @return uint32_t
+         */
+    uint32_t deserializationThreads() const {
+        if (result != nullptr && result->count("deserialization_threads")) {
+            return result->operator[]("deserialization_threads").as<uint32_t>();
+        }
+        return 4;
+    }
+
+    /**
+         * @brief Get the minimal input size in bytes deserialized on a separate thread
+         *
+         * @return uint64_t
+         */
+    uint64_t deserializationParallelThreshold() const {
+        if (result != nullptr && result->count("deserialization_parallel_threshold")) {
+            return result->operator[]("deserialization_parallel_threshold").as<uint64_t>();
+        }
+        return 1048576;
+    }
+
     /**
          * @brief Get the gRPC network interface address to bind to
          * 
@@ -119,6 +215,30 @@ public:
         return "";
     }
 
+    /**
+         * @brief Get the list of cores reserved for gRPC & REST threads
+         *
+         * @return const std::string
+         */
+    const std::string frontendCpuCores() const {
+        if (result != nullptr && result->count("frontend_cpu_cores")) {
+            return result->operator[]("frontend_cpu_cores").as<std::string>();
+        }
+        return "";
+    }
+
+    /**
+         * @brief Get the list of cores reserved for OpenVINO CPU streams
+         *
+         * @return const std::string
+         */
+    const std::string inferenceCpuCores() const {
+        if (result != nullptr && result->count("inference_cpu_cores")) {
+            return result->operator[]("inference_cpu_cores").as<std::string>();
+        }
+        return "";
+    }
+
     /**
          * @brief Get the gRPC network interface address to bind to
          * 
@@ -158,6 +278,15 @@ public:
         return result->operator[]("grpc_workers").as<uint>();
     }
 
+    /**
+         * @brief Gets the number of server processes, values above 1 enable prefork mode
+         * 
+         * @return uint32_t
+         */
+    uint32_t workerProcesses() const {
+        return result->operator[]("worker_processes").as<uint32_t>();
+    }
+
     /**
          * @brief Gets the rest workers count
          * 
@@ -167,6 +296,18 @@ public:
         return result->operator[]("rest_workers").as<uint>();
     }
 
+    /**
+         * @brief Get asynchronous REST inference flag
+         *
+         * @return bool
+         */
+    bool restAsyncInference() const {
+        if (!result->count("rest_async_inference")) {
+            return false;
+        }
+        return result->operator[]("rest_async_inference").as<bool>();
+    }
+
     /**
          * @brief Get the model name
          * 
@@ -224,6 +365,17 @@ public:
         return empty;
     }
 
+    /**
+         * @brief Get the color format of raw frame inputs
+         * 
+         * @return const std::string&
+         */
+    const std::string& colorFormat() const {
+        if (result->count("color_format"))
+            return result->operator[]("color_format").as<std::string>();
+        return empty;
+    }
+
     /**
          * @brief Get the shape
          * 
@@ -376,6 +528,18 @@ public:
         return empty;
     }
 
+    /**
+        * @brief Get the limit of inputs size uploaded in chunks over gRPC
+        *
+        * @return uint64_t
+        */
+    uint64_t grpcStreamedUploadMaxBytes() const {
+        if (result != nullptr && result->count("grpc_streamed_upload_max_bytes")) {
+            return result->operator[]("grpc_streamed_upload_max_bytes").as<uint64_t>();
+        }
+        return 17179869184;
+    }
+
     /**
      * @brief Get the filesystem poll wait time in seconds
      * 
@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "cpu_topology.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <set>
+#include <sstream>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "logging.hpp"
+#include "stringutils.hpp"
+
+namespace ovms {
+
+static std::optional<uint32_t> parseCoreId(const std::string& str) {
+    if (str.empty() || !std::all_of(str.begin(), str.end(), ::isdigit)) {
+        return std::nullopt;
+    }
+    return stou32(str);
+}
+
+Status CpuTopology::parseCpuList(const std::string& str, cpu_list_t& cores) {
+    std::string input = str;
+    erase_spaces(input);
+    cores.clear();
+    if (input.empty()) {
+        return StatusCode::OK;
+    }
+    std::set<uint32_t> uniqueCores;
+    for (const auto& token : tokenize(input, ',')) {
+        auto range = tokenize(token, '-');
+        if (range.size() == 1 && token.find('-') == std::string::npos) {
+            auto core = parseCoreId(range[0]);
+            if (!core.has_value() || core.value() >= CPU_SETSIZE) {
+                return Status(StatusCode::CPU_LIST_WRONG_FORMAT, token);
+            }
+            uniqueCores.insert(core.value());
+        } else if (range.size() == 2) {
+            auto first = parseCoreId(range[0]);
+            auto last = parseCoreId(range[1]);
+            if (!first.has_value() || !last.has_value() || first.value() > last.value() || last.value() >= CPU_SETSIZE) {
+                return Status(StatusCode::CPU_LIST_WRONG_FORMAT, token);
+            }
+            for (uint32_t core = first.value(); core <= last.value(); ++core) {
+                uniqueCores.insert(core);
+            }
+        } else {
+            return Status(StatusCode::CPU_LIST_WRONG_FORMAT, token);
+        }
+    }
+    std::copy(uniqueCores.begin(), uniqueCores.end(), std::back_inserter(cores));
+    return StatusCode::OK;
+}
+
+std::string CpuTopology::toString(const cpu_list_t& cores) {
+    std::stringstream ss;
+    size_t i = 0;
+    while (i < cores.size()) {
+        size_t j = i;
+        while (j + 1 < cores.size() && cores[j + 1] == cores[j] + 1) {
+            ++j;
+        }
+        if (i > 0) {
+            ss << ",";
+        }
+        ss << cores[i];
+        if (j > i) {
+            ss << "-" << cores[j];
+        }
+        i = j + 1;
+    }
+    return ss.str();
+}
+
+Status CpuTopology::configure(const std::string& frontendCoresStr, const std::string& inferenceCoresStr) {
+    cpu_list_t frontend, inference;
+    auto status = parseCpuList(frontendCoresStr, frontend);
+    if (!status.ok()) {
+        return status;
+    }
+    status = parseCpuList(inferenceCoresStr, inference);
+    if (!status.ok()) {
+        return status;
+    }
+    cpu_list_t allowed;
+    status = getCurrentThreadAffinity(allowed);
+    if (status.ok()) {
+        for (const cpu_list_t* cores : {&frontend, &inference}) {
+            for (auto core : *cores) {
+                if (!std::binary_search(allowed.begin(), allowed.end(), core)) {
+                    return Status(StatusCode::CPU_LIST_WRONG_FORMAT, "core " + std::to_string(core) + " is not available for the process");
+                }
+            }
+        }
+    }
+    cpu_list_t shared;
+    std::set_intersection(frontend.begin(), frontend.end(), inference.begin(), inference.end(), std::back_inserter(shared));
+    if (!shared.empty()) {
+        SPDLOG_WARN("Frontend and inference core sets overlap on cores: {}", toString(shared));
+    }
+    this->frontendCores = std::move(frontend);
+    this->inferenceCores = std::move(inference);
+    return StatusCode::OK;
+}
+
+Status CpuTopology::getCurrentThreadAffinity(cpu_list_t& cores) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0) {
+        return StatusCode::CPU_AFFINITY_SETTING_FAILED;
+    }
+    cores.clear();
+    for (uint32_t core = 0; core < CPU_SETSIZE; ++core) {
+        if (CPU_ISSET(core, &cpuSet)) {
+            cores.push_back(core);
+        }
+    }
+    return StatusCode::OK;
+}
+
+Status CpuTopology::setCurrentThreadAffinity(const cpu_list_t& cores) {
+    if (cores.empty()) {
+        return StatusCode::OK;
+    }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto core : cores) {
+        CPU_SET(core, &cpuSet);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+    if (ret != 0) {
+        SPDLOG_WARN("Failed to set thread affinity to cores: {}; error code: {}", toString(cores), ret);
+        return StatusCode::CPU_AFFINITY_SETTING_FAILED;
+    }
+    return StatusCode::OK;
+}
+
+ThreadAffinityGuard::ThreadAffinityGuard(const cpu_list_t& cores) {
+    if (cores.empty()) {
+        return;
+    }
+    if (!CpuTopology::getCurrentThreadAffinity(previousCores).ok()) {
+        return;
+    }
+    restoreRequired = CpuTopology::setCurrentThreadAffinity(cores).ok();
+}
+
+ThreadAffinityGuard::~ThreadAffinityGuard() {
+    if (restoreRequired) {
+        CpuTopology::setCurrentThreadAffinity(previousCores);
+    }
+}
+
+}  // namespace ovms
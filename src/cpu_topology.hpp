@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "status.hpp"
+
+namespace ovms {
+
+using cpu_list_t = std::vector<uint32_t>;
+
+/**
+ * @brief Holds the split of CPU cores between frontend work (gRPC/REST threads,
+ * serialization, DAG scheduling) and OpenVINO inference streams.
+ *
+ * Empty core list means that given part of the server is not pinned.
+ */
+class CpuTopology {
+    cpu_list_t frontendCores;
+    cpu_list_t inferenceCores;
+
+    CpuTopology() = default;
+
+public:
+    static CpuTopology& instance() {
+        static CpuTopology instance;
+        return instance;
+    }
+
+    /**
+     * @brief Parses and stores core lists in the same format as Linux cpuset (eg. "0-3,8,10-11")
+     */
+    Status configure(const std::string& frontendCoresStr, const std::string& inferenceCoresStr);
+
+    const cpu_list_t& getFrontendCores() const { return frontendCores; }
+    const cpu_list_t& getInferenceCores() const { return inferenceCores; }
+
+    bool isPartitioned() const { return !frontendCores.empty() || !inferenceCores.empty(); }
+
+    static Status parseCpuList(const std::string& str, cpu_list_t& cores);
+    static std::string toString(const cpu_list_t& cores);
+
+    static Status getCurrentThreadAffinity(cpu_list_t& cores);
+    static Status setCurrentThreadAffinity(const cpu_list_t& cores);
+};
+
+/**
+ * @brief Pins calling thread to given cores for the guard lifetime. Threads spawned
+ * meanwhile inherit the affinity, which is how gRPC & REST thread pools get pinned.
+ * Empty core list leaves affinity untouched.
+ */
+class ThreadAffinityGuard {
+    cpu_list_t previousCores;
+    bool restoreRequired = false;
+
+public:
+    ThreadAffinityGuard(const cpu_list_t& cores);
+    ~ThreadAffinityGuard();
+};
+
+}  // namespace ovms
@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 
 #include "filesystem.hpp"
+#include "load_phase_profiler.hpp"
 #include "logging.hpp"
 #include "status.hpp"
 
@@ -38,6 +39,7 @@ Status CustomNodeLibraryManager::loadLibrary(const std::string& name, const std:
     }
 
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Loading custom node library name: {}; base_path: {}", name, basePath);
+    ScopedLoadPhaseTimer phaseTimer(LoadPhase::CUSTOM_NODE_LIBRARY_LOADING);
 
     void* handle = dlopen(basePath.c_str(), RTLD_LAZY | RTLD_LOCAL);
     char* error = dlerror();
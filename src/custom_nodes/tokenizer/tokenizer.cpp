@@ -0,0 +1,205 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "../../custom_node_interface.h"
+#include "../common/utils.hpp"
+#include "wordpiece_tokenizer.hpp"
+
+using ovms::custom_nodes_tokenizer::token_id_t;
+using ovms::custom_nodes_tokenizer::WordpieceTokenizer;
+
+static constexpr const char* TEXT_TENSOR_NAME = "text";
+static constexpr const char* TEXT_PAIR_TENSOR_NAME = "text_pair";
+static constexpr const char* INPUT_IDS_TENSOR_NAME = "input_ids";
+static constexpr const char* ATTENTION_MASK_TENSOR_NAME = "attention_mask";
+static constexpr const char* TOKEN_TYPE_IDS_TENSOR_NAME = "token_type_ids";
+
+struct TokenizerInternalManager {
+    std::shared_timed_mutex mtx;
+    WordpieceTokenizer tokenizer;
+};
+
+static int loadTokenizer(WordpieceTokenizer& tokenizer, const std::string& vocabPath, const struct CustomNodeParam* params, int paramsCount) {
+    std::string error;
+    NODE_ASSERT(tokenizer.loadVocabulary(vocabPath, error), error);
+    NODE_ASSERT(tokenizer.setSpecialTokens(
+                    get_string_parameter("unk_token", params, paramsCount, "[UNK]"),
+                    get_string_parameter("cls_token", params, paramsCount, "[CLS]"),
+                    get_string_parameter("sep_token", params, paramsCount, "[SEP]"),
+                    error),
+        error);
+    tokenizer.setLowerCase(get_string_parameter("do_lower_case", params, paramsCount, "true") == "true");
+    int maxCharsPerWord = get_int_parameter("max_chars_per_word", params, paramsCount, 100);
+    NODE_ASSERT(maxCharsPerWord > 0, "max_chars_per_word should be greater than 0");
+    tokenizer.setMaxCharsPerWord(maxCharsPerWord);
+    return 0;
+}
+
+int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeParam* params, int paramsCount) {
+    std::string vocabPath = get_string_parameter("vocab_path", params, paramsCount);
+    NODE_ASSERT(!vocabPath.empty(), "vocab_path parameter is required");
+    auto tokenizer = std::make_unique<WordpieceTokenizer>();
+    NODE_ASSERT(loadTokenizer(*tokenizer, vocabPath, params, paramsCount) == 0, "tokenizer initialization failed");
+    if (*customNodeLibraryInternalManager == nullptr) {
+        auto internalManager = std::make_unique<TokenizerInternalManager>();
+        internalManager->tokenizer = std::move(*tokenizer);
+        *customNodeLibraryInternalManager = internalManager.release();
+        return 0;
+    }
+    // Configuration reload, vocabulary is replaced when no execution is in progress
+    auto internalManager = static_cast<TokenizerInternalManager*>(*customNodeLibraryInternalManager);
+    std::unique_lock<std::shared_timed_mutex> lock(internalManager->mtx);
+    internalManager->tokenizer = std::move(*tokenizer);
+    return 0;
+}
+
+int deinitialize(void* customNodeLibraryInternalManager) {
+    delete static_cast<TokenizerInternalManager*>(customNodeLibraryInternalManager);
+    return 0;
+}
+
+static const CustomNodeTensor* findInput(const struct CustomNodeTensor* inputs, int inputsCount, const char* name) {
+    for (int i = 0; i < inputsCount; i++) {
+        if (std::strcmp(inputs[i].name, name) == 0) {
+            return &inputs[i];
+        }
+    }
+    return nullptr;
+}
+
+static bool isTextTensor(const CustomNodeTensor* tensor) {
+    return tensor->precision == U8 && (tensor->dimsCount == 1 || (tensor->dimsCount == 2 && tensor->dims[0] == 1));
+}
+
+static int fillOutput(CustomNodeTensor& output, const char* name, const std::vector<token_id_t>& values) {
+    output.name = name;
+    output.dataBytes = values.size() * sizeof(token_id_t);
+    output.data = (uint8_t*)malloc(output.dataBytes > 0 ? output.dataBytes : 1);
+    NODE_ASSERT(output.data != nullptr, "malloc has failed");
+    if (output.dataBytes > 0) {
+        std::memcpy(output.data, values.data(), output.dataBytes);
+    }
+    output.dimsCount = 2;
+    output.dims = (uint64_t*)malloc(output.dimsCount * sizeof(uint64_t));
+    NODE_ASSERT(output.dims != nullptr, "malloc has failed");
+    output.dims[0] = 1;
+    output.dims[1] = values.size();
+    output.precision = I64;
+    return 0;
+}
+
+int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager) {
+    auto internalManager = static_cast<TokenizerInternalManager*>(customNodeLibraryInternalManager);
+    NODE_ASSERT(internalManager != nullptr, "tokenizer is not initialized");
+    std::shared_lock<std::shared_timed_mutex> lock(internalManager->mtx);
+    const WordpieceTokenizer& tokenizer = internalManager->tokenizer;
+
+    bool pairInput = get_string_parameter("pair_input", params, paramsCount, "false") == "true";
+    bool addSpecialTokens = get_string_parameter("add_special_tokens", params, paramsCount, "true") == "true";
+    int maxLength = get_int_parameter("max_length", params, paramsCount, 0);
+    NODE_ASSERT(maxLength >= 0, "max_length should be equal or greater than 0");
+
+    const CustomNodeTensor* text = findInput(inputs, inputsCount, TEXT_TENSOR_NAME);
+    NODE_ASSERT(text != nullptr, "missing text input");
+    NODE_ASSERT(isTextTensor(text), "text input must be U8 tensor with shape (N) or (1,N)");
+    std::vector<token_id_t> firstIds;
+    NODE_ASSERT(tokenizer.tokenize(text->data, text->dataBytes, firstIds), "text input is not valid UTF-8");
+
+    std::vector<token_id_t> secondIds;
+    if (pairInput) {
+        const CustomNodeTensor* textPair = findInput(inputs, inputsCount, TEXT_PAIR_TENSOR_NAME);
+        NODE_ASSERT(textPair != nullptr, "missing text_pair input");
+        NODE_ASSERT(isTextTensor(textPair), "text_pair input must be U8 tensor with shape (N) or (1,N)");
+        NODE_ASSERT(tokenizer.tokenize(textPair->data, textPair->dataBytes, secondIds), "text_pair input is not valid UTF-8");
+    }
+    if (maxLength > 0) {
+        WordpieceTokenizer::truncate(firstIds, pairInput ? &secondIds : nullptr, addSpecialTokens ? maxLength : maxLength + (pairInput ? 3 : 2));
+    }
+
+    std::vector<token_id_t> inputIds;
+    std::vector<token_id_t> tokenTypeIds;
+    inputIds.reserve(firstIds.size() + secondIds.size() + 3);
+    if (addSpecialTokens) {
+        inputIds.push_back(tokenizer.getClsId());
+    }
+    inputIds.insert(inputIds.end(), firstIds.begin(), firstIds.end());
+    if (addSpecialTokens) {
+        inputIds.push_back(tokenizer.getSepId());
+    }
+    tokenTypeIds.resize(inputIds.size(), 0);
+    if (pairInput) {
+        inputIds.insert(inputIds.end(), secondIds.begin(), secondIds.end());
+        if (addSpecialTokens) {
+            inputIds.push_back(tokenizer.getSepId());
+        }
+        tokenTypeIds.resize(inputIds.size(), 1);
+    }
+    std::vector<token_id_t> attentionMask(inputIds.size(), 1);
+
+    *outputsCount = 3;
+    *outputs = (struct CustomNodeTensor*)malloc(*outputsCount * sizeof(CustomNodeTensor));
+    NODE_ASSERT((*outputs) != nullptr, "malloc has failed");
+    NODE_ASSERT(fillOutput((*outputs)[0], INPUT_IDS_TENSOR_NAME, inputIds) == 0, "input_ids output creation failed");
+    NODE_ASSERT(fillOutput((*outputs)[1], ATTENTION_MASK_TENSOR_NAME, attentionMask) == 0, "attention_mask output creation failed");
+    NODE_ASSERT(fillOutput((*outputs)[2], TOKEN_TYPE_IDS_TENSOR_NAME, tokenTypeIds) == 0, "token_type_ids output creation failed");
+    return 0;
+}
+
+int getInputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager) {
+    bool pairInput = get_string_parameter("pair_input", params, paramsCount, "false") == "true";
+    *infoCount = pairInput ? 2 : 1;
+    *info = (struct CustomNodeTensorInfo*)malloc(*infoCount * sizeof(struct CustomNodeTensorInfo));
+    NODE_ASSERT((*info) != nullptr, "malloc has failed");
+    const char* names[] = {TEXT_TENSOR_NAME, TEXT_PAIR_TENSOR_NAME};
+    for (int i = 0; i < *infoCount; i++) {
+        (*info)[i].name = names[i];
+        (*info)[i].dimsCount = 1;
+        (*info)[i].dims = (uint64_t*)malloc((*info)[i].dimsCount * sizeof(uint64_t));
+        NODE_ASSERT(((*info)[i].dims) != nullptr, "malloc has failed");
+        (*info)[i].dims[0] = 0;
+        (*info)[i].precision = U8;
+    }
+    return 0;
+}
+
+int getOutputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager) {
+    *infoCount = 3;
+    *info = (struct CustomNodeTensorInfo*)malloc(*infoCount * sizeof(struct CustomNodeTensorInfo));
+    NODE_ASSERT((*info) != nullptr, "malloc has failed");
+    const char* names[] = {INPUT_IDS_TENSOR_NAME, ATTENTION_MASK_TENSOR_NAME, TOKEN_TYPE_IDS_TENSOR_NAME};
+    for (int i = 0; i < *infoCount; i++) {
+        (*info)[i].name = names[i];
+        (*info)[i].dimsCount = 2;
+        (*info)[i].dims = (uint64_t*)malloc((*info)[i].dimsCount * sizeof(uint64_t));
+        NODE_ASSERT(((*info)[i].dims) != nullptr, "malloc has failed");
+        (*info)[i].dims[0] = 1;
+        (*info)[i].dims[1] = 0;
+        (*info)[i].precision = I64;
+    }
+    return 0;
+}
+
+int release(void* ptr, void* customNodeLibraryInternalManager) {
+    free(ptr);
+    return 0;
+}
@@ -0,0 +1,330 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ovms {
+namespace custom_nodes_tokenizer {
+
+using token_id_t = int64_t;
+
+static constexpr uint64_t ASCII_HIGH_BITS = 0x8080808080808080ULL;
+static constexpr uint64_t BYTES_ONES = 0x0101010101010101ULL;
+
+/**
+ * @brief Byte trie of vocabulary tokens. Edges of all nodes are kept in one hash map
+ * keyed by parent node index and byte, which keeps memory usage proportional to
+ * vocabulary size while allowing longest prefix match in a single pass.
+ */
+class VocabularyTrie {
+    std::vector<token_id_t> nodeTokenIds{-1};
+    std::unordered_map<uint64_t, uint32_t> edges;
+
+    static uint64_t edgeKey(uint32_t node, uint8_t byte) {
+        return (static_cast<uint64_t>(node) << 8) | byte;
+    }
+
+public:
+    static constexpr uint32_t ROOT = 0;
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    uint32_t child(uint32_t node, uint8_t byte) const {
+        auto it = edges.find(edgeKey(node, byte));
+        return it == edges.end() ? NONE : it->second;
+    }
+
+    uint32_t walk(uint32_t node, const std::string& str) const {
+        for (size_t i = 0; i < str.size() && node != NONE; ++i) {
+            node = child(node, static_cast<uint8_t>(str[i]));
+        }
+        return node;
+    }
+
+    token_id_t tokenId(uint32_t node) const {
+        return nodeTokenIds[node];
+    }
+
+    void insert(const std::string& token, token_id_t id) {
+        uint32_t node = ROOT;
+        for (char c : token) {
+            uint32_t next = child(node, static_cast<uint8_t>(c));
+            if (next == NONE) {
+                next = static_cast<uint32_t>(nodeTokenIds.size());
+                nodeTokenIds.push_back(-1);
+                edges.emplace(edgeKey(node, static_cast<uint8_t>(c)), next);
+            }
+            node = next;
+        }
+        if (nodeTokenIds[node] == -1) {
+            nodeTokenIds[node] = id;
+        }
+    }
+
+    size_t size() const {
+        return nodeTokenIds.size();
+    }
+};
+
+/**
+ * @brief BERT WordPiece tokenizer: whitespace and punctuation splitting followed by
+ * greedy longest-match-first split of every word into vocabulary subwords.
+ */
+class WordpieceTokenizer {
+    VocabularyTrie trie;
+    uint32_t continuationRoot = VocabularyTrie::NONE;
+    size_t vocabularySize = 0;
+    bool lowerCase = true;
+    size_t maxCharsPerWord = 100;
+    token_id_t unkId = -1;
+    token_id_t clsId = -1;
+    token_id_t sepId = -1;
+
+    static size_t utf8SequenceLength(uint8_t lead) {
+        if (lead < 0x80)
+            return 1;
+        if ((lead & 0xE0) == 0xC0)
+            return 2;
+        if ((lead & 0xF0) == 0xE0)
+            return 3;
+        if ((lead & 0xF8) == 0xF0)
+            return 4;
+        return 0;
+    }
+
+    static bool isAsciiPunctuation(uint8_t c) {
+        return (c >= 33 && c <= 47) || (c >= 58 && c <= 64) || (c >= 91 && c <= 96) || (c >= 123 && c <= 126);
+    }
+
+    static bool isAsciiWhitespace(uint8_t c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    // Codepoints tokenized as separate words, same as in original BERT implementation
+    static bool isCjk(uint32_t cp) {
+        return (cp >= 0x4E00 && cp <= 0x9FFF) || (cp >= 0x3400 && cp <= 0x4DBF) ||
+               (cp >= 0x20000 && cp <= 0x2A6DF) || (cp >= 0x2A700 && cp <= 0x2B73F) ||
+               (cp >= 0x2B740 && cp <= 0x2B81F) || (cp >= 0x2B820 && cp <= 0x2CEAF) ||
+               (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x2F800 && cp <= 0x2FA1F);
+    }
+
+    static bool isUnicodePunctuation(uint32_t cp) {
+        return (cp >= 0x2000 && cp <= 0x206F) || (cp >= 0x3000 && cp <= 0x303F) || (cp >= 0xFF00 && cp <= 0xFF0F);
+    }
+
+    static uint32_t decode(const uint8_t* data, size_t length) {
+        if (length == 2)
+            return ((data[0] & 0x1F) << 6) | (data[1] & 0x3F);
+        if (length == 3)
+            return ((data[0] & 0x0F) << 12) | ((data[1] & 0x3F) << 6) | (data[2] & 0x3F);
+        return ((data[0] & 0x07) << 18) | ((data[1] & 0x3F) << 12) | ((data[2] & 0x3F) << 6) | (data[3] & 0x3F);
+    }
+
+    // Lowercases 8 ASCII characters at once, input must not have high bits set
+    static uint64_t asciiToLower(uint64_t word) {
+        uint64_t aboveA = word + (0x80 - 'A') * BYTES_ONES;
+        uint64_t aboveZ = word + (0x80 - 'Z' - 1) * BYTES_ONES;
+        uint64_t upper = (aboveA ^ aboveZ) & ASCII_HIGH_BITS;
+        return word | (upper >> 2);
+    }
+
+public:
+    /**
+     * @brief Loads vocabulary file with one token per line, token id is line number.
+     */
+    bool loadVocabulary(const std::string& path, std::string& error) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            error = "cannot open vocabulary file: " + path;
+            return false;
+        }
+        std::string line;
+        token_id_t id = 0;
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (!line.empty()) {
+                trie.insert(line, id);
+            }
+            ++id;
+        }
+        vocabularySize = static_cast<size_t>(id);
+        continuationRoot = trie.walk(VocabularyTrie::ROOT, "##");
+        return true;
+    }
+
+    bool setSpecialTokens(const std::string& unk, const std::string& cls, const std::string& sep, std::string& error) {
+        unkId = findToken(unk);
+        clsId = findToken(cls);
+        sepId = findToken(sep);
+        if (unkId < 0 || clsId < 0 || sepId < 0) {
+            error = "special tokens: " + unk + ", " + cls + ", " + sep + " must be present in vocabulary";
+            return false;
+        }
+        return true;
+    }
+
+    void setLowerCase(bool lowerCase) { this->lowerCase = lowerCase; }
+    void setMaxCharsPerWord(size_t maxCharsPerWord) { this->maxCharsPerWord = maxCharsPerWord; }
+
+    token_id_t findToken(const std::string& token) const {
+        uint32_t node = trie.walk(VocabularyTrie::ROOT, token);
+        return node == VocabularyTrie::NONE ? -1 : trie.tokenId(node);
+    }
+
+    token_id_t getClsId() const { return clsId; }
+    token_id_t getSepId() const { return sepId; }
+    size_t getVocabularySize() const { return vocabularySize; }
+
+    /**
+     * @brief Validates UTF-8 and lowercases ASCII characters if requested.
+     * ASCII text is processed in 8 byte blocks.
+     */
+    bool normalize(const uint8_t* data, size_t size, std::string& normalized) const {
+        normalized.resize(size);
+        char* out = &normalized[0];
+        size_t i = 0;
+        while (i < size) {
+            uint64_t block;
+            if (i + sizeof(block) <= size) {
+                std::memcpy(&block, data + i, sizeof(block));
+                if ((block & ASCII_HIGH_BITS) == 0) {
+                    if (lowerCase) {
+                        block = asciiToLower(block);
+                    }
+                    std::memcpy(out + i, &block, sizeof(block));
+                    i += sizeof(block);
+                    continue;
+                }
+            }
+            uint8_t lead = data[i];
+            size_t length = utf8SequenceLength(lead);
+            if (length == 0 || i + length > size) {
+                return false;
+            }
+            for (size_t j = 1; j < length; ++j) {
+                if ((data[i + j] & 0xC0) != 0x80) {
+                    return false;
+                }
+            }
+            if (length == 1 && lowerCase && lead >= 'A' && lead <= 'Z') {
+                lead = static_cast<uint8_t>(lead + ('a' - 'A'));
+            }
+            out[i] = static_cast<char>(lead);
+            std::memcpy(out + i + 1, data + i + 1, length - 1);
+            i += length;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Splits single word into subword ids. Word not representable with vocabulary is replaced with unknown token.
+     */
+    void tokenizeWord(const char* word, size_t size, std::vector<token_id_t>& ids) const {
+        if (size > maxCharsPerWord) {
+            ids.push_back(unkId);
+            return;
+        }
+        const size_t initialSize = ids.size();
+        size_t start = 0;
+        while (start < size) {
+            uint32_t node = start == 0 ? VocabularyTrie::ROOT : continuationRoot;
+            token_id_t matchedId = -1;
+            size_t matchedEnd = start;
+            for (size_t i = start; i < size && node != VocabularyTrie::NONE; ++i) {
+                node = trie.child(node, static_cast<uint8_t>(word[i]));
+                if (node != VocabularyTrie::NONE && trie.tokenId(node) >= 0 &&
+                    (i + 1 == size || (static_cast<uint8_t>(word[i + 1]) & 0xC0) != 0x80)) {
+                    matchedId = trie.tokenId(node);
+                    matchedEnd = i + 1;
+                }
+            }
+            if (matchedId < 0) {
+                ids.resize(initialSize);
+                ids.push_back(unkId);
+                return;
+            }
+            ids.push_back(matchedId);
+            start = matchedEnd;
+        }
+    }
+
+    /**
+     * @brief Tokenizes UTF-8 text without adding special tokens. Returns false for invalid UTF-8.
+     */
+    bool tokenize(const uint8_t* data, size_t size, std::vector<token_id_t>& ids) const {
+        std::string text;
+        if (!normalize(data, size, text)) {
+            return false;
+        }
+        size_t wordStart = 0;
+        size_t i = 0;
+        auto flushWord = [&](size_t end) {
+            if (end > wordStart) {
+                tokenizeWord(text.data() + wordStart, end - wordStart, ids);
+            }
+        };
+        while (i < text.size()) {
+            uint8_t c = static_cast<uint8_t>(text[i]);
+            size_t length = utf8SequenceLength(c);
+            bool separate = false;
+            bool drop = false;
+            if (length == 1) {
+                drop = isAsciiWhitespace(c) || c < 0x20 || c == 0x7F;
+                separate = isAsciiPunctuation(c);
+            } else {
+                uint32_t cp = decode(reinterpret_cast<const uint8_t*>(text.data()) + i, length);
+                drop = cp == 0x00A0 || cp == 0x3000 || (cp >= 0x2000 && cp <= 0x200B);
+                separate = !drop && (isCjk(cp) || isUnicodePunctuation(cp));
+            }
+            if (drop || separate) {
+                flushWord(i);
+                if (separate) {
+                    tokenizeWord(text.data() + i, length, ids);
+                }
+                wordStart = i + length;
+            }
+            i += length;
+        }
+        flushWord(text.size());
+        return true;
+    }
+
+    /**
+     * @brief Truncates sequences to fit maxLength tokens together with special tokens,
+     * removing tokens from the end of the longer sequence first.
+     */
+    static void truncate(std::vector<token_id_t>& first, std::vector<token_id_t>* second, size_t maxLength) {
+        const size_t specialTokens = second ? 3 : 2;
+        const size_t budget = maxLength > specialTokens ? maxLength - specialTokens : 0;
+        while (first.size() + (second ? second->size() : 0) > budget) {
+            if (second && second->size() > first.size()) {
+                second->pop_back();
+            } else {
+                first.pop_back();
+            }
+        }
+    }
+};
+
+}  // namespace custom_nodes_tokenizer
+}  // namespace ovms
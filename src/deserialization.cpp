@@ -74,4 +74,37 @@ ov::Tensor makeTensor(const ::inference::ModelInferRequest::InferInputTensor& re
     return tensor;
 }
 
+size_t estimateDeserializationBytes(const tensorflow::TensorProto& requestInput) {
+    if (requestInput.dtype() == tensorflow::DataType::DT_STRING) {
+        size_t bytes = 0;
+        for (const auto& value : requestInput.string_val()) {
+            bytes += value.size();
+        }
+        return bytes;
+    }
+    // tensor_content is wrapped without copy, only values requiring conversion are counted
+    return requestInput.half_val_size() * sizeof(int) + requestInput.int_val_size() * sizeof(int);
+}
+
+size_t estimateDeserializationBytes(const ::inference::ModelInferRequest::InferInputTensor& requestInput, const std::string* buffer) {
+    if (requestInput.datatype() == "BYTES") {
+        size_t bytes = 0;
+        for (const auto& value : requestInput.contents().bytes_contents()) {
+            bytes += value.size();
+        }
+        return bytes;
+    }
+    if (buffer != nullptr) {
+        return 0;
+    }
+    const auto& contents = requestInput.contents();
+    return contents.bool_contents_size() * sizeof(bool) +
+           contents.int_contents_size() * sizeof(int32_t) +
+           contents.int64_contents_size() * sizeof(int64_t) +
+           contents.uint_contents_size() * sizeof(uint32_t) +
+           contents.uint64_contents_size() * sizeof(uint64_t) +
+           contents.fp32_contents_size() * sizeof(float) +
+           contents.fp64_contents_size() * sizeof(double);
+}
+
 }  // namespace ovms
@@ -15,8 +15,10 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <openvino/openvino.hpp>
 #include <spdlog/spdlog.h>
@@ -30,6 +32,7 @@
 #pragma GCC diagnostic pop
 
 #include "binaryutils.hpp"
+#include "deserialization_thread_pool.hpp"
 #include "profiler.hpp"
 #include "status.hpp"
 #include "tensorinfo.hpp"
@@ -287,51 +290,124 @@ public:
     Status give(const std::string& name, ov::Tensor& tensor);
 };
 
-template <class TensorProtoDeserializator, class Sink>
-Status deserializePredictRequest(
-    const tensorflow::serving::PredictRequest& request,
-    const tensor_map_t& inputMap,
-    Sink& inputSink, bool isPipeline) {
-    OVMS_PROFILE_FUNCTION();
+/**
+ * @brief Estimates amount of data converted or decoded when deserializing the input. Raw buffers
+ * wrapped by tensors without copy are not counted.
+ */
+size_t estimateDeserializationBytes(const tensorflow::TensorProto& requestInput);
+size_t estimateDeserializationBytes(const ::inference::ModelInferRequest::InferInputTensor& requestInput, const std::string* buffer);
+
+template <class TensorProtoDeserializator>
+Status deserializeRequestInput(
+    const tensorflow::TensorProto& requestInput,
+    const std::string& name,
+    const std::shared_ptr<TensorInfo>& tensorInfo,
+    ov::Tensor& tensor) {
     Status status;
-    for (const auto& pair : inputMap) {
-        try {
-            const auto& name = pair.first;
-            auto tensorInfo = pair.second;
-            auto requestInputItr = request.inputs().find(name);
-            if (requestInputItr == request.inputs().end()) {
-                SPDLOG_DEBUG("Failed to deserialize request. Validation of request failed");
-                return Status(StatusCode::INTERNAL_ERROR, "Failed to deserialize request");
+    try {
+        if (requestInput.dtype() == tensorflow::DataType::DT_STRING) {
+            SPDLOG_DEBUG("Request contains binary input: {}", name);
+            status = convertBinaryRequestTensorToOVTensor(requestInput, tensor, tensorInfo);
+            if (!status.ok()) {
+                SPDLOG_DEBUG("Binary inputs conversion failed.");
+                return status;
             }
-            auto& requestInput = requestInputItr->second;
-            ov::Tensor tensor;
+        } else {
+            tensor = deserializeTensorProto<TensorProtoDeserializator>(
+                requestInput, tensorInfo);
+        }
 
-            if (requestInput.dtype() == tensorflow::DataType::DT_STRING) {
-                SPDLOG_DEBUG("Request contains binary input: {}", name);
-                status = convertBinaryRequestTensorToOVTensor(requestInput, tensor, tensorInfo);
-                if (!status.ok()) {
-                    SPDLOG_DEBUG("Binary inputs conversion failed.");
-                    return status;
-                }
-            } else {
-                tensor = deserializeTensorProto<TensorProtoDeserializator>(
-                    requestInput, tensorInfo);
-            }
+        if (!tensor) {
+            status = StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
+            SPDLOG_DEBUG(status.string());
+            return status;
+        }
+        // OV implementation the ov::Exception is not
+        // a base class for all other exceptions thrown from OV.
+        // OV can throw exceptions derived from std::logic_error.
+    } catch (const ov::Exception& e) {
+        status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    } catch (std::logic_error& e) {
+        status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    }
+    return status;
+}
 
+template <class TensorProtoDeserializator>
+Status deserializeRequestInput(
+    const ::inference::ModelInferRequest::InferInputTensor& requestInput,
+    const std::string* buffer,
+    const std::string& name,
+    const std::shared_ptr<TensorInfo>& tensorInfo,
+    ov::Tensor& tensor) {
+    Status status;
+    try {
+        if (requestInput.datatype() == "BYTES") {
+            SPDLOG_DEBUG("Request contains binary input: {}", name);
+            status = convertBinaryRequestTensorToOVTensor(requestInput, tensor, tensorInfo);
+            if (!status.ok()) {
+                SPDLOG_DEBUG("Binary inputs conversion failed.");
+                return status;
+            }
+        } else {
+            tensor = deserializeTensorProto<TensorProtoDeserializator>(requestInput, tensorInfo, buffer);
             if (!tensor) {
                 status = StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
                 SPDLOG_DEBUG(status.string());
                 return status;
             }
-            const std::string ovTensorName = isPipeline ? name : tensorInfo->getName();
-            status = inputSink.give(ovTensorName, tensor);
-            if (!status.ok()) {
-                SPDLOG_DEBUG("Feeding input:{} to inference performer failed:{}", ovTensorName, status.string());
-                return status;
-            }
-            // OV implementation the ov::Exception is not
-            // a base class for all other exceptions thrown from OV.
-            // OV can throw exceptions derived from std::logic_error.
+        }
+        // OV implementation the ov::Exception is not
+        // a base class for all other exceptions thrown from OV.
+        // OV can throw exceptions derived from std::logic_error.
+    } catch (const ov::Exception& e) {
+        status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    } catch (std::logic_error& e) {
+        status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    }
+    return status;
+}
+
+/**
+ * @brief Input of a request matched with model input, deserialized possibly on other thread
+ */
+template <class RequestTensor>
+struct RequestInputDeserialization {
+    const std::string& name;
+    const std::shared_ptr<TensorInfo>& tensorInfo;
+    const RequestTensor& requestInput;
+    const std::string* buffer;
+    ov::Tensor tensor;
+    Status status;
+
+    RequestInputDeserialization(const std::string& name, const std::shared_ptr<TensorInfo>& tensorInfo, const RequestTensor& requestInput, const std::string* buffer = nullptr) :
+        name(name),
+        tensorInfo(tensorInfo),
+        requestInput(requestInput),
+        buffer(buffer) {}
+};
+
+/**
+ * @brief Feeds deserialized tensors to the sink on the calling thread, in model inputs order
+ */
+template <class RequestTensor, class Sink>
+Status giveDeserializedInputs(std::vector<RequestInputDeserialization<RequestTensor>>& inputs, Sink& inputSink, bool isPipeline) {
+    Status status;
+    for (auto& input : inputs) {
+        if (!input.status.ok()) {
+            return input.status;
+        }
+        const std::string ovTensorName = isPipeline ? input.name : input.tensorInfo->getName();
+        try {
+            status = inputSink.give(ovTensorName, input.tensor);
         } catch (const ov::Exception& e) {
             status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
             SPDLOG_DEBUG("{}: {}", status.string(), e.what());
@@ -341,67 +417,69 @@ Status deserializePredictRequest(
             SPDLOG_DEBUG("{}: {}", status.string(), e.what());
             return status;
         }
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Feeding input:{} to inference performer failed:{}", ovTensorName, status.string());
+            return status;
+        }
     }
     return status;
 }
 
+template <class TensorProtoDeserializator, class Sink>
+Status deserializePredictRequest(
+    const tensorflow::serving::PredictRequest& request,
+    const tensor_map_t& inputMap,
+    Sink& inputSink, bool isPipeline) {
+    OVMS_PROFILE_FUNCTION();
+    std::vector<RequestInputDeserialization<tensorflow::TensorProto>> inputs;
+    inputs.reserve(inputMap.size());
+    for (const auto& pair : inputMap) {
+        auto requestInputItr = request.inputs().find(pair.first);
+        if (requestInputItr == request.inputs().end()) {
+            SPDLOG_DEBUG("Failed to deserialize request. Validation of request failed");
+            return Status(StatusCode::INTERNAL_ERROR, "Failed to deserialize request");
+        }
+        inputs.emplace_back(pair.first, pair.second, requestInputItr->second);
+    }
+    // Conversion of large inputs fans out over the pool, while sink is fed on request thread only
+    DeserializationThreadPool::instance().parallelFor(
+        inputs.size(),
+        [&inputs](size_t i) { return estimateDeserializationBytes(inputs[i].requestInput); },
+        [&inputs](size_t i) {
+            auto& input = inputs[i];
+            input.status = deserializeRequestInput<TensorProtoDeserializator>(input.requestInput, input.name, input.tensorInfo, input.tensor);
+        });
+    return giveDeserializedInputs(inputs, inputSink, isPipeline);
+}
+
 template <class TensorProtoDeserializator, class Sink>
 Status deserializePredictRequest(
     const ::inference::ModelInferRequest& request,
     const tensor_map_t& inputMap,
     Sink& inputSink, bool isPipeline) {
     OVMS_PROFILE_FUNCTION();
-    Status status;
     bool deserializeFromSharedInputContents = request.raw_input_contents().size() > 0;
+    std::vector<RequestInputDeserialization<::inference::ModelInferRequest::InferInputTensor>> inputs;
+    inputs.reserve(inputMap.size());
     for (const auto& pair : inputMap) {
-        try {
-            const auto& name = pair.first;
-            auto tensorInfo = pair.second;
-            auto requestInputItr = std::find_if(request.inputs().begin(), request.inputs().end(), [&name](const ::inference::ModelInferRequest::InferInputTensor& tensor) { return tensor.name() == name; });
-            if (requestInputItr == request.inputs().end()) {
-                SPDLOG_DEBUG("Failed to deserialize request. Validation of request failed");
-                return Status(StatusCode::INTERNAL_ERROR, "Failed to deserialize request");
-            }
-            ov::Tensor tensor;
-
-            if (requestInputItr->datatype() == "BYTES") {
-                SPDLOG_DEBUG("Request contains binary input: {}", name);
-                status = convertBinaryRequestTensorToOVTensor(*requestInputItr, tensor, tensorInfo);
-                if (!status.ok()) {
-                    SPDLOG_DEBUG("Binary inputs conversion failed.");
-                    return status;
-                }
-            } else {
-                auto inputIndex = requestInputItr - request.inputs().begin();
-                auto bufferLocation = deserializeFromSharedInputContents ? &request.raw_input_contents()[inputIndex] : nullptr;
-
-                tensor = deserializeTensorProto<TensorProtoDeserializator>(*requestInputItr, tensorInfo, bufferLocation);
-                if (!tensor) {
-                    status = StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
-                    SPDLOG_DEBUG(status.string());
-                    return status;
-                }
-            }
-
-            const std::string ovTensorName = isPipeline ? name : tensorInfo->getName();
-            status = inputSink.give(ovTensorName, tensor);
-            if (!status.ok()) {
-                SPDLOG_DEBUG("Feeding input:{} to inference performer failed:{}", ovTensorName, status.string());
-                return status;
-            }
-            // OV implementation the ov::Exception is not
-            // a base class for all other exceptions thrown from OV.
-            // OV can throw exceptions derived from std::logic_error.
-        } catch (const ov::Exception& e) {
-            status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-            SPDLOG_DEBUG("{}: {}", status.string(), e.what());
-            return status;
-        } catch (std::logic_error& e) {
-            status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-            SPDLOG_DEBUG("{}: {}", status.string(), e.what());
-            return status;
+        const auto& name = pair.first;
+        auto requestInputItr = std::find_if(request.inputs().begin(), request.inputs().end(), [&name](const ::inference::ModelInferRequest::InferInputTensor& tensor) { return tensor.name() == name; });
+        if (requestInputItr == request.inputs().end()) {
+            SPDLOG_DEBUG("Failed to deserialize request. Validation of request failed");
+            return Status(StatusCode::INTERNAL_ERROR, "Failed to deserialize request");
         }
+        auto inputIndex = requestInputItr - request.inputs().begin();
+        auto bufferLocation = deserializeFromSharedInputContents ? &request.raw_input_contents()[inputIndex] : nullptr;
+        inputs.emplace_back(name, pair.second, *requestInputItr, bufferLocation);
     }
-    return status;
+    // Conversion of large inputs fans out over the pool, while sink is fed on request thread only
+    DeserializationThreadPool::instance().parallelFor(
+        inputs.size(),
+        [&inputs](size_t i) { return estimateDeserializationBytes(inputs[i].requestInput, inputs[i].buffer); },
+        [&inputs](size_t i) {
+            auto& input = inputs[i];
+            input.status = deserializeRequestInput<TensorProtoDeserializator>(input.requestInput, input.buffer, input.name, input.tensorInfo, input.tensor);
+        });
+    return giveDeserializedInputs(inputs, inputSink, isPipeline);
 }
 }  // namespace ovms
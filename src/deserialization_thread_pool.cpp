@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "deserialization_thread_pool.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+DeserializationThreadPool& DeserializationThreadPool::instance() {
+    static DeserializationThreadPool pool;
+    return pool;
+}
+
+DeserializationThreadPool::~DeserializationThreadPool() {
+    stop();
+}
+
+void DeserializationThreadPool::start(uint32_t threads, size_t thresholdBytes) {
+    stop();
+    std::unique_lock<std::mutex> lock(mtx);
+    this->stopping = false;
+    this->thresholdBytes = thresholdBytes;
+    for (uint32_t i = 0; i < threads; i++) {
+        workers.emplace_back(&DeserializationThreadPool::workerLoop, this);
+    }
+    this->threadsCount = threads;
+    if (threads > 0) {
+        SPDLOG_INFO("Parallel deserialization enabled with {} threads for inputs of at least {} bytes", threads, thresholdBytes);
+    }
+}
+
+void DeserializationThreadPool::stop() {
+    std::vector<std::thread> stoppedWorkers;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (workers.empty()) {
+            return;
+        }
+        stopping = true;
+        threadsCount = 0;
+        stoppedWorkers.swap(workers);
+    }
+    cv.notify_all();
+    for (auto& worker : stoppedWorkers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void DeserializationThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+            // Remaining tasks are drained, since request threads wait for them
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+void DeserializationThreadPool::parallelFor(size_t count, const std::function<size_t(size_t)>& getSize, const std::function<void(size_t)>& fn) {
+    std::vector<size_t> large;
+    std::vector<size_t> small;
+    const bool parallel = threadsCount > 0;
+    const size_t threshold = thresholdBytes;
+    for (size_t i = 0; i < count; i++) {
+        if (parallel && getSize(i) >= threshold) {
+            large.push_back(i);
+        } else {
+            small.push_back(i);
+        }
+    }
+    if (large.size() < 2) {
+        for (size_t i = 0; i < count; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::mutex doneMtx;
+    std::condition_variable doneCv;
+    size_t remaining = large.size() - 1;
+    std::exception_ptr workerException;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (workers.empty()) {
+            // Pool was stopped after the check above, so enqueued tasks would never run
+            lock.unlock();
+            for (size_t i = 0; i < count; i++) {
+                fn(i);
+            }
+            return;
+        }
+        for (size_t k = 1; k < large.size(); k++) {
+            size_t index = large[k];
+            tasks.emplace([&, index]() {
+                std::exception_ptr exception;
+                try {
+                    fn(index);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                // Notify under the lock, so the waiting thread cannot destroy doneCv before it returns
+                std::lock_guard<std::mutex> doneLock(doneMtx);
+                if (exception && !workerException) {
+                    workerException = exception;
+                }
+                if (--remaining == 0) {
+                    doneCv.notify_one();
+                }
+            });
+        }
+    }
+    cv.notify_all();
+
+    std::exception_ptr callerException;
+    try {
+        fn(large[0]);
+        for (size_t i : small) {
+            fn(i);
+        }
+    } catch (...) {
+        callerException = std::current_exception();
+    }
+    {
+        std::unique_lock<std::mutex> doneLock(doneMtx);
+        doneCv.wait(doneLock, [&remaining] { return remaining == 0; });
+    }
+    if (callerException) {
+        std::rethrow_exception(callerException);
+    }
+    if (workerException) {
+        std::rethrow_exception(workerException);
+    }
+}
+
+}  // namespace ovms
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ovms {
+
+/**
+ * @brief Small pool of worker threads deserializing large inputs of a single request in parallel.
+ * Inputs below the size threshold and requests with less than two large inputs are deserialized
+ * on the calling thread, so small requests do not pay for thread handoff.
+ */
+class DeserializationThreadPool {
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping = false;
+    // Read by request threads without the lock, tasks are enqueued only after checking workers under the lock
+    std::atomic<size_t> threadsCount{0};
+    std::atomic<size_t> thresholdBytes{0};
+
+    void workerLoop();
+
+public:
+    static constexpr size_t DEFAULT_THRESHOLD_BYTES = 1024 * 1024;
+
+    DeserializationThreadPool() = default;
+    ~DeserializationThreadPool();
+    DeserializationThreadPool(const DeserializationThreadPool&) = delete;
+    DeserializationThreadPool& operator=(const DeserializationThreadPool&) = delete;
+
+    static DeserializationThreadPool& instance();
+
+    /**
+     * @brief Spawns worker threads. Zero threads disables parallel deserialization.
+     */
+    void start(uint32_t threads, size_t thresholdBytes = DEFAULT_THRESHOLD_BYTES);
+
+    /**
+     * @brief Finishes already scheduled tasks and joins worker threads. Requests arriving afterwards
+     * are deserialized on the calling thread.
+     */
+    void stop();
+
+    size_t getThreadsCount() const { return threadsCount; }
+    size_t getThresholdBytes() const { return thresholdBytes; }
+
+    /**
+     * @brief Calls fn for each index in [0, count) and returns once all calls finished. Indexes with
+     * getSize at or above the threshold are spread over the workers and the calling thread.
+     * Exception thrown by fn on a worker is rethrown on the calling thread.
+     */
+    void parallelFor(size_t count, const std::function<size_t(size_t)>& getSize, const std::function<void(size_t)>& fn);
+};
+
+}  // namespace ovms
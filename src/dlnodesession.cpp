@@ -231,11 +231,13 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
     this->timer->stop(GET_INFER_REQUEST);
     double getInferRequestTime = this->timer->elapsed<std::chrono::microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->model->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    this->model->getInferRequestWaitEstimator().observe(getInferRequestTime / 1000);
     status = setInputsForInference(inferRequest);
     if (!status.ok()) {
         notifyEndQueue.push({node, getSessionKey()});
         return status;
     }
+    this->model->observeBatchSize(inferRequest);
     status = executeInference(notifyEndQueue, inferRequest, node);
     if (!status.ok()) {
         notifyEndQueue.push({node, getSessionKey()});
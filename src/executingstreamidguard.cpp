@@ -20,6 +20,23 @@
 
 namespace ovms {
 
+namespace {
+thread_local bool lowPriorityInference = false;
+}  // namespace
+
+LowPriorityInferenceScope::LowPriorityInferenceScope() :
+    previous(lowPriorityInference) {
+    lowPriorityInference = true;
+}
+
+LowPriorityInferenceScope::~LowPriorityInferenceScope() {
+    lowPriorityInference = previous;
+}
+
+bool LowPriorityInferenceScope::isActive() {
+    return lowPriorityInference;
+}
+
 ExecutingStreamIdGuard::CurrentRequestsMetricGuard::CurrentRequestsMetricGuard(ModelMetricReporter& reporter) :
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
@@ -32,14 +49,20 @@ ExecutingStreamIdGuard::CurrentRequestsMetricGuard::~CurrentRequestsMetricGuard(
 ExecutingStreamIdGuard::ExecutingStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
     currentRequestsMetricGuard(reporter),
     inferRequestsQueue_(inferRequestsQueue),
-    id_(inferRequestsQueue_.getIdleStream().get()),
+    id_(inferRequestsQueue_.getIdleStream(LowPriorityInferenceScope::isActive()).get()),
     inferRequest(inferRequestsQueue.getInferRequest(id_)),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    if (this->reporter.inferReqBusyTime) {
+        this->acquiredAt = std::chrono::steady_clock::now();
+    }
 }
 
 ExecutingStreamIdGuard::~ExecutingStreamIdGuard() {
     DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    if (this->reporter.inferReqBusyTime) {
+        this->reporter.inferReqBusyTime->increment(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - this->acquiredAt).count());
+    }
     this->inferRequestsQueue_.returnStream(this->id_);
 }
 
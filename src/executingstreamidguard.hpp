@@ -15,6 +15,8 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
+
 namespace ov {
 class InferRequest;
 }
@@ -24,6 +26,22 @@ namespace ovms {
 class ModelMetricReporter;
 class OVInferRequestsQueue;
 
+/**
+ * @brief While alive, infer requests acquired on the current thread wait for idle infer request
+ * behind all regular requests of the model. Used by offline batch jobs to give precedence to online traffic.
+ */
+class LowPriorityInferenceScope {
+    const bool previous;
+
+public:
+    LowPriorityInferenceScope();
+    ~LowPriorityInferenceScope();
+    LowPriorityInferenceScope(const LowPriorityInferenceScope&) = delete;
+    LowPriorityInferenceScope& operator=(const LowPriorityInferenceScope&) = delete;
+
+    static bool isActive();
+};
+
 struct ExecutingStreamIdGuard {
     ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
     ~ExecutingStreamIdGuard();
@@ -45,6 +63,7 @@ private:
     const int id_;
     ov::InferRequest& inferRequest;
     ModelMetricReporter& reporter;
+    std::chrono::steady_clock::time_point acquiredAt;
 };
 
 }  //  namespace ovms
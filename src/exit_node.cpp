@@ -18,6 +18,7 @@
 #include <string>
 #include <utility>
 
+#include "alloc_tracker.hpp"
 #include "logging.hpp"
 #include "ov_utils.hpp"
 #include "serialization.hpp"
@@ -34,6 +35,8 @@ template <typename ResponseType>
 Status ExitNode<ResponseType>::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) {
     OVMS_PROFILE_FUNCTION();
     auto& exitNodeSession = static_cast<ExitNodeSession<ResponseType>&>(nodeSession);
+    PerfCountersScope perfCounters(this->serializeHwEvents);
+    AllocTrackingScope allocScope(ALLOC_STAGE_SERIALIZE);
     return this->fetchResults(exitNodeSession.getInputTensors());
 }
 
@@ -58,8 +61,80 @@ Status OutputGetter<const TensorMap&>::get(const std::string& name, ov::Tensor&
 
 template <typename ResponseType>
 Status ExitNode<ResponseType>::fetchResults(const TensorMap& inputTensors) {
-    OutputGetter<const TensorMap&> outputGetter(inputTensors);
-    return serializePredictResponse(outputGetter, this->outputsInfo, this->response, getOutputMapKeyName);
+    if (inputTensors.size() >= this->outputsInfo.size()) {
+        OutputGetter<const TensorMap&> outputGetter(inputTensors);
+        return serializePredictResponse(outputGetter, this->outputsInfo, this->response, getOutputMapKeyName);
+    }
+    // Outputs of branches skipped by condition nodes are returned as empty tensors with first dimension 0
+    TensorMap outputs = inputTensors;
+    tensor_map_t actualOutputsInfo;
+    for (const auto& [name, info] : this->outputsInfo) {
+        auto it = outputs.find(name);
+        if (it == outputs.end()) {
+            shape_t emptyShape;
+            for (const auto& dim : info->getShape()) {
+                emptyShape.emplace_back(dim.isStatic() && !emptyShape.empty() ? dim.getStaticValue() : 0);
+            }
+            if (emptyShape.empty()) {
+                emptyShape.emplace_back(0);
+            }
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline output: {} was skipped, returning empty tensor", name);
+            it = outputs.emplace(name, ov::Tensor(info->getOvPrecision(), ov::Shape(emptyShape.begin(), emptyShape.end()))).first;
+        }
+        const auto& tensorShape = it->second.get_shape();
+        actualOutputsInfo.emplace(name, info->createCopyWithNewShape(Shape(shape_t(tensorShape.begin(), tensorShape.end()))));
+    }
+    OutputGetter<const TensorMap&> outputGetter(outputs);
+    return serializePredictResponse(outputGetter, actualOutputsInfo, this->response, getOutputMapKeyName);
+}
+
+template <typename ResponseType>
+Status ExitNode<ResponseType>::setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata) {
+    auto status = Node::setInputs(dependency, inputs, metadata);
+    if (!status.ok() || !partialResultsCallback || !gatherFrom || metadata.isSkipped()) {
+        return status;
+    }
+    session_id_t shardId;
+    try {
+        shardId = metadata.getShardId(gatherFrom.value());
+    } catch (const std::exception& e) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to get shardId for node: {}", getName());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    auto& shardOutputs = pendingShards[shardId];
+    for (const auto& [dependencyOutputName, outputName] : this->getMappingByDependency(dependency)) {
+        shardOutputs.emplace(outputName, inputs.at(dependencyOutputName).getActualTensor());
+    }
+    if (shardOutputs.size() < outputsInfo.size()) {
+        return StatusCode::OK;
+    }
+    status = emitPartialResults(shardId, shardOutputs);
+    pendingShards.erase(shardId);
+    return status;
+}
+
+template <typename ResponseType>
+Status ExitNode<ResponseType>::emitPartialResults(session_id_t shardId, const TensorMap& outputs) {
+    OVMS_PROFILE_FUNCTION();
+    // Shard tensors do not have gathered dimensions yet, so shapes are taken from actual results
+    tensor_map_t shardOutputsInfo;
+    for (const auto& [name, info] : outputsInfo) {
+        const auto& tensorShape = outputs.at(name).get_shape();
+        shardOutputsInfo.emplace(name, info->createCopyWithNewShape(Shape(shape_t(tensorShape.begin(), tensorShape.end()))));
+    }
+    ResponseType partialResponse;
+    OutputGetter<const TensorMap&> outputGetter(outputs);
+    PerfCountersScope perfCounters(this->serializeHwEvents);
+    AllocTrackingScope allocScope(ALLOC_STAGE_SERIALIZE);
+    auto status = serializePredictResponse(outputGetter, shardOutputsInfo, &partialResponse, getOutputMapKeyName);
+    allocScope.stop();
+    perfCounters.stop();
+    if (!status.ok()) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to serialize partial results of shard: {}; {}", shardId, status.string());
+        return status;
+    }
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Emitting partial results of shard: {}", shardId);
+    return partialResultsCallback(partialResponse, shardId);
 }
 
 template <typename ResponseType>
@@ -73,6 +148,10 @@ template Status ExitNode<::inference::ModelInferResponse>::execute(session_key_t
 template Status ExitNode<tensorflow::serving::PredictResponse>::execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue);
 template Status ExitNode<::inference::ModelInferResponse>::fetchResults(const TensorMap& inputTensors);
 template Status ExitNode<tensorflow::serving::PredictResponse>::fetchResults(const TensorMap& inputTensors);
+template Status ExitNode<::inference::ModelInferResponse>::setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata);
+template Status ExitNode<tensorflow::serving::PredictResponse>::setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata);
+template Status ExitNode<::inference::ModelInferResponse>::emitPartialResults(session_id_t shardId, const TensorMap& outputs);
+template Status ExitNode<tensorflow::serving::PredictResponse>::emitPartialResults(session_id_t shardId, const TensorMap& outputs);
 template std::unique_ptr<NodeSession> ExitNode<::inference::ModelInferResponse>::createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails);
 template std::unique_ptr<NodeSession> ExitNode<tensorflow::serving::PredictResponse>::createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails);
 }  // namespace ovms
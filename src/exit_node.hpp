@@ -14,9 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
@@ -24,33 +26,68 @@
 #pragma GCC diagnostic pop
 
 #include "node.hpp"
+#include "perf_counters.hpp"
+#include "session_id.hpp"
 #include "tensorinfo.hpp"
 
 namespace ovms {
 
 const std::string EXIT_NODE_NAME = "response";
 
+/**
+ * @brief Receives response with pipeline outputs of a single demultiplexed shard
+ * as soon as all of them reach exit node. Non-OK status aborts pipeline execution.
+ */
+template <typename ResponseType>
+using PartialResultsCallback = std::function<Status(ResponseType& partialResponse, session_id_t shardId)>;
+
 template <typename ResponseType>
 class ExitNode : public Node {
     ResponseType* response;
     const tensor_map_t outputsInfo;
+    // Hardware events of response serialization, counted in ::fetchResults
+    perf_metrics_t* serializeHwEvents;
+
+    PartialResultsCallback<ResponseType> partialResultsCallback;
+    // Outputs of shards which did not receive all pipeline outputs yet
+    std::unordered_map<session_id_t, TensorMap> pendingShards;
 
 public:
-    ExitNode(ResponseType* response, const tensor_map_t& outputsInfo, std::set<std::string> gatherFromNode = {}) :
+    ExitNode(ResponseType* response, const tensor_map_t& outputsInfo, std::set<std::string> gatherFromNode = {}, perf_metrics_t* serializeHwEvents = nullptr) :
         Node(EXIT_NODE_NAME, std::nullopt, gatherFromNode),
         response(response),
-        outputsInfo(outputsInfo) {
+        outputsInfo(outputsInfo),
+        serializeHwEvents(serializeHwEvents) {
     }
 
     // Exit node does not have execute logic.
     // It serializes its received input tensors to proto in ::fetchResults
     Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override;
+    // Response is serialized even if some outputs come from skipped branches
+    Status skip(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override {
+        return execute(sessionId, notifyEndQueue);
+    }
+
+    /**
+     * @brief Enables emitting per shard results when exit node gathers demultiplexed sessions.
+     * Gathered response is still serialized after all shards finish.
+     */
+    void setPartialResultsCallback(PartialResultsCallback<ResponseType> callback) {
+        this->partialResultsCallback = std::move(callback);
+    }
+
+    using Node::setInputs;
+    Status setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata) override;
 
 protected:
     Status fetchResults(const TensorMap& outputs);
+    Status emitPartialResults(session_id_t shardId, const TensorMap& outputs);
 
 public:
     Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override;
+    Status fetchSkippedResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override {
+        return fetchResults(nodeSession, nodeSessionOutputs);
+    }
 
     // Exit nodes have no dependants
     void addDependant(Node& node) override {
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
 #include <set>
 #include <string>
 #include <vector>
@@ -30,6 +31,7 @@ namespace ovms {
 namespace fs = std::filesystem;
 
 using files_list_t = std::set<std::string>;
+using file_chunk_consumer_t = std::function<StatusCode(const char* data, size_t size)>;
 class FileSystem {
 public:
     /**
@@ -92,6 +94,33 @@ public:
      */
     virtual StatusCode readTextFile(const std::string& path, std::string* contents) = 0;
 
+    /**
+     * @brief Read the content of the given file passing it to consumer in consecutive chunks.
+     * Reading stops at first chunk for which consumer does not return OK.
+     * Default implementation reads whole file into memory first.
+     *
+     * @param path
+     * @param consumer
+     * @return StatusCode
+     */
+    virtual StatusCode readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) {
+        std::string contents;
+        auto status = readTextFile(path, &contents);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        return consumer(contents.data(), contents.size());
+    }
+
+    /**
+     * @brief Check if model versions can be stored as compressed archives, eg. 1.tar.zst
+     *
+     * @return bool
+     */
+    virtual bool supportsModelVersionArchives() const {
+        return false;
+    }
+
     /**
      * @brief Download a remote directory
      * 
@@ -27,11 +27,13 @@
 
 #include <filesystem>
 #include <fstream>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "logging.hpp"
+#include "model_archive.hpp"
 #include "stringutils.hpp"
 
 namespace ovms {
@@ -40,6 +42,7 @@ namespace fs = std::filesystem;
 namespace gcs = google::cloud::storage;
 
 const std::string GCSFileSystem::GCS_URL_PREFIX = "gs://";
+const size_t GCSFileSystem::READ_CHUNK_SIZE = 1024 * 1024;
 
 StatusCode GCSFileSystem::parsePath(const std::string& path,
     std::string* bucket, std::string* object) {
@@ -284,6 +287,48 @@ StatusCode GCSFileSystem::readTextFile(const std::string& path,
     return StatusCode::OK;
 }
 
+StatusCode GCSFileSystem::readFileChunks(const std::string& path,
+    const file_chunk_consumer_t& consumer) {
+    SPDLOG_LOGGER_TRACE(gcs_logger, "Reading file {}", path);
+    bool exists;
+    auto status = fileExists(path, &exists);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    if (!exists) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Reading file -> file does not exist at {}", path);
+        return StatusCode::GCS_FILE_NOT_FOUND;
+    }
+    std::string bucket, object;
+    status = parsePath(path, &bucket, &object);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    gcs::ObjectReadStream stream = client_.ReadObject(bucket, object);
+    if (!stream) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Reading file has failed: {}", path);
+        return StatusCode::GCS_FILE_INVALID;
+    }
+    std::vector<char> buffer(READ_CHUNK_SIZE);
+    uint64_t size = 0;
+    while (stream) {
+        stream.read(buffer.data(), buffer.size());
+        if (stream.gcount() > 0) {
+            size += stream.gcount();
+            status = consumer(buffer.data(), stream.gcount());
+            if (status != StatusCode::OK) {
+                return status;
+            }
+        }
+    }
+    if (!stream.status().ok()) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Reading file has failed: {} {}", path, stream.status().message());
+        return StatusCode::GCS_FAILED_GET_OBJECT;
+    }
+    SPDLOG_LOGGER_TRACE(gcs_logger, "File {} has been read (bytes={})", path, size);
+    return StatusCode::OK;
+}
+
 StatusCode GCSFileSystem::downloadFile(const std::string& remote_path,
     const std::string& local_path) {
     SPDLOG_LOGGER_TRACE(gcs_logger, "Saving file {} to {}", remote_path, local_path);
@@ -308,7 +353,15 @@ StatusCode GCSFileSystem::downloadModelVersions(const std::string& path,
         return sc;
     }
 
+    std::map<model_version_t, std::string> archives;
+    auto archivesStatus = ModelVersionArchive::findVersionArchives(*this, path, archives);
+    if (archivesStatus != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Failed to list model version archives in {}", path);
+        return archivesStatus;
+    }
+
     StatusCode result = StatusCode::OK;
+    std::vector<ModelVersionArchive::Extraction> extractions;
     for (auto& ver : versions) {
         std::string versionpath = path;
         if (!endsWith(versionpath, "/")) {
@@ -321,6 +374,11 @@ StatusCode GCSFileSystem::downloadModelVersions(const std::string& path,
         }
         lpath.append(std::to_string(ver));
         fs::create_directory(lpath);
+        auto archive = archives.find(ver);
+        if (archive != archives.end()) {
+            extractions.push_back({archive->second, lpath});
+            continue;
+        }
         auto status = downloadFileFolder(versionpath, lpath);
         if (status != StatusCode::OK) {
             result = status;
@@ -328,6 +386,12 @@ StatusCode GCSFileSystem::downloadModelVersions(const std::string& path,
         }
     }
 
+    auto status = ModelVersionArchive::extractAll(*this, extractions);
+    if (status != StatusCode::OK) {
+        result = status;
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Failed to download model version archives from {}", path);
+    }
+
     return result;
 }
 
@@ -104,6 +104,16 @@ public:
     StatusCode readTextFile(const std::string& path,
         std::string* contents) override;
 
+    /**
+   * @brief Read the content of the given file in consecutive chunks
+   *
+   * @param path
+   * @param consumer
+   * @return StatusCode
+   */
+    StatusCode readFileChunks(const std::string& path,
+        const file_chunk_consumer_t& consumer) override;
+
     /**
    * @brief Download a remote directory
    *
@@ -131,8 +141,14 @@ public:
    */
     StatusCode deleteFileFolder(const std::string& path) override;
 
+    bool supportsModelVersionArchives() const override {
+        return true;
+    }
+
     static const std::string GCS_URL_PREFIX;
 
+    static const size_t READ_CHUNK_SIZE;
+
 private:
     /**
     * @brief
@@ -32,6 +32,7 @@
 #include <unistd.h>
 
 #include "config.hpp"
+#include "cpu_topology.hpp"
 #include "kfs_grpc_inference_service.hpp"
 #include "logging.hpp"
 #include "model_service.hpp"
@@ -45,10 +46,6 @@
 using grpc::ServerBuilder;
 
 namespace ovms {
-}  // namespace ovms
-using namespace ovms;
-static const int GIGABYTE = 1024 * 1024 * 1024;
-
 bool isPortAvailable(uint64_t port) {
     struct sockaddr_in addr;
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -67,6 +64,9 @@ bool isPortAvailable(uint64_t port) {
     close(s);
     return true;
 }
+}  // namespace ovms
+using namespace ovms;
+static const int GIGABYTE = 1024 * 1024 * 1024;
 
 struct GrpcChannelArgument {
     std::string key;
@@ -122,6 +122,7 @@ int GRPCServerModule::start(const ovms::Config& config) {
         return EXIT_FAILURE;
     }
 
+    kfsGrpcInferenceService.setMaxStreamedUploadBytes(config.grpcStreamedUploadMaxBytes());
     ServerBuilder builder;
     builder.SetMaxReceiveMessageSize(GIGABYTE);
     builder.SetMaxSendMessageSize(GIGABYTE);
@@ -147,10 +148,14 @@ int GRPCServerModule::start(const ovms::Config& config) {
     servers.reserve(grpcServersCount);
     SPDLOG_DEBUG("Starting gRPC servers: {}", grpcServersCount);
 
-    if (!isPortAvailable(config.port())) {
+    if (config.workerProcesses() > 1) {
+        // Workers share the port, supervisor checks it is not taken before forking them
+        builder.AddChannelArgument(GRPC_ARG_ALLOW_REUSEPORT, 1);
+    } else if (!isPortAvailable(config.port())) {
         SPDLOG_ERROR("Failed to start gRPC server at " + config.grpcBindAddress() + ":" + std::to_string(config.port()));
         return EXIT_FAILURE;
     }
+    ThreadAffinityGuard affinityGuard(CpuTopology::instance().getFrontendCores());
     for (uint i = 0; i < grpcServersCount; ++i) {
         std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
         if (server == nullptr) {
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -28,6 +29,11 @@
 namespace ovms {
 class Config;
 
+/**
+ * @brief Checks if port can be bound, other servers listening with SO_REUSEPORT are not detected by gRPC itself
+ */
+bool isPortAvailable(uint64_t port);
+
 class GRPCServerModule : public Module {
     Server& server;
     PredictionServiceImpl tfsPredictService;
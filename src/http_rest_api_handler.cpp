@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "http_rest_api_handler.hpp"
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -24,7 +25,10 @@
 #include <vector>
 
 #include <spdlog/spdlog.h>
+#include <strings.h>
 
+#include "alloc_tracker.hpp"
+#include "batch_job.hpp"
 #include "config.hpp"
 #include "execution_context.hpp"
 #include "filesystem.hpp"
@@ -33,6 +37,7 @@
 #include "kfs_grpc_inference_service.hpp"
 #include "metric_module.hpp"
 #include "metric_registry.hpp"
+#include "model.hpp"
 #include "model_metric_reporter.hpp"
 #include "model_service.hpp"
 #include "modelinstanceunloadguard.hpp"
@@ -62,6 +67,8 @@ const std::string DEFAULT_VERSION = "DEFAULT";
 
 namespace ovms {
 
+const std::string MODEL_VERSION_HEADER = "OVMS-Model-Version";
+
 const std::string HttpRestApiHandler::predictionRegexExp =
     R"((.?)\/v1\/models\/([^\/:]+)(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?:(classify|regress|predict))";
 const std::string HttpRestApiHandler::modelstatusRegexExp =
@@ -83,6 +90,10 @@ const std::string HttpRestApiHandler::kfs_servermetadataRegexExp =
     R"(/v2)";
 
 const std::string HttpRestApiHandler::metricsRegexExp = R"((.?)\/metrics)";
+const std::string HttpRestApiHandler::modelProfileRegexExp =
+    R"((.?)\/v1\/models\/([^\/:]+)(?:\/versions\/(\d+))?\/profile)";
+const std::string HttpRestApiHandler::batchJobRegexExp = R"((.?)\/v1\/jobs(?:\/([^\/]+))?)";
+const std::string HttpRestApiHandler::batchJobCancelRegexExp = R"((.?)\/v1\/jobs\/([^\/]+)\/cancel)";
 
 HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_ms) :
     predictionRegex(predictionRegexExp),
@@ -96,6 +107,9 @@ HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_
     kfs_serverliveRegex(kfs_serverliveRegexExp),
     kfs_servermetadataRegex(kfs_servermetadataRegexExp),
     metricsRegex(metricsRegexExp),
+    modelProfileRegex(modelProfileRegexExp),
+    batchJobRegex(batchJobRegexExp),
+    batchJobCancelRegex(batchJobCancelRegexExp),
     timeout_in_ms(timeout_in_ms),
     ovmsServer(ovmsServer),
 
@@ -121,6 +135,23 @@ Status HttpRestApiHandler::parseModelVersion(std::string& model_version_str, std
     return StatusCode::OK;
 }
 
+const std::string& HttpRestApiHandler::getTenantHeaderName() const {
+    return this->modelManager.getTenantLimiter().getHeaderName();
+}
+
+void HttpRestApiHandler::parseTenant(HttpRequestComponents& components, const std::vector<std::pair<std::string, std::string>>& headers) const {
+    const std::string& tenantHeader = getTenantHeaderName();
+    if (tenantHeader.empty()) {
+        return;
+    }
+    for (const auto& header : headers) {
+        if (strcasecmp(header.first.c_str(), tenantHeader.c_str()) == 0) {
+            components.tenant = header.second;
+            return;
+        }
+    }
+}
+
 void HttpRestApiHandler::registerHandler(RequestType type, std::function<Status(const HttpRequestComponents&, std::string&, const std::string&)> f) {
     handlers[type] = f;
 }
@@ -129,7 +160,7 @@ void HttpRestApiHandler::registerAll() {
     registerHandler(Predict, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) -> Status {
         if (request_components.processing_method == "predict") {
             return processPredictRequest(request_components.model_name, request_components.model_version,
-                request_components.model_version_label, request_body, &response);
+                request_components.model_version_label, request_body, &response, request_components.tenant);
         } else {
             SPDLOG_DEBUG("Requested REST resource not found");
             return StatusCode::REST_NOT_FOUND;
@@ -168,8 +199,11 @@ void HttpRestApiHandler::registerAll() {
     registerHandler(KFS_GetServerMetadata, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) -> Status {
         return processServerMetadataKFSRequest(request_components, response, request_body);
     });
-    registerHandler(Metrics, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) -> Status {
-        return processMetrics(request_components, response, request_body);
+    registerHandler(ModelProfile, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) -> Status {
+        return processModelProfileRequest(request_components, response, request_body);
+    });
+    registerHandler(BatchJobs, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) -> Status {
+        return processBatchJobRequest(request_components, response, request_body);
     });
 }
 
@@ -473,6 +507,7 @@ Status HttpRestApiHandler::prepareGrpcRequest(const std::string modelName, const
         SPDLOG_DEBUG("Parsing http request failed");
         return status;
     }
+    AllocTrackingScope protoAllocScope(ALLOC_STAGE_PROTO_BUILD);
     grpc_request = requestParser.getProto();
     status = handleBinaryInputs(grpc_request, request_body, endOfJson);
     if (!status.ok()) {
@@ -485,6 +520,48 @@ Status HttpRestApiHandler::prepareGrpcRequest(const std::string modelName, const
     return StatusCode::OK;
 }
 
+void HttpRestApiHandler::parseNumpyFormats(HttpRequestComponents& components, const std::vector<std::pair<std::string, std::string>>& headers) {
+    for (const auto& header : headers) {
+        if (strcasecmp(header.first.c_str(), "Content-Type") == 0) {
+            components.request_format = getNumpyFormat(header.second);
+        } else if (strcasecmp(header.first.c_str(), "Accept") == 0) {
+            components.response_format = getNumpyFormat(header.second);
+        }
+    }
+}
+
+Status HttpRestApiHandler::prepareGrpcRequestFromNumpy(const HttpRequestComponents& request_components, const std::string& request_body, ::inference::ModelInferRequest& grpc_request) {
+    std::string inputName;
+    if (request_components.request_format == NumpyFormat::NPY) {
+        tensor_map_t inputsInfo;
+        if (this->modelManager.modelExists(request_components.model_name)) {
+            auto modelInstance = this->modelManager.findModelInstance(request_components.model_name, request_components.model_version.value_or(0));
+            if (!modelInstance) {
+                return StatusCode::MODEL_VERSION_MISSING;
+            }
+            inputsInfo = modelInstance->getInputsInfo();
+        } else if (auto pipelineDefinition = this->modelManager.getPipelineFactory().findDefinitionByName(request_components.model_name)) {
+            inputsInfo = pipelineDefinition->getInputsInfo();
+        } else {
+            return StatusCode::MODEL_NAME_MISSING;
+        }
+        if (inputsInfo.size() != 1) {
+            return Status(StatusCode::NUMPY_INVALID_FORMAT, "servable with multiple inputs requires " + NPZ_CONTENT_TYPE + " body");
+        }
+        inputName = inputsInfo.begin()->first;
+    }
+    auto status = makeInferRequestFromNumpy(request_body, request_components.request_format, inputName, grpc_request);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Parsing NumPy http request failed: {}", status.string());
+        return status;
+    }
+    grpc_request.set_model_name(request_components.model_name);
+    if (request_components.model_version.has_value()) {
+        grpc_request.set_model_version(std::to_string(request_components.model_version.value()));
+    }
+    return StatusCode::OK;
+}
+
 Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
     Timer<TIMER_END> timer;
     timer.start(TOTAL);
@@ -495,7 +572,7 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     ::inference::ModelInferRequest grpc_request;
     timer.start(PREPARE_GRPC_REQUEST);
     using std::chrono::microseconds;
-    auto status = prepareGrpcRequest(modelName, request_components.model_version, request_body, grpc_request, request_components.inferenceHeaderContentLength);
+    auto status = request_components.request_format != NumpyFormat::NONE ? prepareGrpcRequestFromNumpy(request_components, request_body, grpc_request) : prepareGrpcRequest(modelName, request_components.model_version, request_body, grpc_request, request_components.inferenceHeaderContentLength);
     ExecutionContext executionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelInfer};
     if (!status.ok()) {
         auto pstatus = this->getReporter(request_components, reporter);
@@ -508,13 +585,16 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     timer.stop(PREPARE_GRPC_REQUEST);
     SPDLOG_DEBUG("Preparing grpc request time: {} ms", timer.elapsed<std::chrono::microseconds>(PREPARE_GRPC_REQUEST) / 1000);
     ::inference::ModelInferResponse grpc_response;
-    const Status gstatus = kfsGrpcImpl.ModelInferImpl(nullptr, &grpc_request, &grpc_response, executionContext, reporter);
+    const Status gstatus = kfsGrpcImpl.ModelInferImpl(nullptr, &grpc_request, &grpc_response, executionContext, reporter, request_components.tenant);
     if (!gstatus.ok()) {
         return gstatus;
     }
     std::string output;
-    google::protobuf::util::JsonPrintOptions opts_out;
-    status = ovms::makeJsonFromPredictResponse(grpc_response, &output);
+    if (request_components.response_format != NumpyFormat::NONE) {
+        status = makeNumpyFromInferResponse(grpc_response, request_components.response_format, &output);
+    } else {
+        status = ovms::makeJsonFromPredictResponse(grpc_response, &output);
+    }
     if (!status.ok()) {
         return status;
     }
@@ -526,6 +606,70 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     return StatusCode::OK;
 }
 
+Status HttpRestApiHandler::processInferKFSRequestAsync(const HttpRequestComponents& request_components, const std::string& request_body, const AsyncRestResponseCallback& onAsyncResponse) {
+    const auto started = std::chrono::steady_clock::now();
+    const std::string& modelName = request_components.model_name;
+    SPDLOG_DEBUG("Processing asynchronous REST request for model: {}; version: {}", modelName,
+        request_components.model_version.has_value() ? std::to_string(request_components.model_version.value()) : DEFAULT_VERSION);
+
+    struct AsyncInferContext {
+        ::inference::ModelInferRequest request;
+        ::inference::ModelInferResponse response;
+        std::unique_ptr<TenantQuotaGuard> tenantQuotaGuard;
+    };
+    auto context = std::make_shared<AsyncInferContext>();
+    const ExecutionContext executionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelInfer};
+    std::shared_ptr<ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    auto status = this->modelManager.getModelInstanceForInference(modelName, request_components.model_version.value_or(0), modelInstance, modelInstanceUnloadGuard);
+    if (!status.ok()) {
+        if (modelInstance) {
+            INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+        }
+        SPDLOG_DEBUG("Getting modelInstance failed. {}", status.string());
+        return status;
+    }
+    status = request_components.request_format != NumpyFormat::NONE ? prepareGrpcRequestFromNumpy(request_components, request_body, context->request) : prepareGrpcRequest(modelName, request_components.model_version, request_body, context->request, request_components.inferenceHeaderContentLength);
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+        SPDLOG_DEBUG("REST to GRPC request conversion failed for model: {}", modelName);
+        return status;
+    }
+    status = this->modelManager.getTenantLimiter().acquire(modelName, request_components.tenant, context->tenantQuotaGuard);
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+        return status;
+    }
+
+    status = modelInstance->inferAsync(&context->request, &context->response, modelInstanceUnloadGuard,
+        [this, context, modelInstance, onAsyncResponse, started, executionContext, responseFormat = request_components.response_format](AsyncInferenceFinisher finish) {
+            this->continuationScheduler([context, modelInstance, onAsyncResponse, started, executionContext, responseFormat, finish]() {
+                auto status = finish();
+                context->tenantQuotaGuard.reset();
+                INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
+                std::string output;
+                if (status.ok()) {
+                    context->response.set_id(context->request.id());
+                    if (responseFormat != NumpyFormat::NONE) {
+                        status = makeNumpyFromInferResponse(context->response, responseFormat, &output);
+                    } else {
+                        status = ovms::makeJsonFromPredictResponse(context->response, &output);
+                    }
+                }
+                if (status.ok()) {
+                    double requestTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+                    OBSERVE_IF_ENABLED(modelInstance->getMetricReporter().requestTimeRest, requestTime);
+                    SPDLOG_DEBUG("Total REST request processing time: {} ms", requestTime / 1000);
+                }
+                onAsyncResponse(status, output);
+            });
+        });
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+    }
+    return status;
+}
+
 Status HttpRestApiHandler::dispatchToProcessor(
     const std::string& request_body,
     std::string* response,
@@ -540,7 +684,7 @@ Status HttpRestApiHandler::dispatchToProcessor(
     return StatusCode::UNKNOWN_REQUEST_COMPONENTS_TYPE;
 }
 
-Status HttpRestApiHandler::processMetrics(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+Status HttpRestApiHandler::processMetrics(const HttpRequestComponents& request_components, std::shared_ptr<const std::string>& snapshot) {
     auto module = this->ovmsServer.getModule(METRICS_MODULE_NAME);
     if (nullptr == module) {
         SPDLOG_ERROR("Failed to process metrics - metrics module is missing");
@@ -553,8 +697,78 @@ Status HttpRestApiHandler::processMetrics(const HttpRequestComponents& request_c
     }
 
     auto metricModule = dynamic_cast<const MetricModule*>(module);
-    response = metricModule->getRegistry().collect();
+    snapshot = metricModule->getSnapshot(getMetricExpositionFormat(request_components.accept),
+        std::chrono::milliseconds(metricConfig.scrapeIntervalMs));
+
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processModelProfileRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    std::string modelVersionLog = request_components.model_version.has_value() ? std::to_string(request_components.model_version.value()) : DEFAULT_VERSION;
+    SPDLOG_DEBUG("Processing REST profiling request for model: {}; version: {}", request_components.model_name, modelVersionLog);
+    if (!this->modelManager.modelExists(request_components.model_name)) {
+        return StatusCode::MODEL_NAME_MISSING;
+    }
+    auto modelInstance = this->modelManager.findModelInstance(request_components.model_name, request_components.model_version.value_or(0));
+    if (!modelInstance) {
+        return StatusCode::MODEL_VERSION_MISSING;
+    }
+    if (request_components.http_method == "POST") {
+        // Model version can not be unloaded while profiled model is compiled from it
+        std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+        auto status = this->modelManager.getModelInstance(request_components.model_name, request_components.model_version.value_or(0), modelInstance, modelInstanceUnloadGuard);
+        if (!status.ok()) {
+            return status;
+        }
+        Document doc;
+        doc.Parse(request_body.c_str());
+        if (doc.HasParseError() || !doc.IsObject()) {
+            return StatusCode::PROFILING_INVALID_REQUEST;
+        }
+        auto it = doc.FindMember("requests");
+        if (it == doc.MemberEnd() || !it->value.IsUint() || it->value.GetUint() > ModelProfiler::MAX_SAMPLES) {
+            return Status(StatusCode::PROFILING_INVALID_REQUEST, "requests must be an integer in range 0-" + std::to_string(ModelProfiler::MAX_SAMPLES));
+        }
+        status = modelInstance->startProfiling(it->value.GetUint());
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    response = modelInstance->getProfiler().toJson(modelInstance->getName(), modelInstance->getVersion());
+    return StatusCode::OK;
+}
 
+Status HttpRestApiHandler::processBatchJobRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    auto& batchJobManager = this->modelManager.getBatchJobManager();
+    if (!batchJobManager.isEnabled()) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    std::shared_ptr<BatchJob> job;
+    Status status;
+    if (request_components.http_method == "POST" && request_components.batch_job_cancel) {
+        status = batchJobManager.cancel(request_components.batch_job_id, job);
+    } else if (request_components.http_method == "POST") {
+        BatchJobSpec spec;
+        status = BatchJobSpec::fromJson(request_body, spec);
+        if (!status.ok()) {
+            return status;
+        }
+        status = batchJobManager.submit(spec, job);
+    } else if (!request_components.batch_job_id.empty()) {
+        status = batchJobManager.get(request_components.batch_job_id, job);
+    } else {
+        response = "{\"jobs\": [";
+        const auto jobs = batchJobManager.list();
+        for (size_t i = 0; i < jobs.size(); i++) {
+            response += (i > 0 ? ", " : "") + jobs[i]->toJson();
+        }
+        response += "]}";
+        return StatusCode::OK;
+    }
+    if (!status.ok()) {
+        return status;
+    }
+    response = job->toJson();
     return StatusCode::OK;
 }
 
@@ -670,6 +884,7 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             }
 
             requestComponents.processing_method = sm[5];
+            parseTenant(requestComponents, headers);
 
             return StatusCode::OK;
         }
@@ -684,15 +899,47 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             status = parseInferenceHeaderContentLength(requestComponents, headers);
             if (!status.ok())
                 return status;
+            parseNumpyFormats(requestComponents, headers);
+            parseTenant(requestComponents, headers);
             return StatusCode::OK;
         }
         if (std::regex_match(request_path, sm, configReloadRegex)) {
             requestComponents.type = ConfigReload;
             return StatusCode::OK;
         }
+        if (std::regex_match(request_path, sm, modelProfileRegex)) {
+            requestComponents.type = ModelProfile;
+            requestComponents.model_name = sm[2];
+            std::string model_version_str = sm[3];
+            return parseModelVersion(model_version_str, requestComponents.model_version);
+        }
+        if (std::regex_match(request_path, sm, batchJobCancelRegex)) {
+            requestComponents.type = BatchJobs;
+            requestComponents.batch_job_id = sm[2];
+            requestComponents.batch_job_cancel = true;
+            return StatusCode::OK;
+        }
+        if (std::regex_match(request_path, sm, batchJobRegex)) {
+            if (sm[2].matched) {
+                return StatusCode::REST_UNSUPPORTED_METHOD;
+            }
+            requestComponents.type = BatchJobs;
+            return StatusCode::OK;
+        }
         if (std::regex_match(request_path, sm, modelstatusRegex))
             return StatusCode::REST_UNSUPPORTED_METHOD;
     } else if (http_method == "GET") {
+        if (std::regex_match(request_path, sm, modelProfileRegex)) {
+            requestComponents.type = ModelProfile;
+            requestComponents.model_name = sm[2];
+            std::string model_version_str = sm[3];
+            return parseModelVersion(model_version_str, requestComponents.model_version);
+        }
+        if (std::regex_match(request_path, sm, batchJobRegex)) {
+            requestComponents.type = BatchJobs;
+            requestComponents.batch_job_id = sm[2];
+            return StatusCode::OK;
+        }
         if (std::regex_match(request_path, sm, modelstatusRegex)) {
             requestComponents.model_name = sm[2];
             std::string model_version_str = sm[3];
@@ -751,6 +998,11 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             return StatusCode::REST_UNSUPPORTED_METHOD;
         if (std::regex_match(request_path, sm, metricsRegex)) {
             requestComponents.type = Metrics;
+            for (const auto& header : headers) {
+                if (strcasecmp(header.first.c_str(), "Accept") == 0) {
+                    requestComponents.accept = header.second;
+                }
+            }
             return StatusCode::OK;
         }
     }
@@ -763,7 +1015,41 @@ Status HttpRestApiHandler::processRequest(
     const std::string& request_body,
     std::vector<std::pair<std::string, std::string>>* headers,
     std::string* response) {
+    bool responseDeferred = false;
+    std::shared_ptr<const std::string> sharedResponse;
+    auto status = processRequest(http_method, request_path, request_body, headers, response, sharedResponse, AsyncRestResponseCallback(), responseDeferred);
+    if (sharedResponse) {
+        response->assign(*sharedResponse);
+    }
+    return status;
+}
 
+bool HttpRestApiHandler::canProcessAsync(const HttpRequestComponents& components) const {
+    if (!this->continuationScheduler) {
+        return false;
+    }
+    if (!((components.type == Predict && components.processing_method == "predict") || components.type == KFS_Infer)) {
+        return false;
+    }
+    // Pipelines are executed synchronously
+    auto model = this->modelManager.findModelByName(components.model_name);
+    if (!model) {
+        return false;
+    }
+    // Stateful models require sequence handling implemented only in synchronous inference
+    return !model->isStateful();
+}
+
+Status HttpRestApiHandler::processRequest(
+    const std::string_view http_method,
+    const std::string_view request_path,
+    const std::string& request_body,
+    std::vector<std::pair<std::string, std::string>>* headers,
+    std::string* response,
+    std::shared_ptr<const std::string>& sharedResponse,
+    const AsyncRestResponseCallback& onAsyncResponse,
+    bool& responseDeferred) {
+    responseDeferred = false;
     std::smatch sm;
     std::string request_path_str(request_path);
     if (FileSystem::isPathEscaped(request_path_str)) {
@@ -780,7 +1066,45 @@ Status HttpRestApiHandler::processRequest(
 
     if (!status.ok())
         return status;
-    return dispatchToProcessor(request_body, response, requestComponents);
+    const NumpyFormat responseFormat = requestComponents.type == KFS_Infer ? requestComponents.response_format : NumpyFormat::NONE;
+    if (onAsyncResponse && canProcessAsync(requestComponents)) {
+        AsyncRestResponseCallback onResponse = onAsyncResponse;
+        if (responseFormat != NumpyFormat::NONE) {
+            // Headers are owned by the caller until the response is sent
+            onResponse = [headers, responseFormat, onAsyncResponse](const Status& status, std::string& output) {
+                if (status.ok()) {
+                    headers->front().second = responseFormat == NumpyFormat::NPY ? NPY_CONTENT_TYPE : NPZ_CONTENT_TYPE;
+                }
+                onAsyncResponse(status, output);
+            };
+        }
+        status = requestComponents.type == KFS_Infer ? processInferKFSRequestAsync(requestComponents, request_body, onResponse) : processPredictRequestAsync(requestComponents, request_body, headers, onResponse);
+        responseDeferred = status.ok();
+        return status;
+    }
+    if (requestComponents.type == Predict && requestComponents.processing_method == "predict") {
+        // Served version may differ from requested default one when overload fallback is active
+        model_version_t servedVersion = 0;
+        status = processPredictRequest(requestComponents.model_name, requestComponents.model_version,
+            requestComponents.model_version_label, request_body, response, requestComponents.tenant, &servedVersion);
+        if (status.ok() && servedVersion > 0) {
+            headers->emplace_back(MODEL_VERSION_HEADER, std::to_string(servedVersion));
+        }
+        return status;
+    }
+    if (requestComponents.type == Metrics) {
+        // Snapshot is written to the connection as is, without copying it into response
+        status = processMetrics(requestComponents, sharedResponse);
+        if (status.ok()) {
+            headers->front().second = getMetricContentType(getMetricExpositionFormat(requestComponents.accept));
+        }
+        return status;
+    }
+    status = dispatchToProcessor(request_body, response, requestComponents);
+    if (status.ok() && responseFormat != NumpyFormat::NONE) {
+        headers->front().second = responseFormat == NumpyFormat::NPY ? NPY_CONTENT_TYPE : NPZ_CONTENT_TYPE;
+    }
+    return status;
 }
 
 Status HttpRestApiHandler::processPredictRequest(
@@ -788,7 +1112,9 @@ Status HttpRestApiHandler::processPredictRequest(
     const std::optional<int64_t>& modelVersion,
     const std::optional<std::string_view>& modelVersionLabel,
     const std::string& request,
-    std::string* response) {
+    std::string* response,
+    const std::string& tenant,
+    model_version_t* servedVersion) {
     // model_version_label currently is not in use
 
     Timer<TIMER_END> timer;
@@ -804,6 +1130,14 @@ Status HttpRestApiHandler::processPredictRequest(
     Status status;
 
     ServableMetricReporter* reporterOut = nullptr;
+    std::unique_ptr<TenantQuotaGuard> tenantQuotaGuard;
+    if (this->modelManager.modelExists(modelName) || this->modelManager.pipelineDefinitionExists(modelName)) {
+        status = this->modelManager.getTenantLimiter().acquire(modelName, tenant, tenantQuotaGuard);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Tenant quota check failed. {}", status.string());
+            return status;
+        }
+    }
     if (this->modelManager.modelExists(modelName)) {
         SPDLOG_DEBUG("Found model with name: {}. Searching for requested version...", modelName);
         status = processSingleModelRequest(modelName, modelVersion, request, requestOrder, responseProto, reporterOut);
@@ -819,6 +1153,9 @@ Status HttpRestApiHandler::processPredictRequest(
     if (!reporterOut) {
         return StatusCode::INTERNAL_ERROR;  // should not happen
     }
+    if (servedVersion && responseProto.model_spec().has_version()) {
+        *servedVersion = responseProto.model_spec().version().value();
+    }
 
     status = makeJsonFromPredictResponse(responseProto, response, requestOrder);
     if (!status.ok())
@@ -831,6 +1168,81 @@ Status HttpRestApiHandler::processPredictRequest(
     return StatusCode::OK;
 }
 
+Status HttpRestApiHandler::processPredictRequestAsync(
+    const HttpRequestComponents& request_components,
+    const std::string& request,
+    std::vector<std::pair<std::string, std::string>>* headers,
+    const AsyncRestResponseCallback& onAsyncResponse) {
+    const auto started = std::chrono::steady_clock::now();
+    const std::string& modelName = request_components.model_name;
+    const std::optional<int64_t>& modelVersion = request_components.model_version;
+    SPDLOG_DEBUG("Processing asynchronous REST request for model: {}; version: {}",
+        modelName, modelVersion.has_value() ? std::to_string(modelVersion.value()) : DEFAULT_VERSION);
+
+    struct AsyncPredictContext {
+        tensorflow::serving::PredictRequest request;
+        tensorflow::serving::PredictResponse response;
+        Order requestOrder;
+        std::unique_ptr<TenantQuotaGuard> tenantQuotaGuard;
+    };
+    auto context = std::make_shared<AsyncPredictContext>();
+    auto status = this->modelManager.getTenantLimiter().acquire(modelName, request_components.tenant, context->tenantQuotaGuard);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Tenant quota check failed. {}", status.string());
+        return status;
+    }
+    std::shared_ptr<ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    status = this->modelManager.getModelInstanceForInference(modelName, modelVersion.value_or(0), modelInstance, modelInstanceUnloadGuard);
+    if (!status.ok()) {
+        if (modelInstance) {
+            INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().requestFailRestPredict);
+        }
+        SPDLOG_DEBUG("Requested model instance - name: {}, version: {} - does not exist.", modelName, modelVersion.value_or(0));
+        return status;
+    }
+    TFSRestParser requestParser(modelInstance->getInputsInfo());
+    status = requestParser.parse(request.c_str());
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().requestFailRestPredict);
+        return status;
+    }
+    context->requestOrder = requestParser.getOrder();
+    context->request = std::move(requestParser.getProto());
+    context->request.mutable_model_spec()->set_name(modelName);
+    if (modelVersion.has_value()) {
+        context->request.mutable_model_spec()->mutable_version()->set_value(modelVersion.value());
+    }
+
+    const ExecutionContext executionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::Predict};
+    status = modelInstance->inferAsync(&context->request, &context->response, modelInstanceUnloadGuard,
+        [this, context, modelInstance, headers, onAsyncResponse, started, executionContext](AsyncInferenceFinisher finish) {
+            this->continuationScheduler([context, modelInstance, headers, onAsyncResponse, started, executionContext, finish]() {
+                auto status = finish();
+                context->tenantQuotaGuard.reset();
+                INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
+                std::string output;
+                if (status.ok()) {
+                    status = makeJsonFromPredictResponse(context->response, &output, context->requestOrder);
+                }
+                if (status.ok()) {
+                    // Headers are owned by the caller until the response is sent
+                    headers->emplace_back(MODEL_VERSION_HEADER, std::to_string(context->response.model_spec().version().value()));
+                }
+                if (status.ok()) {
+                    double requestTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+                    OBSERVE_IF_ENABLED(modelInstance->getMetricReporter().requestTimeRest, requestTime);
+                    SPDLOG_DEBUG("Total REST request processing time: {} ms", requestTime / 1000);
+                }
+                onAsyncResponse(status, output);
+            });
+        });
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+    }
+    return status;
+}
+
 Status HttpRestApiHandler::processSingleModelRequest(const std::string& modelName,
     const std::optional<int64_t>& modelVersion,
     const std::string& request,
@@ -840,7 +1252,7 @@ Status HttpRestApiHandler::processSingleModelRequest(const std::string& modelNam
 
     std::shared_ptr<ModelInstance> modelInstance;
     std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
-    auto status = this->modelManager.getModelInstance(
+    auto status = this->modelManager.getModelInstanceForInference(
         modelName,
         modelVersion.value_or(0),
         modelInstance,
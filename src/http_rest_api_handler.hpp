@@ -28,6 +28,7 @@
 #pragma GCC diagnostic pop
 
 #include "modelmanager.hpp"
+#include "numpy_utils.hpp"
 #include "rest_parser.hpp"
 #include "status.hpp"
 
@@ -48,7 +49,24 @@ enum RequestType { Predict,
     KFS_GetServerReady,
     KFS_GetServerLive,
     KFS_GetServerMetadata,
-    Metrics };
+    Metrics,
+    ModelProfile,
+    BatchJobs };
+
+/**
+ * @brief Response header carrying the model version which served TFS REST predict request
+ */
+extern const std::string MODEL_VERSION_HEADER;
+
+/**
+ * @brief Receives status and body of a response completed after processRequest returned
+ */
+using AsyncRestResponseCallback = std::function<void(const Status&, std::string&)>;
+
+/**
+ * @brief Runs continuation of a request on REST worker threads
+ */
+using RestContinuationScheduler = std::function<void(std::function<void()>)>;
 
 struct HttpRequestComponents {
     RequestType type;
@@ -59,6 +77,12 @@ struct HttpRequestComponents {
     std::string processing_method;
     std::string model_subresource;
     std::optional<int> inferenceHeaderContentLength;
+    std::string tenant;
+    std::string accept;
+    std::string batch_job_id;
+    bool batch_job_cancel = false;
+    NumpyFormat request_format = NumpyFormat::NONE;
+    NumpyFormat response_format = NumpyFormat::NONE;
 };
 
 class HttpRestApiHandler {
@@ -73,6 +97,9 @@ public:
     static const std::string kfs_inferRegexExp;
 
     static const std::string metricsRegexExp;
+    static const std::string modelProfileRegexExp;
+    static const std::string batchJobRegexExp;
+    static const std::string batchJobCancelRegexExp;
 
     static const std::string kfs_serverreadyRegexExp;
     static const std::string kfs_serverliveRegexExp;
@@ -90,9 +117,19 @@ public:
         const std::vector<std::pair<std::string, std::string>>& headers = {});
 
     Status parseModelVersion(std::string& model_version_str, std::optional<int64_t>& model_version);
+    void parseTenant(HttpRequestComponents& components, const std::vector<std::pair<std::string, std::string>>& headers) const;
+    const std::string& getTenantHeaderName() const;
     static void parseParams(rapidjson::Value&, rapidjson::Document&);
     static std::string preprocessInferRequest(std::string request_body);
     static Status prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::inference::ModelInferRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength = {});
+    /**
+     * @brief Sets NumPy request and response formats based on Content-Type and Accept headers of KServe infer request
+     */
+    static void parseNumpyFormats(HttpRequestComponents& components, const std::vector<std::pair<std::string, std::string>>& headers);
+    /**
+     * @brief Prepares KServe request from .npy or .npz body. Array of .npy body is fed to the only input of the servable.
+     */
+    Status prepareGrpcRequestFromNumpy(const HttpRequestComponents& request_components, const std::string& request_body, ::inference::ModelInferRequest& grpc_request);
 
     void registerHandler(RequestType type, std::function<Status(const HttpRequestComponents&, std::string&, const std::string&)>);
     void registerAll();
@@ -120,6 +157,29 @@ public:
         std::vector<std::pair<std::string, std::string>>* headers,
         std::string* response);
 
+    /**
+     * @brief Process Request, completing single model inference asynchronously when continuation scheduler is set.
+     * Worker thread is then released while inference runs, and the response is passed to onAsyncResponse
+     * from a continuation scheduled after inference ends.
+     *
+     * @param sharedResponse set instead of response when body is shared with other requests, like metrics snapshot
+     * @param onAsyncResponse
+     * @param responseDeferred set when response will be passed to onAsyncResponse instead of returned
+     *
+     * @return StatusCode
+     */
+    Status processRequest(
+        const std::string_view http_method,
+        const std::string_view request_path,
+        const std::string& request_body,
+        std::vector<std::pair<std::string, std::string>>* headers,
+        std::string* response,
+        std::shared_ptr<const std::string>& sharedResponse,
+        const AsyncRestResponseCallback& onAsyncResponse,
+        bool& responseDeferred);
+
+    void setContinuationScheduler(RestContinuationScheduler scheduler) { continuationScheduler = std::move(scheduler); }
+
     /**
      * @brief Process predict request
      *
@@ -128,6 +188,7 @@ public:
      * @param modelVersionLabel
      * @param request
      * @param response
+     * @param tenant
      *
      * @return StatusCode
      */
@@ -136,7 +197,15 @@ public:
         const std::optional<int64_t>& modelVersion,
         const std::optional<std::string_view>& modelVersionLabel,
         const std::string& request,
-        std::string* response);
+        std::string* response,
+        const std::string& tenant = "",
+        model_version_t* servedVersion = nullptr);
+
+    Status processPredictRequestAsync(
+        const HttpRequestComponents& request_components,
+        const std::string& request,
+        std::vector<std::pair<std::string, std::string>>* headers,
+        const AsyncRestResponseCallback& onAsyncResponse);
 
     Status processSingleModelRequest(
         const std::string& modelName,
@@ -192,7 +261,24 @@ public:
     Status processModelMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processModelReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
-    Status processMetrics(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+    Status processInferKFSRequestAsync(const HttpRequestComponents& request_components, const std::string& request_body, const AsyncRestResponseCallback& onAsyncResponse);
+
+    /**
+     * @brief Returns metrics exposition snapshot, which is shared with concurrent scrapes
+     */
+    Status processMetrics(const HttpRequestComponents& request_components, std::shared_ptr<const std::string>& snapshot);
+
+    /**
+     * @brief Process model profiling request. POST starts profiling of next requests of the model version,
+     * GET returns per layer results of current or last profiling session.
+     */
+    Status processModelProfileRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+
+    /**
+     * @brief Process offline batch job request. POST submits new job or cancels existing one,
+     * GET returns progress of a single job or list of all jobs.
+     */
+    Status processBatchJobRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
 
     Status processServerReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerLiveKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
@@ -213,15 +299,20 @@ private:
     const std::regex kfs_servermetadataRegex;
 
     const std::regex metricsRegex;
+    const std::regex modelProfileRegex;
+    const std::regex batchJobRegex;
+    const std::regex batchJobCancelRegex;
 
     std::map<RequestType, std::function<Status(const HttpRequestComponents&, std::string&, const std::string&)>> handlers;
     int timeout_in_ms;
+    RestContinuationScheduler continuationScheduler;
 
     ovms::Server& ovmsServer;
     ovms::KFSInferenceServiceImpl& kfsGrpcImpl;
     const GetModelMetadataImpl& grpcGetModelMetadataImpl;
     ovms::ModelManager& modelManager;
 
+    bool canProcessAsync(const HttpRequestComponents& components) const;
     Status getReporter(const HttpRequestComponents& components, ovms::ServableMetricReporter*& reporter);
     Status getPipelineInputsAndReporter(const std::string& modelName, ovms::tensor_map_t& inputs, ovms::ServableMetricReporter*& reporter);
 };
@@ -15,7 +15,9 @@
 //*****************************************************************************
 #include "http_server.hpp"
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <utility>
@@ -40,19 +42,41 @@ namespace net_http = tensorflow::serving::net_http;
 
 class RequestExecutor final : public net_http::EventExecutor {
 public:
-    explicit RequestExecutor(int num_threads) :
-        executor_(tensorflow::Env::Default(), "httprestserver", num_threads) {}
+    explicit RequestExecutor(std::shared_ptr<tensorflow::serving::ThreadPoolExecutor> executor) :
+        executor_(std::move(executor)) {}
 
-    void Schedule(std::function<void()> fn) override { executor_.Schedule(fn); }
+    void Schedule(std::function<void()> fn) override { executor_->Schedule(fn); }
 
 private:
-    tensorflow::serving::ThreadPoolExecutor executor_;
+    std::shared_ptr<tensorflow::serving::ThreadPoolExecutor> executor_;
 };
 
+using HttpHeaders = std::vector<std::pair<std::string, std::string>>;
+
 class RestApiRequestDispatcher {
 public:
-    RestApiRequestDispatcher(ovms::Server& ovmsServer, int timeout_in_ms) {
+    RestApiRequestDispatcher(ovms::Server& ovmsServer, int timeout_in_ms, std::shared_ptr<tensorflow::serving::ThreadPoolExecutor> executor, bool asyncInference) :
+        asyncInference(asyncInference) {
         handler_ = std::make_unique<HttpRestApiHandler>(ovmsServer, timeout_in_ms);
+        if (asyncInference) {
+            // Inference completion callbacks resume requests on the same worker pool
+            handler_->setContinuationScheduler([executor](std::function<void()> continuation) {
+                executor->Schedule(std::move(continuation));
+            });
+        }
+    }
+
+    /**
+     * @brief Stops completing new requests asynchronously and waits until responses of the ones in flight are sent.
+     * Has to be called before the worker pool is stopped, since inference callbacks schedule continuations on it.
+     */
+    void drainAsyncRequests() {
+        std::unique_lock<std::mutex> lock(asyncRequestsMtx);
+        acceptAsyncRequests = false;
+        if (pendingAsyncRequests > 0) {
+            SPDLOG_INFO("Waiting for {} asynchronous REST requests to complete", pendingAsyncRequests);
+        }
+        asyncRequestsDrained.wait(lock, [this]() { return pendingAsyncRequests == 0; });
     }
 
     net_http::RequestHandler dispatch(net_http::ServerRequestInterface* req) {
@@ -62,11 +86,38 @@ public:
     }
 
 private:
-    void parseHeaders(const net_http::ServerRequestInterface* req, std::vector<std::pair<std::string, std::string>>* headers) {
+    void parseHeaders(const net_http::ServerRequestInterface* req, HttpHeaders* headers) {
         if (req->GetRequestHeader("Inference-Header-Content-Length").size() > 0) {
             std::pair<std::string, std::string> header{"Inference-Header-Content-Length", req->GetRequestHeader("Inference-Header-Content-Length")};
             headers->emplace_back(header);
         }
+        if (req->GetRequestHeader("Accept").size() > 0) {
+            headers->emplace_back("Accept", req->GetRequestHeader("Accept"));
+        }
+        if (req->GetRequestHeader("Content-Type").size() > 0) {
+            headers->emplace_back("Content-Type", req->GetRequestHeader("Content-Type"));
+        }
+        const std::string& tenantHeader = handler_->getTenantHeaderName();
+        if (!tenantHeader.empty() && req->GetRequestHeader(tenantHeader).size() > 0) {
+            headers->emplace_back(tenantHeader, req->GetRequestHeader(tenantHeader));
+        }
+    }
+    static void sendResponse(net_http::ServerRequestInterface* req, const Status& status, const HttpHeaders& headers, std::string& output, const std::string* sharedOutput = nullptr) {
+        if (!status.ok() && output.empty()) {
+            output.append("{\"error\": \"" + status.string() + "\"}");
+        }
+        const auto http_status = status.http();
+        for (const auto& kv : headers) {
+            req->OverwriteResponseHeader(kv.first, kv.second);
+        }
+        req->WriteResponseString(sharedOutput ? *sharedOutput : output);
+        if (http_status != net_http::HTTPStatusCode::OK && http_status != net_http::HTTPStatusCode::CREATED) {
+            SPDLOG_DEBUG("Processing HTTP/REST request failed: {} {}. Reason: {}",
+                req->http_method(),
+                req->uri_path(),
+                status.string());
+        }
+        req->ReplyWithStatus(http_status);
     }
     void processRequest(net_http::ServerRequestInterface* req) {
         SPDLOG_DEBUG("REST request {}", req->uri_path());
@@ -78,39 +129,81 @@ private:
             request_chunk = req->ReadRequestBytes(&num_bytes);
         }
 
-        std::vector<std::pair<std::string, std::string>> headers;
-        parseHeaders(req, &headers);
+        // Shared with the continuation, which replies when inference is completed asynchronously
+        auto headers = std::make_shared<HttpHeaders>();
+        parseHeaders(req, headers.get());
         std::string output;
+        std::shared_ptr<const std::string> sharedOutput;
         SPDLOG_DEBUG("Processing HTTP request: {} {} body: {} bytes",
             req->http_method(),
             req->uri_path(),
             body.size());
-        const auto status = handler_->processRequest(req->http_method(), req->uri_path(), body, &headers, &output);
-        if (!status.ok() && output.empty()) {
-            output.append("{\"error\": \"" + status.string() + "\"}");
+        bool responseDeferred = false;
+        AsyncRestResponseCallback onAsyncResponse;
+        const bool mayCompleteAsync = beginAsyncRequest();
+        if (mayCompleteAsync) {
+            onAsyncResponse = [this, req, headers](const Status& status, std::string& output) {
+                sendResponse(req, status, *headers, output);
+                this->endAsyncRequest();
+            };
         }
-        const auto http_status = status.http();
-        for (const auto& kv : headers) {
-            req->OverwriteResponseHeader(kv.first, kv.second);
+        const auto status = handler_->processRequest(req->http_method(), req->uri_path(), body, headers.get(), &output,
+            sharedOutput, onAsyncResponse, responseDeferred);
+        if (responseDeferred) {
+            return;
         }
-        req->WriteResponseString(output);
-        if (http_status != net_http::HTTPStatusCode::OK && http_status != net_http::HTTPStatusCode::CREATED) {
-            SPDLOG_DEBUG("Processing HTTP/REST request failed: {} {}. Reason: {}",
-                req->http_method(),
-                req->uri_path(),
-                status.string());
+        sendResponse(req, status, *headers, output, sharedOutput.get());
+        if (mayCompleteAsync) {
+            endAsyncRequest();
+        }
+    }
+
+    bool beginAsyncRequest() {
+        if (!asyncInference) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(asyncRequestsMtx);
+        if (!acceptAsyncRequests) {
+            return false;
+        }
+        ++pendingAsyncRequests;
+        return true;
+    }
+
+    void endAsyncRequest() {
+        std::lock_guard<std::mutex> lock(asyncRequestsMtx);
+        if (--pendingAsyncRequests == 0) {
+            asyncRequestsDrained.notify_all();
         }
-        req->ReplyWithStatus(http_status);
     }
 
     std::unique_ptr<HttpRestApiHandler> handler_;
+    const bool asyncInference;
+    std::mutex asyncRequestsMtx;
+    std::condition_variable asyncRequestsDrained;
+    bool acceptAsyncRequests = true;
+    size_t pendingAsyncRequests = 0;
 };
 
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms) {
+HttpServer::HttpServer(std::unique_ptr<http_server> server, std::shared_ptr<RestApiRequestDispatcher> dispatcher) :
+    server(std::move(server)),
+    dispatcher(std::move(dispatcher)) {}
+
+HttpServer::~HttpServer() = default;
+
+void HttpServer::shutdown() {
+    dispatcher->drainAsyncRequests();
+    server->Terminate();
+    server->WaitForTermination();
+}
+
+std::unique_ptr<HttpServer> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms, bool reuse_port, bool asyncInference) {
     auto options = std::make_unique<net_http::ServerOptions>();
     options->AddPort(static_cast<uint32_t>(port));
     options->SetAddress(address);
-    options->SetExecutor(std::make_unique<RequestExecutor>(num_threads));
+    options->SetReusePort(reuse_port);
+    auto executor = std::make_shared<tensorflow::serving::ThreadPoolExecutor>(tensorflow::Env::Default(), "httprestserver", num_threads);
+    options->SetExecutor(std::make_unique<RequestExecutor>(executor));
 
     auto server = net_http::CreateEvHTTPServer(std::move(options));
     if (server == nullptr) {
@@ -119,7 +212,7 @@ std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address
     }
 
     std::shared_ptr<RestApiRequestDispatcher> dispatcher =
-        std::make_shared<RestApiRequestDispatcher>(ovmsServer, timeout_in_ms);
+        std::make_shared<RestApiRequestDispatcher>(ovmsServer, timeout_in_ms, executor, asyncInference);
 
     net_http::RequestHandlerOptions handler_options;
     server->RegisterRequestDispatcher(
@@ -130,7 +223,7 @@ std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address
 
     if (server->StartAcceptingRequests()) {
         SPDLOG_INFO("REST server listening on port {} with {} threads", port, num_threads);
-        return server;
+        return std::make_unique<HttpServer>(std::move(server), std::move(dispatcher));
     }
 
     return nullptr;
@@ -28,14 +28,36 @@ class Server;
 
 using http_server = tensorflow::serving::net_http::HTTPServerInterface;
 
+class RestApiRequestDispatcher;
+
+/**
+ * @brief REST server together with dispatcher of its requests
+ */
+class HttpServer {
+public:
+    HttpServer(std::unique_ptr<http_server> server, std::shared_ptr<RestApiRequestDispatcher> dispatcher);
+    ~HttpServer();
+
+    /**
+     * @brief Waits for responses of asynchronously completed requests, then terminates the server and its worker pool
+     */
+    void shutdown();
+
+private:
+    std::unique_ptr<http_server> server;
+    std::shared_ptr<RestApiRequestDispatcher> dispatcher;
+};
+
 /**
  * @brief Creates a and starts Http Server
  * 
  * @param port 
  * @param num_threads 
  * @param timeout_in_m not implemented
+ * @param reuse_port listen with SO_REUSEPORT so that other server processes can accept on the same port
+ * @param asyncInference complete predict and infer requests to single models asynchronously
  *  
- * @return std::unique_ptr<http_server> 
+ * @return std::unique_ptr<HttpServer> 
  */
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms = -1);
+std::unique_ptr<HttpServer> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms = -1, bool reuse_port = false, bool asyncInference = false);
 }  // namespace ovms
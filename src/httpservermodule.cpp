@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "config.hpp"
+#include "cpu_topology.hpp"
 #include "http_server.hpp"
 #include "logging.hpp"
 #include "server.hpp"
@@ -33,7 +34,10 @@ int HTTPServerModule::start(const ovms::Config& config) {
     int workers = config.restWorkers() ? config.restWorkers() : 10;
 
     SPDLOG_INFO("Will start {} REST workers", workers);
-    server = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, this->ovmsServer);
+    {
+        ThreadAffinityGuard affinityGuard(CpuTopology::instance().getFrontendCores());
+        server = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, this->ovmsServer, -1, config.workerProcesses() > 1, config.restAsyncInference());
+    }
     if (server == nullptr) {
         SPDLOG_ERROR("Failed to start REST server at " + server_address);
         return EXIT_FAILURE;
@@ -48,8 +52,7 @@ void HTTPServerModule::shutdown() {
         return;
     SPDLOG_INFO("{} shutting down", HTTP_SERVER_MODULE_NAME);
     state = ModuleState::STARTED_SHUTDOWN;
-    server->Terminate();
-    server->WaitForTermination();
+    server->shutdown();
     server.reset();
     SPDLOG_INFO("Shutdown HTTP server");
     state = ModuleState::SHUTDOWN;
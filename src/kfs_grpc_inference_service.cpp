@@ -20,6 +20,8 @@
 #include <string>
 
 #include "deserialization.hpp"
+#include "exit_node.hpp"
+#include "kfs_streamed_upload.hpp"
 #include "metric.hpp"
 #include "modelinstance.hpp"
 #include "modelmanager.hpp"
@@ -56,7 +58,7 @@ Status KFSInferenceServiceImpl::getModelInstance(const ::inference::ModelInferRe
             return StatusCode::MODEL_VERSION_INVALID_FORMAT;
         }
     }
-    return this->modelManager.getModelInstance(request->model_name(), requestedVersion, modelInstance, modelInstanceUnloadGuardPtr);
+    return this->modelManager.getModelInstanceForInference(request->model_name(), requestedVersion, modelInstance, modelInstanceUnloadGuardPtr);
 }
 
 Status KFSInferenceServiceImpl::getPipeline(const ::inference::ModelInferRequest* request,
@@ -66,6 +68,31 @@ Status KFSInferenceServiceImpl::getPipeline(const ::inference::ModelInferRequest
     return this->modelManager.createPipeline(pipelinePtr, request->model_name(), request, response);
 }
 
+Status KFSInferenceServiceImpl::getServableInputsInfo(const ::inference::ModelInferRequest* request, tensor_map_t& inputsInfo) {
+    OVMS_PROFILE_FUNCTION();
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
+    if (status.ok()) {
+        inputsInfo = modelInstance->getInputsInfo();
+        return status;
+    }
+    if (status != StatusCode::MODEL_NAME_MISSING) {
+        return status;
+    }
+    auto pipelineDefinition = this->modelManager.getPipelineFactory().findDefinitionByName(request->model_name());
+    if (!pipelineDefinition) {
+        return StatusCode::MODEL_NAME_MISSING;
+    }
+    std::unique_ptr<PipelineDefinitionUnloadGuard> pipelineUnloadGuard;
+    status = pipelineDefinition->waitForLoaded(pipelineUnloadGuard);
+    if (!status.ok()) {
+        return status;
+    }
+    inputsInfo = pipelineDefinition->getInputsInfo();
+    return StatusCode::OK;
+}
+
 const std::string PLATFORM = "OpenVINO";
 
 ::grpc::Status KFSInferenceServiceImpl::ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) {
@@ -213,7 +240,8 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
         request->model_name(),
         request->model_version());
     ServableMetricReporter* reporter = nullptr;
-    auto status = this->ModelInferImpl(context, request, response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter);
+    std::string tenant = getRequestTenant(context, this->modelManager.getTenantLimiter().getHeaderName());
+    auto status = this->ModelInferImpl(context, request, response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter, tenant);
     timer.stop(TOTAL);
     if (!status.ok()) {
         return status.grpc();
@@ -227,7 +255,112 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
     return status.grpc();
 }
 
-Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::inference::ModelInferResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
+::grpc::Status KFSInferenceServiceImpl::PipelineStreamInfer(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::grpc::ServerWriter<::inference::ModelStreamInferResponse>* writer) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    timer.start(TOTAL);
+    SPDLOG_DEBUG("Processing gRPC streaming request for pipeline: {}; version: {}",
+        request->model_name(),
+        request->model_version());
+    ::inference::ModelStreamInferResponse streamResponse;
+    auto partialResultsCallback = [context, request, writer, &streamResponse](::inference::ModelInferResponse& partialResponse, session_id_t shardId) -> Status {
+        if (context->IsCancelled()) {
+            return StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED;
+        }
+        partialResponse.set_model_name(request->model_name());
+        partialResponse.set_id(request->id());
+        (*partialResponse.mutable_parameters())["shard_id"].set_int64_param(shardId);
+        streamResponse.Clear();
+        streamResponse.mutable_infer_response()->Swap(&partialResponse);
+        if (!writer->Write(streamResponse)) {
+            SPDLOG_DEBUG("Failed to write partial result of shard: {} to the stream", shardId);
+            return StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED;
+        }
+        return StatusCode::OK;
+    };
+    ServableMetricReporter* reporter = nullptr;
+    ::inference::ModelInferResponse response;
+    std::string tenant = getRequestTenant(context, this->modelManager.getTenantLimiter().getHeaderName());
+    auto status = this->ModelInferImpl(context, request, &response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter, tenant, partialResultsCallback);
+    timer.stop(TOTAL);
+    if (status != StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED) {
+        streamResponse.Clear();
+        if (status.ok()) {
+            streamResponse.mutable_infer_response()->Swap(&response);
+        } else {
+            streamResponse.set_error_message(status.string());
+            streamResponse.mutable_infer_response()->set_model_name(request->model_name());
+            streamResponse.mutable_infer_response()->set_id(request->id());
+        }
+        (*streamResponse.mutable_infer_response()->mutable_parameters())["final_response"].set_bool_param(true);
+        writer->Write(streamResponse);
+    }
+    if (!status.ok()) {
+        return status.grpc();
+    }
+    if (!reporter) {
+        return Status(StatusCode::INTERNAL_ERROR).grpc();  // should not happen
+    }
+    double requestTotal = timer.elapsed<std::chrono::microseconds>(TOTAL);
+    SPDLOG_DEBUG("Total gRPC streaming request processing time: {} ms", requestTotal / 1000);
+    OBSERVE_IF_ENABLED(reporter->requestTimeGrpc, requestTotal);
+    return status.grpc();
+}
+
+::grpc::Status KFSInferenceServiceImpl::ModelStreamUpload(::grpc::ServerContext* context, ::grpc::ServerReader<::inference::ModelInferUploadChunk>* reader, ::inference::ModelInferResponse* response) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    timer.start(TOTAL);
+    ::inference::ModelInferRequest request;
+    KFSStreamedRequestAssembler assembler(request);
+    ::inference::ModelInferUploadChunk chunk;
+    Status status;
+    while (reader->Read(&chunk)) {
+        if (chunk.has_header()) {
+            SPDLOG_DEBUG("Processing gRPC streamed upload for model: {}; version: {}",
+                chunk.header().model_name(),
+                chunk.header().model_version());
+            tensor_map_t inputsInfo;
+            status = getServableInputsInfo(&chunk.header(), inputsInfo);
+            if (status.ok()) {
+                status = assembler.setHeader(chunk.header(), inputsInfo, this->maxStreamedUploadBytes);
+            }
+        } else if (!assembler.hasHeader()) {
+            status = StatusCode::STREAMED_UPLOAD_HEADER_MISSING;
+        }
+        if (status.ok() && !chunk.data().empty()) {
+            status = assembler.addChunk(chunk);
+        }
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Streamed upload failed: {}", status.string());
+            return status.grpc();
+        }
+    }
+    if (!assembler.hasHeader()) {
+        return Status(StatusCode::STREAMED_UPLOAD_HEADER_MISSING).grpc();
+    }
+    if (!assembler.isComplete()) {
+        status = Status(StatusCode::STREAMED_UPLOAD_INCOMPLETE, "Missing " + std::to_string(assembler.getRemainingBytes()) + " bytes");
+        SPDLOG_DEBUG("Streamed upload failed: {}", status.string());
+        return status.grpc();
+    }
+    ServableMetricReporter* reporter = nullptr;
+    std::string tenant = getRequestTenant(context, this->modelManager.getTenantLimiter().getHeaderName());
+    status = this->ModelInferImpl(context, &request, response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter, tenant);
+    timer.stop(TOTAL);
+    if (!status.ok()) {
+        return status.grpc();
+    }
+    if (!reporter) {
+        return Status(StatusCode::INTERNAL_ERROR).grpc();  // should not happen
+    }
+    double requestTotal = timer.elapsed<std::chrono::microseconds>(TOTAL);
+    SPDLOG_DEBUG("Total gRPC streamed upload processing time: {} ms", requestTotal / 1000);
+    OBSERVE_IF_ENABLED(reporter->requestTimeGrpc, requestTotal);
+    return status.grpc();
+}
+
+Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::inference::ModelInferResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut, const std::string& tenant, const KFSPartialResultsCallback& partialResultsCallback) {
     OVMS_PROFILE_FUNCTION();
     std::shared_ptr<ovms::ModelInstance> modelInstance;
     std::unique_ptr<ovms::Pipeline> pipelinePtr;
@@ -246,11 +379,21 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
         return status;
     }
 
+    reporterOut = pipelinePtr ? &pipelinePtr->getMetricReporter() : &modelInstance->getMetricReporter();
+    std::unique_ptr<TenantQuotaGuard> tenantQuotaGuard;
+    status = this->modelManager.getTenantLimiter().acquire(request->model_name(), tenant, tenantQuotaGuard);
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(reporterOut->getInferRequestMetric(executionContext, false));
+        return status;
+    }
+
     if (pipelinePtr) {
-        reporterOut = &pipelinePtr->getMetricReporter();
+        if (partialResultsCallback) {
+            // Pipeline created for KServe request always ends with ModelInferResponse exit node
+            static_cast<ExitNode<::inference::ModelInferResponse>&>(pipelinePtr->getExit()).setPartialResultsCallback(partialResultsCallback);
+        }
         status = pipelinePtr->execute(executionContext);
     } else {
-        reporterOut = &modelInstance->getMetricReporter();
         status = modelInstance->infer(request, response, modelInstanceUnloadGuard);
     }
 
@@ -15,16 +15,21 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/sync_stream.h>
 
 #include "execution_context.hpp"
 #include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
 #include "src/kfserving_api/grpc_predict_v2.pb.h"
+#include "session_id.hpp"
 #include "status.hpp"
+#include "tensorinfo.hpp"
 
 namespace ovms {
 
@@ -40,15 +45,20 @@ class Status;
 class TensorInfo;
 class PipelineDefinition;
 
+using KFSPartialResultsCallback = std::function<Status(::inference::ModelInferResponse& partialResponse, session_id_t shardId)>;
+
 class KFSInferenceServiceImpl final : public GRPCInferenceService::Service {
     const Server& ovmsServer;
     ModelManager& modelManager;
+    uint64_t maxStreamedUploadBytes = DEFAULT_MAX_STREAMED_UPLOAD_BYTES;
 
 public:
+    static constexpr uint64_t DEFAULT_MAX_STREAMED_UPLOAD_BYTES = 16ULL * 1024 * 1024 * 1024;
+
     Status ModelReadyImpl(::grpc::ServerContext* context, const ::inference::ModelReadyRequest* request, ::inference::ModelReadyResponse* response, ExecutionContext executionContext);
     Status ServerMetadataImpl(::grpc::ServerContext* context, const ::inference::ServerMetadataRequest* request, ::inference::ServerMetadataResponse* response);
     Status ModelMetadataImpl(::grpc::ServerContext* context, const ::inference::ModelMetadataRequest* request, ::inference::ModelMetadataResponse* response, ExecutionContext executionContext);
-    Status ModelInferImpl(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::inference::ModelInferResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut);
+    Status ModelInferImpl(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::inference::ModelInferResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut, const std::string& tenant = "", const KFSPartialResultsCallback& partialResultsCallback = nullptr);
     KFSInferenceServiceImpl(const Server& server);
     ::grpc::Status ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) override;
     ::grpc::Status ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) override;
@@ -56,6 +66,9 @@ public:
     ::grpc::Status ServerMetadata(::grpc::ServerContext* context, const ::inference::ServerMetadataRequest* request, ::inference::ServerMetadataResponse* response) override;
     ::grpc::Status ModelMetadata(::grpc::ServerContext* context, const ::inference::ModelMetadataRequest* request, ::inference::ModelMetadataResponse* response) override;
     ::grpc::Status ModelInfer(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::inference::ModelInferResponse* response) override;
+    ::grpc::Status PipelineStreamInfer(::grpc::ServerContext* context, const ::inference::ModelInferRequest* request, ::grpc::ServerWriter<::inference::ModelStreamInferResponse>* writer) override;
+    ::grpc::Status ModelStreamUpload(::grpc::ServerContext* context, ::grpc::ServerReader<::inference::ModelInferUploadChunk>* reader, ::inference::ModelInferResponse* response) override;
+    void setMaxStreamedUploadBytes(uint64_t maxBytes) { this->maxStreamedUploadBytes = maxBytes; }
     static Status buildResponse(Model& model, ModelInstance& instance, ::inference::ModelMetadataResponse* response);
     static Status buildResponse(PipelineDefinition& pipelineDefinition, ::inference::ModelMetadataResponse* response);
     static Status buildResponse(std::shared_ptr<ModelInstance> instance, ::inference::ModelReadyResponse* response);
@@ -70,6 +83,7 @@ protected:
     Status getPipeline(const ::inference::ModelInferRequest* request,
         ::inference::ModelInferResponse* response,
         std::unique_ptr<ovms::Pipeline>& pipelinePtr);
+    Status getServableInputsInfo(const ::inference::ModelInferRequest* request, tensor_map_t& inputsInfo);
 };
 
 }  // namespace ovms
@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "kfs_streamed_upload.hpp"
+
+#include <limits>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "logging.hpp"
+#include "precision.hpp"
+
+namespace ovms {
+
+static bool hasContents(const ::inference::InferTensorContents& contents) {
+    return contents.bool_contents_size() || contents.int_contents_size() || contents.int64_contents_size() ||
+           contents.uint_contents_size() || contents.uint64_contents_size() || contents.fp32_contents_size() ||
+           contents.fp64_contents_size() || contents.bytes_contents_size();
+}
+
+/**
+ * @brief Reserves declared size once, when first data of the input arrives, so the buffer is never
+ * reallocated and copied. Pages of large allocation are committed only when chunks are written into them.
+ */
+static void reserveDeclaredSize(std::string& buffer, size_t declaredBytes) {
+    if (buffer.capacity() < declaredBytes) {
+        buffer.reserve(declaredBytes);
+    }
+}
+
+Status KFSStreamedRequestAssembler::setHeader(const ::inference::ModelInferRequest& header, const tensor_map_t& inputsInfo, uint64_t maxBytes) {
+    if (headerReceived) {
+        return Status(StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, "Request header sent more than once");
+    }
+    if (header.raw_input_contents_size() > 0) {
+        return Status(StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, "Request header must not carry raw_input_contents");
+    }
+    uint64_t totalBytes = 0;
+    std::vector<size_t> declaredBytes;
+    declaredBytes.reserve(header.inputs_size());
+    for (const auto& input : header.inputs()) {
+        auto it = inputsInfo.find(input.name());
+        if (it == inputsInfo.end()) {
+            std::stringstream ss;
+            ss << "Unexpected input: " << input.name();
+            SPDLOG_DEBUG("[servable name: {} version: {}] Streamed upload header validation failed - {}", header.model_name(), header.model_version(), ss.str());
+            return Status(StatusCode::INVALID_MISSING_INPUT, ss.str());
+        }
+        if (hasContents(input.contents())) {
+            std::stringstream ss;
+            ss << "Request header must not carry contents of input: " << input.name();
+            return Status(StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, ss.str());
+        }
+        if (input.datatype() == "BYTES") {
+            std::stringstream ss;
+            ss << "BYTES datatype can not be uploaded in chunks; input name: " << input.name();
+            return Status(StatusCode::INVALID_PRECISION, ss.str());
+        }
+        if (KFSPrecisionToOvmsPrecision(input.datatype()) != it->second->getPrecision()) {
+            std::stringstream ss;
+            ss << "Expected: " << it->second->getPrecisionAsKFSPrecision()
+               << "; Actual: " << input.datatype()
+               << "; input name: " << input.name();
+            SPDLOG_DEBUG("[servable name: {} version: {}] Streamed upload header validation failed - {}", header.model_name(), header.model_version(), ss.str());
+            return Status(StatusCode::INVALID_PRECISION, ss.str());
+        }
+        uint64_t inputBytes = KFSDataTypeSize(input.datatype());
+        for (const auto dim : input.shape()) {
+            if (dim < 0) {
+                std::stringstream ss;
+                ss << "Negative dimension in shape of input: " << input.name();
+                return Status(StatusCode::INVALID_SHAPE, ss.str());
+            }
+            if (dim > 0 && inputBytes > std::numeric_limits<uint64_t>::max() / dim) {
+                std::stringstream ss;
+                ss << "Shape size overflow; input name: " << input.name();
+                return Status(StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED, ss.str());
+            }
+            inputBytes *= dim;
+        }
+        if (inputBytes > maxBytes || totalBytes > maxBytes - inputBytes) {
+            std::stringstream ss;
+            ss << "Limit: " << maxBytes << " bytes; input name: " << input.name();
+            SPDLOG_DEBUG("[servable name: {} version: {}] Streamed upload header validation failed - {}", header.model_name(), header.model_version(), ss.str());
+            return Status(StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED, ss.str());
+        }
+        totalBytes += inputBytes;
+        declaredBytes.push_back(inputBytes);
+    }
+
+    request = header;
+    // Buffers are reserved with first chunk of each input, so header alone does not allocate memory
+    for (size_t i = 0; i < declaredBytes.size(); ++i) {
+        request.add_raw_input_contents();
+    }
+    expectedBytes = std::move(declaredBytes);
+    remainingBytes = totalBytes;
+    headerReceived = true;
+    SPDLOG_DEBUG("Streamed upload for servable: {}; version: {} expects {} bytes in {} inputs", header.model_name(), header.model_version(), totalBytes, expectedBytes.size());
+    return StatusCode::OK;
+}
+
+Status KFSStreamedRequestAssembler::addChunk(const ::inference::ModelInferUploadChunk& chunk) {
+    if (!headerReceived) {
+        return StatusCode::STREAMED_UPLOAD_HEADER_MISSING;
+    }
+    if (chunk.input_index() >= expectedBytes.size()) {
+        std::stringstream ss;
+        ss << "Input index: " << chunk.input_index() << " out of range; header declares " << expectedBytes.size() << " inputs";
+        return Status(StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, ss.str());
+    }
+    std::string& buffer = *request.mutable_raw_input_contents(chunk.input_index());
+    if (chunk.offset() != buffer.size()) {
+        std::stringstream ss;
+        ss << "Expected offset: " << buffer.size() << "; Actual: " << chunk.offset() << "; input name: " << request.inputs(chunk.input_index()).name();
+        return Status(StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, ss.str());
+    }
+    if (chunk.data().size() > expectedBytes[chunk.input_index()] - buffer.size()) {
+        std::stringstream ss;
+        ss << "Data exceeds declared size: " << expectedBytes[chunk.input_index()] << " bytes; input name: " << request.inputs(chunk.input_index()).name();
+        return Status(StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, ss.str());
+    }
+    try {
+        reserveDeclaredSize(buffer, expectedBytes[chunk.input_index()]);
+        buffer.append(chunk.data());
+    } catch (const std::bad_alloc&) {
+        SPDLOG_DEBUG("Could not allocate buffer of streamed upload for input: {}", request.inputs(chunk.input_index()).name());
+        return StatusCode::STREAMED_UPLOAD_ALLOCATION_FAILED;
+    }
+    remainingBytes -= chunk.data().size();
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
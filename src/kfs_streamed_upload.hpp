@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "src/kfserving_api/grpc_predict_v2.pb.h"
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Assembles ModelInferRequest from ModelStreamUpload chunks. Input buffers are created
+ * in raw_input_contents once the header is validated, and chunks are appended to them directly.
+ * Each buffer is reserved with the size declared in the header when its first chunk arrives and is never reallocated.
+ * Assembled request is deserialized with zero copy as any other request with raw_input_contents,
+ * so the data is kept in memory only once.
+ */
+class KFSStreamedRequestAssembler {
+    ::inference::ModelInferRequest& request;
+    std::vector<size_t> expectedBytes;
+    size_t remainingBytes = 0;
+    bool headerReceived = false;
+
+public:
+    KFSStreamedRequestAssembler(::inference::ModelInferRequest& request) :
+        request(request) {}
+
+    /**
+     * @brief Validates declared inputs against servable inputs and creates their buffers
+     *
+     * @param header request without tensor data
+     * @param inputsInfo inputs of the model or pipeline the request is directed to
+     * @param maxBytes limit of total declared size of inputs
+     */
+    Status setHeader(const ::inference::ModelInferRequest& header, const tensor_map_t& inputsInfo, uint64_t maxBytes);
+
+    /**
+     * @brief Appends chunk data to the buffer of the input
+     */
+    Status addChunk(const ::inference::ModelInferUploadChunk& chunk);
+
+    bool hasHeader() const { return headerReceived; }
+    bool isComplete() const { return headerReceived && remainingBytes == 0; }
+    size_t getRemainingBytes() const { return remainingBytes; }
+};
+
+}  // namespace ovms
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "load_phase_profiler.hpp"
+
+#include <algorithm>
+
+namespace ovms {
+
+const char* toString(LoadPhase phase) {
+    switch (phase) {
+    case LoadPhase::READ:
+        return "read";
+    case LoadPhase::RESHAPE:
+        return "reshape";
+    case LoadPhase::COMPILE:
+        return "compile";
+    case LoadPhase::INFER_REQUESTS_CREATION:
+        return "infer_requests_creation";
+    case LoadPhase::PIPELINE_VALIDATION:
+        return "pipeline_validation";
+    case LoadPhase::CUSTOM_NODE_LIBRARY_LOADING:
+        return "custom_node_library_loading";
+    case LoadPhase::PHASES_COUNT:
+        break;
+    }
+    return "unknown";
+}
+
+LoadPhaseProfiler& LoadPhaseProfiler::instance() {
+    static LoadPhaseProfiler instance;
+    return instance;
+}
+
+void LoadPhaseProfiler::record(LoadPhase phase, double ms) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& phaseStatistics = statistics[static_cast<size_t>(phase)];
+    phaseStatistics.count++;
+    phaseStatistics.totalMs += ms;
+    phaseStatistics.maxMs = std::max(phaseStatistics.maxMs, ms);
+}
+
+LoadPhaseStatistics LoadPhaseProfiler::getStatistics(LoadPhase phase) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics[static_cast<size_t>(phase)];
+}
+
+void LoadPhaseProfiler::reset() {
+    std::lock_guard<std::mutex> lock(mtx);
+    statistics.fill(LoadPhaseStatistics());
+}
+
+ScopedLoadPhaseTimer::~ScopedLoadPhaseTimer() {
+    LoadPhaseProfiler::instance().record(phase,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+}  // namespace ovms
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace ovms {
+
+enum class LoadPhase {
+    READ,
+    RESHAPE,
+    COMPILE,
+    INFER_REQUESTS_CREATION,
+    PIPELINE_VALIDATION,
+    CUSTOM_NODE_LIBRARY_LOADING,
+    PHASES_COUNT
+};
+
+const char* toString(LoadPhase phase);
+
+struct LoadPhaseStatistics {
+    uint64_t count = 0;
+    double totalMs = 0;
+    double maxMs = 0;
+};
+
+/**
+ * @brief Accumulates time spent in phases of servables loading, across all models and pipelines.
+ * Used to break down server startup and config reload time.
+ */
+class LoadPhaseProfiler {
+    std::array<LoadPhaseStatistics, static_cast<size_t>(LoadPhase::PHASES_COUNT)> statistics;
+    mutable std::mutex mtx;
+
+    LoadPhaseProfiler() = default;
+
+public:
+    static LoadPhaseProfiler& instance();
+
+    void record(LoadPhase phase, double ms);
+    LoadPhaseStatistics getStatistics(LoadPhase phase) const;
+    void reset();
+};
+
+/**
+ * @brief Records time from construction to destruction as given phase
+ */
+class ScopedLoadPhaseTimer {
+    const LoadPhase phase;
+    const std::chrono::steady_clock::time_point start;
+
+public:
+    ScopedLoadPhaseTimer(LoadPhase phase) :
+        phase(phase),
+        start(std::chrono::steady_clock::now()) {}
+    ~ScopedLoadPhaseTimer();
+};
+
+}  // namespace ovms
@@ -31,6 +31,8 @@ namespace ovms {
 namespace fs = std::filesystem;
 constexpr uint64_t NANOS_PER_SECOND = 1000000000;
 
+const size_t LocalFileSystem::READ_CHUNK_SIZE = 1024 * 1024;
+
 const std::vector<std::string> FileSystem::acceptedFiles = {".bin", ".onnx", ".xml", "mapping_config.json", ".pdiparams", ".pdmodel"};
 
 StatusCode LocalFileSystem::fileExists(const std::string& path, bool* exists) {
@@ -138,6 +140,35 @@ StatusCode LocalFileSystem::readTextFile(const std::string& path, std::string* c
     return StatusCode::OK;
 }
 
+StatusCode LocalFileSystem::readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) {
+    if (isPathEscaped(path)) {
+        SPDLOG_ERROR("Path {} escape with .. is forbidden.", path);
+        return StatusCode::PATH_INVALID;
+    }
+    std::ifstream input(path, std::ios::in | std::ios::binary);
+    if (!input) {
+        SPDLOG_DEBUG("Couldn't access path {}", path);
+        return StatusCode::PATH_INVALID;
+    }
+
+    std::vector<char> buffer(READ_CHUNK_SIZE);
+    while (input) {
+        input.read(buffer.data(), buffer.size());
+        if (input.gcount() > 0) {
+            auto status = consumer(buffer.data(), input.gcount());
+            if (status != StatusCode::OK) {
+                return status;
+            }
+        }
+    }
+    if (!input.eof()) {
+        SPDLOG_ERROR("Failed to read file {}", path);
+        return StatusCode::FILE_INVALID;
+    }
+
+    return StatusCode::OK;
+}
+
 StatusCode LocalFileSystem::downloadFileFolder(const std::string& path, const std::string& local_path) {
     // For LocalFileSystem there is no need to download
     return StatusCode::OK;
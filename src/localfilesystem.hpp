@@ -85,6 +85,15 @@ public:
      */
     StatusCode readTextFile(const std::string& path, std::string* contents) override;
 
+    /**
+     * @brief Read the content of the given file in consecutive chunks
+     * 
+     * @param path 
+     * @param consumer 
+     * @return StatusCode 
+     */
+    StatusCode readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) override;
+
     /**
      * @brief Download a remote directory
      * 
@@ -111,6 +120,8 @@ public:
      * @return StatusCode 
      */
     StatusCode deleteFileFolder(const std::string& path) override;
+
+    static const size_t READ_CHUNK_SIZE;
 };
 
 }  // namespace ovms
@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "memory_accounting.hpp"
+
+#include <fstream>
+#include <map>
+
+#include <openvino/op/constant.hpp>
+#include <openvino/runtime/intel_gpu/properties.hpp>
+#include <unistd.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+uint64_t getProcessRssBytes() {
+    std::ifstream statm("/proc/self/statm");
+    uint64_t sizePages = 0, residentPages = 0;
+    if (!(statm >> sizePages >> residentPages)) {
+        return 0;
+    }
+    return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+uint64_t getModelWeightsBytes(const std::shared_ptr<const ov::Model>& model) {
+    if (!model) {
+        return 0;
+    }
+    uint64_t bytes = 0;
+    for (const auto& op : model->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<const ov::op::v0::Constant>(op)) {
+            bytes += constant->get_byte_size();
+        }
+    }
+    return bytes;
+}
+
+uint64_t getInferRequestTensorsBytes(ov::InferRequest& inferRequest, const ov::CompiledModel& compiledModel) {
+    uint64_t bytes = 0;
+    try {
+        for (const auto& input : compiledModel.inputs()) {
+            bytes += inferRequest.get_tensor(input).get_byte_size();
+        }
+        for (const auto& output : compiledModel.outputs()) {
+            bytes += inferRequest.get_tensor(output).get_byte_size();
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("Could not read infer request tensors size: {}", e.what());
+    }
+    return bytes;
+}
+
+CompiledModelMemoryProbe::CompiledModelMemoryProbe(ov::Core& ieCore, const std::string& targetDevice) :
+    ieCore(ieCore),
+    targetDevice(targetDevice) {
+    if (targetDevice.rfind("GPU", 0) == 0) {
+        try {
+            ieCore.get_property(targetDevice, ov::intel_gpu::memory_statistics);
+            useDeviceStatistics = true;
+        } catch (const ov::Exception& e) {
+            SPDLOG_DEBUG("Device: {} memory statistics are not available: {}", targetDevice, e.what());
+        }
+    }
+    startBytes = readBytes();
+}
+
+uint64_t CompiledModelMemoryProbe::readBytes() {
+    if (!useDeviceStatistics) {
+        return getProcessRssBytes();
+    }
+    uint64_t bytes = 0;
+    try {
+        for (const auto& [type, size] : ieCore.get_property(targetDevice, ov::intel_gpu::memory_statistics)) {
+            bytes += size;
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("Device: {} memory statistics are not available: {}", targetDevice, e.what());
+    }
+    return bytes;
+}
+
+uint64_t CompiledModelMemoryProbe::getAllocatedBytes() {
+    uint64_t endBytes = readBytes();
+    return endBytes > startBytes ? endBytes - startBytes : 0;
+}
+
+}  // namespace ovms
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <openvino/openvino.hpp>
+
+namespace ovms {
+
+/**
+ * @brief Memory held by a single model version, in bytes
+ */
+struct ModelMemoryUsage {
+    uint64_t weights = 0;        // constants of ov::Model kept by the model instance
+    uint64_t compiledModel = 0;  // growth of process RSS or device memory while compiling the model
+    uint64_t inferRequests = 0;  // input & output tensors of all infer requests (nireq)
+
+    uint64_t total() const {
+        return weights + compiledModel + inferRequests;
+    }
+};
+
+/**
+ * @brief Resident set size of the process read from /proc/self/statm, 0 when not available
+ */
+uint64_t getProcessRssBytes();
+
+/**
+ * @brief Sum of byte sizes of all Constant nodes of the model
+ */
+uint64_t getModelWeightsBytes(const std::shared_ptr<const ov::Model>& model);
+
+/**
+ * @brief Sum of byte sizes of input & output tensors currently set in infer request. Tensors of
+ * dynamic shape inputs are allocated on first inference, so those are counted as 0.
+ */
+uint64_t getInferRequestTensorsBytes(ov::InferRequest& inferRequest, const ov::CompiledModel& compiledModel);
+
+/**
+ * @brief Measures memory allocated while compiling a model. For GPU devices device memory statistics
+ * reported by the plugin are used, for other devices growth of process RSS. Measurement is an estimate,
+ * since other threads may allocate or release memory at the same time.
+ */
+class CompiledModelMemoryProbe {
+    ov::Core& ieCore;
+    std::string targetDevice;
+    bool useDeviceStatistics = false;
+    uint64_t startBytes = 0;
+
+    uint64_t readBytes();
+
+public:
+    CompiledModelMemoryProbe(ov::Core& ieCore, const std::string& targetDevice);
+    uint64_t getAllocatedBytes();
+};
+
+}  // namespace ovms
@@ -63,6 +63,12 @@ Status MetricConfig::parseMetricsConfig(const rapidjson::Value& metrics, bool fo
         endpointsPath = "/metrics";
     }
 
+    if (v.HasMember("scrape_interval_ms")) {
+        this->scrapeIntervalMs = v["scrape_interval_ms"].GetUint();
+    } else {
+        this->scrapeIntervalMs = DEFAULT_METRICS_SCRAPE_INTERVAL_MS;
+    }
+
     if (v.HasMember("metrics_list")) {
         status = parseMetricsArray(v["metrics_list"]);
     } else {
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -24,6 +25,8 @@
 #include "status.hpp"
 
 namespace ovms {
+const uint32_t DEFAULT_METRICS_SCRAPE_INTERVAL_MS = 1000;
+
 /**
      * @brief This class represents metrics configuration
      */
@@ -31,6 +34,8 @@ class MetricConfig {
 public:
     bool metricsEnabled;
     std::string endpointsPath;
+    // Maximum age of served metrics snapshot, 0 regenerates exposition on every scrape
+    uint32_t scrapeIntervalMs;
 
     Status parseMetricsConfig(const rapidjson::Value& v, bool forceFailureIfMetricsAreEnabled = false);
     bool isFamilyEnabled(const std::string& family) const;
@@ -41,6 +46,7 @@ public:
     MetricConfig() {
         metricsEnabled = false;
         endpointsPath = "/metrics";
+        scrapeIntervalMs = DEFAULT_METRICS_SCRAPE_INTERVAL_MS;
 
         setDefaultMetricsTo(metricsEnabled);
     }
@@ -48,6 +54,7 @@ public:
     MetricConfig(bool enabled) {
         metricsEnabled = enabled;
         endpointsPath = "/metrics";
+        scrapeIntervalMs = DEFAULT_METRICS_SCRAPE_INTERVAL_MS;
 
         setDefaultMetricsTo(metricsEnabled);
     }
@@ -61,7 +68,19 @@ private:
 
     std::unordered_set<std::string> additionalMetricFamilies = {
         {"ovms_infer_req_queue_size"},
-        {"ovms_infer_req_active"}};
+        {"ovms_infer_req_active"},
+        {"ovms_infer_req_waiting"},
+        {"ovms_infer_req_busy_time_us"},
+        {"ovms_inference_batch_size"},
+        {"ovms_dag_executor_threads"},
+        {"ovms_dag_deferred_node_sessions"},
+        {"ovms_hw_events"},
+        {"ovms_memory_bytes"},
+        {"ovms_allocations"},
+        {"ovms_allocated_bytes"},
+        {"ovms_tenant_requests_admitted"},
+        {"ovms_tenant_requests_rejected"},
+        {"ovms_tenant_current_requests"}};
 
     std::unordered_set<std::string> defaultMetricFamilies = {
         {"ovms_current_requests"},
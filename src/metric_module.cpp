@@ -21,11 +21,25 @@
 namespace ovms {
 
 MetricModule::MetricModule() :
-    registry(std::make_unique<MetricRegistry>()) {}
+    registry(std::make_unique<MetricRegistry>()),
+    snapshotCollector(std::make_unique<MetricSnapshotCollector>(*registry)) {}
 
-int MetricModule::start(const Config& config) { return EXIT_SUCCESS; }
+MetricModule::~MetricModule() {
+    this->shutdown();
+}
 
-void MetricModule::shutdown() {}
+int MetricModule::start(const Config& config) {
+    this->snapshotCollector->start();
+    return EXIT_SUCCESS;
+}
+
+void MetricModule::shutdown() {
+    this->snapshotCollector->stop();
+}
 
 MetricRegistry& MetricModule::getRegistry() const { return *this->registry; }
+
+std::shared_ptr<const std::string> MetricModule::getSnapshot(MetricExpositionFormat format, std::chrono::milliseconds maxAge) const {
+    return this->snapshotCollector->getSnapshot(format, maxAge);
+}
 }  // namespace ovms
@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <chrono>
 #include <memory>
+#include <string>
 
 #include "metric_registry.hpp"
+#include "metric_snapshot_collector.hpp"
 #include "server.hpp"
 
 namespace ovms {
@@ -26,12 +29,19 @@ class Config;
 class MetricModule : public Module {
 protected:
     std::unique_ptr<MetricRegistry> registry;
+    std::unique_ptr<MetricSnapshotCollector> snapshotCollector;
 
 public:
     MetricModule();
+    ~MetricModule();
     int start(const Config& config) override;
     void shutdown() override;
 
     MetricRegistry& getRegistry() const;
+
+    /**
+     * @brief Returns metrics exposition regenerated no earlier than maxAge ago
+     */
+    std::shared_ptr<const std::string> getSnapshot(MetricExpositionFormat format, std::chrono::milliseconds maxAge) const;
 };
 }  // namespace ovms
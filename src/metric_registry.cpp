@@ -15,7 +15,14 @@
 //*****************************************************************************
 #include "metric_registry.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
 #include <prometheus/family.h>
+#include <prometheus/metric_family.h>
 #include <prometheus/text_serializer.h>
 
 #include "metric.hpp"
@@ -23,6 +30,192 @@
 
 namespace ovms {
 
+const std::string METRICS_TEXT_CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
+const std::string METRICS_PROTOBUF_CONTENT_TYPE = "application/vnd.google.protobuf; proto=io.prometheus.client.MetricFamily; encoding=delimited";
+
+MetricExpositionFormat getMetricExpositionFormat(const std::string& acceptHeader) {
+    if (acceptHeader.find("application/vnd.google.protobuf") != std::string::npos &&
+        acceptHeader.find("proto=io.prometheus.client.MetricFamily") != std::string::npos) {
+        return MetricExpositionFormat::PROTOBUF_DELIMITED;
+    }
+    return MetricExpositionFormat::TEXT;
+}
+
+const std::string& getMetricContentType(MetricExpositionFormat format) {
+    return format == MetricExpositionFormat::PROTOBUF_DELIMITED ? METRICS_PROTOBUF_CONTENT_TYPE : METRICS_TEXT_CONTENT_TYPE;
+}
+
+namespace {
+// Appends everything written to the stream into existing string without intermediate copies
+class StringAppendBuffer : public std::streambuf {
+    std::string& output;
+
+public:
+    StringAppendBuffer(std::string& output) :
+        output(output) {}
+
+protected:
+    int_type overflow(int_type c) override {
+        if (c != traits_type::eof()) {
+            output.push_back(traits_type::to_char_type(c));
+        }
+        return c;
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        output.append(s, n);
+        return n;
+    }
+};
+
+// Minimal encoder of io.prometheus.client metrics.proto messages
+enum WireType : uint32_t {
+    VARINT = 0,
+    FIXED64 = 1,
+    LENGTH_DELIMITED = 2
+};
+
+// io.prometheus.client.MetricType
+enum ProtoMetricType : uint64_t {
+    PROTO_COUNTER = 0,
+    PROTO_GAUGE = 1,
+    PROTO_SUMMARY = 2,
+    PROTO_UNTYPED = 3,
+    PROTO_HISTOGRAM = 4
+};
+
+void writeVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void writeTag(std::string& out, uint32_t field, WireType wireType) {
+    writeVarint(out, (static_cast<uint64_t>(field) << 3) | wireType);
+}
+
+void writeUint64(std::string& out, uint32_t field, uint64_t value) {
+    writeTag(out, field, VARINT);
+    writeVarint(out, value);
+}
+
+void writeDouble(std::string& out, uint32_t field, double value) {
+    static_assert(sizeof(double) == sizeof(uint64_t), "unsupported double size");
+    writeTag(out, field, FIXED64);
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>(bits & 0xFF));
+        bits >>= 8;
+    }
+}
+
+void writeBytes(std::string& out, uint32_t field, const std::string& value) {
+    writeTag(out, field, LENGTH_DELIMITED);
+    writeVarint(out, value.size());
+    out.append(value);
+}
+
+ProtoMetricType toProtoMetricType(prometheus::MetricType type) {
+    switch (type) {
+    case prometheus::MetricType::Counter:
+        return PROTO_COUNTER;
+    case prometheus::MetricType::Gauge:
+        return PROTO_GAUGE;
+    case prometheus::MetricType::Summary:
+        return PROTO_SUMMARY;
+    case prometheus::MetricType::Histogram:
+        return PROTO_HISTOGRAM;
+    default:
+        return PROTO_UNTYPED;
+    }
+}
+
+// Scratch buffers reused between encoded messages, so that nested message lengths can be written
+// before their content without allocating for every sample
+struct ProtobufScratch {
+    std::string family;
+    std::string metric;
+    std::string value;
+    std::string entry;
+};
+
+void serializeMetric(const prometheus::ClientMetric& metric, prometheus::MetricType type, ProtobufScratch& scratch) {
+    std::string& out = scratch.metric;
+    std::string& value = scratch.value;
+    std::string& entry = scratch.entry;
+    out.clear();
+    for (const auto& label : metric.label) {
+        entry.clear();
+        writeBytes(entry, 1, label.name);
+        writeBytes(entry, 2, label.value);
+        writeBytes(out, 1, entry);
+    }
+    value.clear();
+    switch (type) {
+    case prometheus::MetricType::Counter:
+        writeDouble(value, 1, metric.counter.value);
+        writeBytes(out, 3, value);
+        break;
+    case prometheus::MetricType::Gauge:
+        writeDouble(value, 1, metric.gauge.value);
+        writeBytes(out, 2, value);
+        break;
+    case prometheus::MetricType::Summary:
+        writeUint64(value, 1, metric.summary.sample_count);
+        writeDouble(value, 2, metric.summary.sample_sum);
+        for (const auto& quantile : metric.summary.quantile) {
+            entry.clear();
+            writeDouble(entry, 1, quantile.quantile);
+            writeDouble(entry, 2, quantile.value);
+            writeBytes(value, 3, entry);
+        }
+        writeBytes(out, 4, value);
+        break;
+    case prometheus::MetricType::Histogram:
+        writeUint64(value, 1, metric.histogram.sample_count);
+        writeDouble(value, 2, metric.histogram.sample_sum);
+        for (const auto& bucket : metric.histogram.bucket) {
+            entry.clear();
+            writeUint64(entry, 1, bucket.cumulative_count);
+            writeDouble(entry, 2, bucket.upper_bound);
+            writeBytes(value, 3, entry);
+        }
+        writeBytes(out, 7, value);
+        break;
+    default:
+        writeDouble(value, 1, metric.untyped.value);
+        writeBytes(out, 5, value);
+        break;
+    }
+    if (metric.timestamp_ms != 0) {
+        writeUint64(out, 6, static_cast<uint64_t>(metric.timestamp_ms));
+    }
+}
+
+// Writes each MetricFamily message prefixed with its varint encoded length,
+// as expected by Prometheus for "encoding=delimited"
+void serializeProtobufDelimited(const std::vector<prometheus::MetricFamily>& families, std::string& output) {
+    ProtobufScratch scratch;
+    for (const auto& family : families) {
+        std::string& out = scratch.family;
+        out.clear();
+        writeBytes(out, 1, family.name);
+        if (!family.help.empty()) {
+            writeBytes(out, 2, family.help);
+        }
+        writeUint64(out, 3, toProtoMetricType(family.type));
+        for (const auto& metric : family.metric) {
+            serializeMetric(metric, family.type, scratch);
+            writeBytes(out, 4, scratch.metric);
+        }
+        writeVarint(output, out.size());
+        output.append(out);
+    }
+}
+}  // namespace
+
 MetricRegistry::MetricRegistry() = default;
 
 std::string MetricRegistry::collect() const {
@@ -30,6 +223,19 @@ std::string MetricRegistry::collect() const {
     return serializer.Serialize(this->registryImpl.Collect());
 }
 
+void MetricRegistry::collect(std::string& output, MetricExpositionFormat format) const {
+    output.clear();
+    auto families = this->registryImpl.Collect();
+    if (format == MetricExpositionFormat::PROTOBUF_DELIMITED) {
+        serializeProtobufDelimited(families, output);
+        return;
+    }
+    StringAppendBuffer buffer(output);
+    std::ostream stream(&buffer);
+    prometheus::TextSerializer serializer;
+    serializer.Serialize(stream, families);
+}
+
 template <>
 bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricCounter>> family) {
     return this->registryImpl.Remove(*static_cast<prometheus::Family<prometheus::Counter>*>(family->familyImplRef));
@@ -22,6 +22,22 @@
 
 namespace ovms {
 
+enum class MetricExpositionFormat {
+    TEXT,
+    PROTOBUF_DELIMITED
+};
+
+extern const std::string METRICS_TEXT_CONTENT_TYPE;
+extern const std::string METRICS_PROTOBUF_CONTENT_TYPE;
+
+/**
+ * @brief Selects exposition format requested by scraper in Accept header.
+ * Prometheus asks for delimited protobuf with application/vnd.google.protobuf media type,
+ * anything else falls back to text format.
+ */
+MetricExpositionFormat getMetricExpositionFormat(const std::string& acceptHeader);
+const std::string& getMetricContentType(MetricExpositionFormat format);
+
 template <typename MetricType>
 class MetricFamily;
 
@@ -48,6 +64,10 @@ public:
     // Returns all collected metrics in "Prometheus Text Exposition Format".
     std::string collect() const;
 
+    // Serializes all collected metrics into output buffer. Buffer is cleared first but its capacity
+    // is kept, so repeated collection into the same buffer does not reallocate.
+    void collect(std::string& output, MetricExpositionFormat format) const;
+
 private:
     prometheus::Registry registryImpl;
 };
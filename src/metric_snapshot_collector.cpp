@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "metric_snapshot_collector.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+const int MetricSnapshotCollector::COLLECTOR_THREAD_NICE_VALUE = 19;
+
+MetricSnapshotCollector::MetricSnapshotCollector(const MetricRegistry& registry) :
+    registry(registry),
+    bufferPool(std::make_shared<BufferPool>()) {}
+
+MetricSnapshotCollector::~MetricSnapshotCollector() {
+    stop();
+}
+
+void MetricSnapshotCollector::start() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (running) {
+        return;
+    }
+    running = true;
+    stopRequested = false;
+    thread = std::thread(&MetricSnapshotCollector::run, this);
+}
+
+void MetricSnapshotCollector::stop() {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (!running) {
+            return;
+        }
+        stopRequested = true;
+    }
+    collectorCv.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        running = false;
+        stopRequested = false;
+    }
+    // Scrapes still waiting for collector thread regenerate snapshot by themselves
+    snapshotCv.notify_all();
+}
+
+uint64_t MetricSnapshotCollector::getGeneration(MetricExpositionFormat format) const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return snapshots[static_cast<size_t>(format)].generation;
+}
+
+std::shared_ptr<const std::string> MetricSnapshotCollector::getSnapshot(MetricExpositionFormat format, std::chrono::milliseconds maxAge) {
+    Snapshot& snapshot = snapshots[static_cast<size_t>(format)];
+    std::unique_lock<std::mutex> lock(mtx);
+    if (snapshot.buffer && (maxAge.count() > 0) && (std::chrono::steady_clock::now() - snapshot.createdAt < maxAge)) {
+        return snapshot.buffer;
+    }
+    const uint64_t generation = snapshot.generation;
+    if (running && !snapshot.inProgress) {
+        snapshot.requested = true;
+        collectorCv.notify_one();
+    }
+    snapshotCv.wait(lock, [this, &snapshot, generation]() {
+        return (snapshot.generation != generation) || (!running && !snapshot.inProgress);
+    });
+    if (snapshot.generation == generation) {
+        regenerate(lock, snapshot, format);
+    }
+    return snapshot.buffer;
+}
+
+std::shared_ptr<std::string> MetricSnapshotCollector::acquireBuffer() {
+    std::unique_ptr<std::string> buffer;
+    {
+        std::unique_lock<std::mutex> lock(bufferPool->mtx);
+        if (!bufferPool->buffers.empty()) {
+            buffer = std::move(bufferPool->buffers.back());
+            bufferPool->buffers.pop_back();
+        }
+    }
+    if (!buffer) {
+        buffer = std::make_unique<std::string>();
+    }
+    // Buffer goes back to the pool when snapshot is replaced and no scrape is sending it anymore
+    return std::shared_ptr<std::string>(buffer.release(), [pool = this->bufferPool](std::string* released) {
+        std::unique_lock<std::mutex> lock(pool->mtx);
+        if (pool->buffers.size() < FORMATS_COUNT) {
+            pool->buffers.emplace_back(released);
+        } else {
+            delete released;
+        }
+    });
+}
+
+void MetricSnapshotCollector::regenerate(std::unique_lock<std::mutex>& lock, Snapshot& snapshot, MetricExpositionFormat format) {
+    snapshot.inProgress = true;
+    lock.unlock();
+    auto buffer = acquireBuffer();
+    registry.collect(*buffer, format);
+    lock.lock();
+    snapshot.buffer = std::move(buffer);
+    snapshot.createdAt = std::chrono::steady_clock::now();
+    snapshot.generation++;
+    snapshot.inProgress = false;
+    snapshotCv.notify_all();
+}
+
+void MetricSnapshotCollector::run() {
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), COLLECTOR_THREAD_NICE_VALUE) != 0) {
+        SPDLOG_DEBUG("Failed to lower priority of metrics collector thread: {}", std::strerror(errno));
+    }
+    SPDLOG_DEBUG("Started metrics collector thread");
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        collectorCv.wait(lock, [this]() {
+            if (stopRequested) {
+                return true;
+            }
+            for (const auto& snapshot : snapshots) {
+                if (snapshot.requested) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        if (stopRequested) {
+            break;
+        }
+        for (size_t i = 0; i < FORMATS_COUNT; ++i) {
+            Snapshot& snapshot = snapshots[i];
+            if (!snapshot.requested) {
+                continue;
+            }
+            snapshot.requested = false;
+            if (!snapshot.inProgress) {
+                regenerate(lock, snapshot, static_cast<MetricExpositionFormat>(i));
+            }
+        }
+    }
+    SPDLOG_DEBUG("Stopped metrics collector thread");
+}
+
+}  // namespace ovms
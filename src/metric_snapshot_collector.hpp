@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "metric_registry.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Serves metrics exposition from cached snapshots.
+ * Snapshot of each format is regenerated at most once per maximum age requested by the caller,
+ * concurrent scrapes of stale snapshot wait for single regeneration. Regeneration runs on
+ * a dedicated thread with the lowest scheduling priority, so that serializing large number
+ * of metrics does not compete for CPU with inference threads. Output buffer of a snapshot
+ * is returned to the pool once replaced and released by all scrapes, and reused by later regenerations.
+ */
+class MetricSnapshotCollector {
+public:
+    static const int COLLECTOR_THREAD_NICE_VALUE;
+
+    MetricSnapshotCollector(const MetricRegistry& registry);
+    MetricSnapshotCollector(const MetricSnapshotCollector&) = delete;
+    MetricSnapshotCollector& operator=(const MetricSnapshotCollector&) = delete;
+    ~MetricSnapshotCollector();
+
+    void start();
+    void stop();
+
+    /**
+     * @brief Returns snapshot not older than maxAge. Zero maxAge forces regeneration.
+     * When collector thread is not running, snapshot is regenerated in calling thread.
+     */
+    std::shared_ptr<const std::string> getSnapshot(MetricExpositionFormat format, std::chrono::milliseconds maxAge);
+
+    uint64_t getGeneration(MetricExpositionFormat format) const;
+
+private:
+    struct BufferPool {
+        std::mutex mtx;
+        std::vector<std::unique_ptr<std::string>> buffers;
+    };
+    struct Snapshot {
+        std::shared_ptr<const std::string> buffer;
+        std::chrono::steady_clock::time_point createdAt;
+        uint64_t generation = 0;
+        bool requested = false;
+        bool inProgress = false;
+    };
+    static constexpr size_t FORMATS_COUNT = 2;
+
+    void run();
+    std::shared_ptr<std::string> acquireBuffer();
+    void regenerate(std::unique_lock<std::mutex>& lock, Snapshot& snapshot, MetricExpositionFormat format);
+
+    const MetricRegistry& registry;
+    mutable std::mutex mtx;
+    std::condition_variable collectorCv;
+    std::condition_variable snapshotCv;
+    std::array<Snapshot, FORMATS_COUNT> snapshots;
+    std::shared_ptr<BufferPool> bufferPool;
+    bool running = false;
+    bool stopRequested = false;
+    std::thread thread;
+};
+
+}  // namespace ovms
@@ -109,6 +109,30 @@ const std::shared_ptr<ModelInstance> Model::getDefaultModelInstance() const {
     return modelInstanceIt->second;
 }
 
+const std::shared_ptr<ModelInstance> Model::getDefaultModelInstanceForInference() {
+    std::shared_lock lock(modelVersionsMtx);
+    auto defaultVersion = getDefaultVersion();
+    const auto modelInstanceIt = modelVersions.find(defaultVersion);
+
+    if (modelVersions.end() == modelInstanceIt) {
+        SPDLOG_WARN("Default version: {} for model: {} not found", defaultVersion, getName());
+        return nullptr;
+    }
+    // Sequences of stateful models exist only in the version which started them
+    if (isStateful()) {
+        return modelInstanceIt->second;
+    }
+    const auto routedVersion = overloadFallbackRouter.route(defaultVersion, modelInstanceIt->second->getInferRequestWaitEstimator().getAverageMs());
+    if (routedVersion != defaultVersion) {
+        const auto fallbackIt = modelVersions.find(routedVersion);
+        if (modelVersions.end() != fallbackIt && ModelVersionState::AVAILABLE == fallbackIt->second->getStatus().getState()) {
+            return fallbackIt->second;
+        }
+        SPDLOG_DEBUG("Fallback version: {} for model: {} is not available, using default version", routedVersion, getName());
+    }
+    return modelInstanceIt->second;
+}
+
 std::shared_ptr<ovms::ModelInstance> Model::modelInstanceFactory(const std::string& modelName, const model_version_t modelVersion, ov::Core& ieCore, MetricRegistry* registry, const MetricConfig* metricConfig) {
     if (isStateful()) {
         SPDLOG_DEBUG("Creating new stateful model instance - model name: {}; model version: {};", modelName, modelVersion);
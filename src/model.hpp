@@ -26,6 +26,7 @@
 #include "filesystem.hpp"
 #include "modelchangesubscription.hpp"
 #include "modelinstance.hpp"
+#include "overload_fallback.hpp"
 #include "statefulmodelinstance.hpp"
 
 namespace ovms {
@@ -105,6 +106,11 @@ protected:
          */
     std::string customLoaderName;
 
+    /**
+         * @brief Routes part of requests for default version to fallback version under overload
+         */
+    OverloadFallbackRouter overloadFallbackRouter;
+
 public:
     /**
          * @brief Constructor
@@ -114,7 +120,8 @@ public:
         globalSequencesViewer(globalSequencesViewer),
         name(name),
         defaultVersion(0),
-        subscriptionManager(std::string("model: ") + name) {}
+        subscriptionManager(std::string("model: ") + name),
+        overloadFallbackRouter(name) {}
 
     /**
          * @brief Destroy the Model object
@@ -142,6 +149,14 @@ public:
          */
     const std::shared_ptr<ModelInstance> getDefaultModelInstance() const;
 
+    /**
+         * @brief Gets the ModelInstance serving inference request for default version.
+         * When overload fallback policy is active part of requests is served by fallback version.
+         *
+         * @return ModelInstance
+         */
+    const std::shared_ptr<ModelInstance> getDefaultModelInstanceForInference();
+
     /**
      * @brief Gets model versions instances
      *
@@ -238,6 +253,14 @@ public:
         customLoaderName.clear();
     }
 
+    void setOverloadFallbackPolicy(const OverloadFallbackPolicy& policy) {
+        overloadFallbackRouter.setPolicy(policy);
+    }
+
+    const OverloadFallbackRouter& getOverloadFallbackRouter() const {
+        return overloadFallbackRouter;
+    }
+
     /**
      * @brief Delete temporary model files
      *
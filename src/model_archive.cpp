@@ -0,0 +1,760 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_archive.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include "logging.hpp"
+#include "stringutils.hpp"
+
+namespace ovms {
+
+const size_t ModelVersionArchive::READ_CHUNK_SIZE = 1024 * 1024;
+const size_t ModelVersionArchive::MAX_QUEUED_CHUNKS = 16;
+
+namespace {
+
+const std::vector<std::pair<std::string, ArchiveCompression>> ARCHIVE_EXTENSIONS = {
+    {".tar.zst", ArchiveCompression::ZSTD},
+    {".tar.gz", ArchiveCompression::GZIP},
+    {".tgz", ArchiveCompression::GZIP}};
+
+constexpr size_t DECOMPRESSED_CHUNK_SIZE = 256 * 1024;
+constexpr size_t TAR_BLOCK_SIZE = 512;
+constexpr uint64_t MAX_TAR_METADATA_SIZE = 1024 * 1024;
+
+class Decompressor {
+public:
+    virtual ~Decompressor() = default;
+    virtual StatusCode decompress(const char* data, size_t size, const file_chunk_consumer_t& output) = 0;
+    /**
+     * @brief Checks that compressed stream was not truncated
+     */
+    virtual StatusCode finish() = 0;
+};
+
+class GzipDecompressor : public Decompressor {
+    z_stream stream{};
+    bool initialized = false;
+    bool memberEnded = false;
+    std::vector<char> buffer = std::vector<char>(DECOMPRESSED_CHUNK_SIZE);
+
+public:
+    GzipDecompressor() {
+        // 16 added to window bits makes zlib expect gzip header and trailer
+        initialized = inflateInit2(&stream, 15 + 16) == Z_OK;
+    }
+    ~GzipDecompressor() {
+        if (initialized) {
+            inflateEnd(&stream);
+        }
+    }
+
+    StatusCode decompress(const char* data, size_t size, const file_chunk_consumer_t& output) override {
+        if (!initialized) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to initialize gzip decompression");
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        stream.avail_in = size;
+        do {
+            if (memberEnded) {
+                if (stream.avail_in == 0) {
+                    break;
+                }
+                // Parallel gzip tools like pigz produce multiple concatenated gzip members
+                if (inflateReset(&stream) != Z_OK) {
+                    return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+                }
+                memberEnded = false;
+            }
+            stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+            stream.avail_out = buffer.size();
+            int ret = inflate(&stream, Z_NO_FLUSH);
+            if (ret == Z_BUF_ERROR) {
+                // No progress possible until next input chunk arrives
+                break;
+            }
+            if (ret != Z_OK && ret != Z_STREAM_END) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to decompress gzip archive: {}", stream.msg ? stream.msg : std::to_string(ret));
+                return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+            }
+            const size_t produced = buffer.size() - stream.avail_out;
+            if (produced > 0) {
+                auto status = output(buffer.data(), produced);
+                if (status != StatusCode::OK) {
+                    return status;
+                }
+            }
+            if (ret == Z_STREAM_END) {
+                memberEnded = true;
+            }
+        } while (stream.avail_in > 0 || stream.avail_out == 0);
+        return StatusCode::OK;
+    }
+
+    StatusCode finish() override {
+        if (!memberEnded) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Gzip archive is truncated");
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        return StatusCode::OK;
+    }
+};
+
+class ZstdDecompressor : public Decompressor {
+    ZSTD_DCtx* context = ZSTD_createDCtx();
+    // ZSTD_decompressStream returns 0 only when frame is completely decoded and flushed
+    size_t lastResult = 1;
+    std::vector<char> buffer = std::vector<char>(DECOMPRESSED_CHUNK_SIZE);
+
+public:
+    ~ZstdDecompressor() {
+        ZSTD_freeDCtx(context);
+    }
+
+    StatusCode decompress(const char* data, size_t size, const file_chunk_consumer_t& output) override {
+        if (context == nullptr) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to initialize zstd decompression");
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        ZSTD_inBuffer input{data, size, 0};
+        bool outputFull = false;
+        while (input.pos < input.size || outputFull) {
+            ZSTD_outBuffer out{buffer.data(), buffer.size(), 0};
+            const size_t ret = ZSTD_decompressStream(context, &out, &input);
+            if (ZSTD_isError(ret)) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to decompress zstd archive: {}", ZSTD_getErrorName(ret));
+                return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+            }
+            lastResult = ret;
+            if (out.pos > 0) {
+                auto status = output(buffer.data(), out.pos);
+                if (status != StatusCode::OK) {
+                    return status;
+                }
+            }
+            outputFull = out.pos == out.size;
+        }
+        return StatusCode::OK;
+    }
+
+    StatusCode finish() override {
+        if (lastResult != 0) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Zstd archive is truncated");
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        return StatusCode::OK;
+    }
+};
+
+/**
+ * @brief Incremental tar parser writing regular files of the archive into target directory.
+ * Supports ustar, GNU long names and pax path/size records. Links and special files are skipped.
+ */
+class TarExtractor {
+    enum class State {
+        HEADER,
+        FILE_DATA,
+        SKIPPED_DATA,
+        METADATA,
+        PADDING,
+        END
+    };
+
+    const std::filesystem::path targetPath;
+    State state = State::HEADER;
+    std::array<char, TAR_BLOCK_SIZE> header;
+    size_t headerFilled = 0;
+    uint64_t entrySize = 0;
+    uint64_t remaining = 0;
+    uint64_t padding = 0;
+    char metadataType = 0;
+    std::string metadata;
+    std::string overriddenName;
+    std::optional<uint64_t> overriddenSize;
+    std::ofstream file;
+    std::filesystem::path filePath;
+
+public:
+    TarExtractor(const std::string& targetPath) :
+        targetPath(targetPath) {}
+
+    StatusCode write(const char* data, size_t size) {
+        while (size > 0 && state != State::END) {
+            size_t consumed = 0;
+            StatusCode status = StatusCode::OK;
+            switch (state) {
+            case State::HEADER:
+                consumed = std::min(size, TAR_BLOCK_SIZE - headerFilled);
+                std::memcpy(header.data() + headerFilled, data, consumed);
+                headerFilled += consumed;
+                if (headerFilled == TAR_BLOCK_SIZE) {
+                    headerFilled = 0;
+                    status = processHeader();
+                }
+                break;
+            case State::FILE_DATA:
+            case State::SKIPPED_DATA:
+            case State::METADATA:
+                consumed = std::min<uint64_t>(size, remaining);
+                if (state == State::FILE_DATA) {
+                    file.write(data, consumed);
+                    if (!file) {
+                        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to write file {} extracted from archive", filePath.string());
+                        return StatusCode::FILESYSTEM_ERROR;
+                    }
+                } else if (state == State::METADATA) {
+                    metadata.append(data, consumed);
+                }
+                remaining -= consumed;
+                if (remaining == 0) {
+                    status = finishEntry();
+                }
+                break;
+            case State::PADDING:
+                consumed = std::min<uint64_t>(size, padding);
+                padding -= consumed;
+                if (padding == 0) {
+                    state = State::HEADER;
+                }
+                break;
+            case State::END:
+                break;
+            }
+            if (status != StatusCode::OK) {
+                return status;
+            }
+            data += consumed;
+            size -= consumed;
+        }
+        return StatusCode::OK;
+    }
+
+    StatusCode finish() {
+        // Some writers omit end of archive blocks, compressed stream completeness is verified by decompressor
+        if (state == State::END || (state == State::HEADER && headerFilled == 0)) {
+            return StatusCode::OK;
+        }
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Tar archive is truncated");
+        return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+    }
+
+private:
+    static std::string readField(const char* field, size_t length) {
+        return std::string(field, strnlen(field, length));
+    }
+
+    static bool readNumber(const char* field, size_t length, uint64_t& value) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(field);
+        value = 0;
+        if (bytes[0] & 0x80) {
+            // GNU base-256 encoding used for entries larger than 8GB
+            if (bytes[0] & 0x40) {
+                return false;
+            }
+            value = bytes[0] & 0x3f;
+            for (size_t i = 1; i < length; ++i) {
+                if (value >> 56) {
+                    return false;
+                }
+                value = (value << 8) | bytes[i];
+            }
+            return true;
+        }
+        size_t i = 0;
+        while (i < length && field[i] == ' ') {
+            ++i;
+        }
+        for (; i < length && field[i] >= '0' && field[i] <= '7'; ++i) {
+            if (value >> 61) {
+                return false;
+            }
+            value = (value << 3) | (field[i] - '0');
+        }
+        return i == length || field[i] == ' ' || field[i] == '\0';
+    }
+
+    bool isChecksumValid() const {
+        uint64_t expected;
+        if (!readNumber(header.data() + 148, 8, expected)) {
+            return false;
+        }
+        uint64_t sum = 0;
+        for (size_t i = 0; i < TAR_BLOCK_SIZE; ++i) {
+            // Checksum field itself is counted as spaces
+            sum += (i >= 148 && i < 156) ? ' ' : static_cast<unsigned char>(header[i]);
+        }
+        return sum == expected;
+    }
+
+    StatusCode resolvePath(const std::string& name, std::filesystem::path& relativePath) const {
+        std::filesystem::path path(name);
+        if (path.is_absolute()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Absolute path {} in archive is forbidden", name);
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        relativePath.clear();
+        for (const auto& part : path) {
+            if (part == "..") {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Path {} in archive escape with .. is forbidden", name);
+                return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+            }
+            if (part.empty() || part == ".") {
+                continue;
+            }
+            relativePath /= part;
+        }
+        return StatusCode::OK;
+    }
+
+    StatusCode processHeader() {
+        if (std::all_of(header.begin(), header.end(), [](char c) { return c == 0; })) {
+            state = State::END;
+            return StatusCode::OK;
+        }
+        if (!isChecksumValid()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Invalid tar header checksum");
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        uint64_t size = 0;
+        if (!readNumber(header.data() + 124, 12, size)) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Invalid tar entry size");
+            return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+        }
+        std::string name = readField(header.data(), 100);
+        // Prefix field is valid only in POSIX ustar format, old GNU format stores timestamps there
+        if (std::memcmp(header.data() + 257, "ustar\0", 6) == 0) {
+            std::string prefix = readField(header.data() + 345, 155);
+            if (!prefix.empty()) {
+                name = prefix + "/" + name;
+            }
+        }
+        const char type = header[156];
+        // Long name and pax records apply only to the entry following them
+        if (type != 'L' && type != 'x') {
+            if (!overriddenName.empty()) {
+                name = overriddenName;
+                overriddenName.clear();
+            }
+            if (overriddenSize.has_value()) {
+                size = overriddenSize.value();
+                overriddenSize.reset();
+            }
+        }
+        entrySize = size;
+        remaining = size;
+
+        StatusCode status = StatusCode::OK;
+        switch (type) {
+        case 'L':
+        case 'x':
+            if (size > MAX_TAR_METADATA_SIZE) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Tar metadata entry too large: {}", size);
+                return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+            }
+            metadataType = type;
+            metadata.clear();
+            state = State::METADATA;
+            break;
+        case '0':
+        case '\0':
+        case '7':
+            status = startFile(name);
+            break;
+        case '5':
+            status = createDirectory(name);
+            state = State::SKIPPED_DATA;
+            break;
+        case 'g':
+            state = State::SKIPPED_DATA;
+            break;
+        default:
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Skipping unsupported entry {} of type {} in archive", name, type);
+            state = State::SKIPPED_DATA;
+            break;
+        }
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        if (remaining == 0) {
+            return finishEntry();
+        }
+        return StatusCode::OK;
+    }
+
+    StatusCode createDirectory(const std::string& name) {
+        std::filesystem::path relativePath;
+        auto status = resolvePath(name, relativePath);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        std::error_code ec;
+        std::filesystem::create_directories(targetPath / relativePath, ec);
+        if (ec) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create directory {} extracted from archive: {}", (targetPath / relativePath).string(), ec.message());
+            return StatusCode::FILESYSTEM_ERROR;
+        }
+        return StatusCode::OK;
+    }
+
+    StatusCode startFile(const std::string& name) {
+        state = State::SKIPPED_DATA;
+        std::filesystem::path relativePath;
+        auto status = resolvePath(name, relativePath);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        const std::string relative = relativePath.string();
+        if (relative.empty() ||
+            std::none_of(FileSystem::acceptedFiles.begin(), FileSystem::acceptedFiles.end(), [&relative](const std::string& x) {
+                return endsWith(relative, x);
+            })) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Skipping file {} from archive", name);
+            return StatusCode::OK;
+        }
+        filePath = targetPath / relativePath;
+        std::error_code ec;
+        std::filesystem::create_directories(filePath.parent_path(), ec);
+        if (ec) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create directory {} extracted from archive: {}", filePath.parent_path().string(), ec.message());
+            return StatusCode::FILESYSTEM_ERROR;
+        }
+        file.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create file {} extracted from archive", filePath.string());
+            return StatusCode::FILESYSTEM_ERROR;
+        }
+        SPDLOG_LOGGER_TRACE(modelmanager_logger, "Extracting file {} (bytes={})", filePath.string(), entrySize);
+        state = State::FILE_DATA;
+        return StatusCode::OK;
+    }
+
+    StatusCode processMetadata() {
+        if (metadataType == 'L') {
+            overriddenName = readField(metadata.data(), metadata.size());
+            return StatusCode::OK;
+        }
+        // Pax records have format "<length> <key>=<value>\n", where length covers whole record
+        size_t offset = 0;
+        while (offset < metadata.size()) {
+            const size_t space = metadata.find(' ', offset);
+            size_t length = 0;
+            try {
+                length = std::stoull(metadata.substr(offset, space - offset));
+            } catch (const std::exception&) {
+                length = 0;
+            }
+            if (space == std::string::npos || length <= space - offset + 1 || offset + length > metadata.size()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Invalid pax header in archive");
+                return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+            }
+            const std::string record = metadata.substr(space + 1, offset + length - space - 2);
+            offset += length;
+            const size_t equals = record.find('=');
+            if (equals == std::string::npos) {
+                continue;
+            }
+            const std::string key = record.substr(0, equals);
+            const std::string value = record.substr(equals + 1);
+            if (key == "path") {
+                overriddenName = value;
+            } else if (key == "size") {
+                try {
+                    overriddenSize = std::stoull(value);
+                } catch (const std::exception&) {
+                    SPDLOG_LOGGER_ERROR(modelmanager_logger, "Invalid pax size record in archive: {}", value);
+                    return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+                }
+            }
+        }
+        return StatusCode::OK;
+    }
+
+    StatusCode finishEntry() {
+        StatusCode status = StatusCode::OK;
+        if (state == State::FILE_DATA) {
+            file.close();
+            if (!file) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to write file {} extracted from archive", filePath.string());
+                status = StatusCode::FILESYSTEM_ERROR;
+            }
+        } else if (state == State::METADATA) {
+            status = processMetadata();
+        }
+        padding = (TAR_BLOCK_SIZE - entrySize % TAR_BLOCK_SIZE) % TAR_BLOCK_SIZE;
+        state = padding > 0 ? State::PADDING : State::HEADER;
+        return status;
+    }
+};
+
+/**
+ * @brief Bounded queue passing compressed chunks from reading thread to decompressing thread.
+ * Limits memory used when storage is faster than decompression.
+ */
+class ChunkQueue {
+    std::deque<std::vector<char>> chunks;
+    const size_t capacity;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool closed = false;
+    bool aborted = false;
+
+public:
+    ChunkQueue(size_t capacity) :
+        capacity(capacity) {}
+
+    bool push(std::vector<char>&& chunk) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return chunks.size() < capacity || aborted; });
+        if (aborted) {
+            return false;
+        }
+        chunks.push_back(std::move(chunk));
+        cv.notify_all();
+        return true;
+    }
+
+    bool pop(std::vector<char>& chunk) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return !chunks.empty() || closed || aborted; });
+        if (aborted || chunks.empty()) {
+            return false;
+        }
+        chunk = std::move(chunks.front());
+        chunks.pop_front();
+        cv.notify_all();
+        return true;
+    }
+
+    void close() {
+        std::unique_lock<std::mutex> lock(mtx);
+        closed = true;
+        cv.notify_all();
+    }
+
+    void abort() {
+        std::unique_lock<std::mutex> lock(mtx);
+        aborted = true;
+        cv.notify_all();
+    }
+
+    bool isAborted() {
+        std::unique_lock<std::mutex> lock(mtx);
+        return aborted;
+    }
+};
+
+}  // namespace
+
+ArchiveCompression ModelVersionArchive::getCompression(const std::string& fileName) {
+    for (const auto& [extension, compression] : ARCHIVE_EXTENSIONS) {
+        if (endsWith(fileName, extension)) {
+            return compression;
+        }
+    }
+    return ArchiveCompression::NONE;
+}
+
+bool ModelVersionArchive::parseVersion(const std::string& fileName, model_version_t& version) {
+    for (const auto& [extension, compression] : ARCHIVE_EXTENSIONS) {
+        if (!endsWith(fileName, extension)) {
+            continue;
+        }
+        const std::string number = fileName.substr(0, fileName.size() - extension.size());
+        if (number.empty() || !std::all_of(number.begin(), number.end(), [](unsigned char c) { return std::isdigit(c); })) {
+            return false;
+        }
+        try {
+            const model_version_t parsed = std::stoll(number);
+            if (parsed <= 0) {
+                return false;
+            }
+            version = parsed;
+            return true;
+        } catch (const std::out_of_range&) {
+            return false;
+        }
+    }
+    return false;
+}
+
+StatusCode ModelVersionArchive::findVersionArchives(FileSystem& fs, const std::string& basePath, std::map<model_version_t, std::string>& archives) {
+    files_list_t files;
+    auto status = fs.getDirectoryFiles(basePath, &files);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    files_list_t subdirs;
+    status = fs.getDirectorySubdirs(basePath, &subdirs);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    for (const auto& entry : files) {
+        // Local filesystem lists files with full paths, remote ones with names only
+        const std::string file = std::filesystem::path(entry).filename().string();
+        model_version_t version;
+        if (!parseVersion(file, version)) {
+            continue;
+        }
+        if (subdirs.count(std::to_string(version)) > 0) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Model version {} in path: {} is stored both as directory and archive {}, using directory", version, basePath, file);
+            continue;
+        }
+        auto it = archives.find(version);
+        if (it != archives.end()) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Model version {} has multiple archives in path: {}, using {}", version, basePath, it->second);
+            continue;
+        }
+        archives.emplace(version, fs.joinPath({basePath, file}));
+    }
+    return StatusCode::OK;
+}
+
+StatusCode ModelVersionArchive::extract(FileSystem& fs, const std::string& archivePath, const std::string& localPath) {
+    std::unique_ptr<Decompressor> decompressor;
+    switch (getCompression(archivePath)) {
+    case ArchiveCompression::GZIP:
+        decompressor = std::make_unique<GzipDecompressor>();
+        break;
+    case ArchiveCompression::ZSTD:
+        decompressor = std::make_unique<ZstdDecompressor>();
+        break;
+    case ArchiveCompression::NONE:
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Unsupported model version archive: {}", archivePath);
+        return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Extracting model version archive {} to {}", archivePath, localPath);
+    const auto start = std::chrono::steady_clock::now();
+
+    ChunkQueue queue(MAX_QUEUED_CHUNKS);
+    StatusCode extractionStatus = StatusCode::OK;
+    std::thread extractionThread([&queue, &decompressor, &extractionStatus, &localPath]() {
+        try {
+            TarExtractor tar(localPath);
+            const file_chunk_consumer_t toTar = [&tar](const char* data, size_t size) { return tar.write(data, size); };
+            std::vector<char> chunk;
+            while (queue.pop(chunk)) {
+                auto status = decompressor->decompress(chunk.data(), chunk.size(), toTar);
+                if (status != StatusCode::OK) {
+                    extractionStatus = status;
+                    queue.abort();
+                    return;
+                }
+            }
+            if (queue.isAborted()) {
+                return;
+            }
+            extractionStatus = decompressor->finish();
+            if (extractionStatus == StatusCode::OK) {
+                extractionStatus = tar.finish();
+            }
+        } catch (const std::exception& e) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Extraction of model version archive failed: {}", e.what());
+            extractionStatus = StatusCode::INTERNAL_ERROR;
+            queue.abort();
+        }
+    });
+
+    uint64_t compressedSize = 0;
+    StatusCode readStatus = StatusCode::OK;
+    // Extraction thread has to be joined on every path, otherwise its destructor terminates the process
+    try {
+        readStatus = fs.readFileChunks(archivePath, [&queue, &compressedSize](const char* data, size_t size) {
+            compressedSize += size;
+            for (size_t offset = 0; offset < size; offset += READ_CHUNK_SIZE) {
+                const size_t length = std::min(READ_CHUNK_SIZE, size - offset);
+                if (!queue.push(std::vector<char>(data + offset, data + offset + length))) {
+                    // Extraction already failed, stop reading rest of the archive
+                    return StatusCode::MODEL_VERSION_ARCHIVE_INVALID;
+                }
+            }
+            return StatusCode::OK;
+        });
+    } catch (const std::exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Reading model version archive {} failed: {}", archivePath, e.what());
+        readStatus = StatusCode::INTERNAL_ERROR;
+    }
+    if (readStatus == StatusCode::OK) {
+        queue.close();
+    } else {
+        queue.abort();
+    }
+    extractionThread.join();
+
+    if (extractionStatus != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to extract model version archive {}", archivePath);
+        return extractionStatus;
+    }
+    if (readStatus != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to read model version archive {}", archivePath);
+        return readStatus;
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Model version archive {} (bytes={}) extracted in {} ms", archivePath, compressedSize,
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    return StatusCode::OK;
+}
+
+StatusCode ModelVersionArchive::extractAll(FileSystem& fs, const std::vector<Extraction>& extractions, size_t maxParallelExtractions) {
+    if (maxParallelExtractions == 0) {
+        maxParallelExtractions = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    // Each extraction runs its own decompression thread next to the reader, so only a bounded
+    // number of workers is started and they take archives one after another
+    const size_t workersCount = std::min(maxParallelExtractions, extractions.size());
+    std::vector<StatusCode> statuses(extractions.size(), StatusCode::OK);
+    std::atomic<size_t> next{0};
+    auto worker = [&fs, &extractions, &statuses, &next]() {
+        for (size_t i = next++; i < extractions.size(); i = next++) {
+            statuses[i] = extract(fs, extractions[i].archivePath, extractions[i].localPath);
+        }
+    };
+    std::vector<std::future<void>> workers;
+    workers.reserve(workersCount);
+    for (size_t i = 0; i < workersCount; i++) {
+        workers.emplace_back(std::async(std::launch::async, worker));
+    }
+    for (auto& future : workers) {
+        future.get();
+    }
+    for (const auto status : statuses) {
+        if (status != StatusCode::OK) {
+            return status;
+        }
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
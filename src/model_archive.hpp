@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "filesystem.hpp"
+#include "modelversion.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+enum class ArchiveCompression {
+    NONE,
+    GZIP,
+    ZSTD
+};
+
+/**
+ * @brief Model version stored in remote repository as single compressed tar archive named after the version,
+ * eg. 1.tar.zst or 1.tar.gz, instead of version directory. Archive is streamed, decompressed and extracted
+ * in one pass, without storing compressed file locally. Reading from storage and decompression run
+ * in separate threads connected with bounded queue and multiple versions are extracted in parallel.
+ */
+class ModelVersionArchive {
+public:
+    static const size_t READ_CHUNK_SIZE;
+    static const size_t MAX_QUEUED_CHUNKS;
+
+    struct Extraction {
+        std::string archivePath;
+        std::string localPath;
+    };
+
+    /**
+     * @brief Returns compression of archive based on file extension, NONE if file is not supported archive
+     */
+    static ArchiveCompression getCompression(const std::string& fileName);
+
+    /**
+     * @brief Parses version number from archive file name eg. 2.tar.gz
+     */
+    static bool parseVersion(const std::string& fileName, model_version_t& version);
+
+    /**
+     * @brief Lists version archives stored in model base path. Versions which also have a version
+     * directory are skipped - directory takes precedence.
+     *
+     * @param archives map of version to archive path
+     */
+    static StatusCode findVersionArchives(FileSystem& fs, const std::string& basePath, std::map<model_version_t, std::string>& archives);
+
+    /**
+     * @brief Streams archive from filesystem and extracts it into existing local directory
+     */
+    static StatusCode extract(FileSystem& fs, const std::string& archivePath, const std::string& localPath);
+
+    /**
+     * @brief Extracts multiple archives in parallel, returns first encountered error
+     *
+     * @param maxParallelExtractions limit of archives extracted at the same time, 0 means number of hardware threads
+     */
+    static StatusCode extractAll(FileSystem& fs, const std::vector<Extraction>& extractions, size_t maxParallelExtractions = 0);
+};
+
+}  // namespace ovms
@@ -29,6 +29,8 @@ namespace ovms {
 constexpr int NUMBER_OF_BUCKETS = 33;
 constexpr double BUCKET_POWER_BASE = 1.8;
 constexpr double BUCKET_MULTIPLIER = 10;
+// Powers of 2 from 1 to 1024
+constexpr int NUMBER_OF_BATCH_SIZE_BUCKETS = 11;
 
 #define THROW_IF_NULL(VAR, MESSAGE)                        \
     if (VAR == nullptr) {                                  \
@@ -319,6 +321,125 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
             {{"name", modelName}, {"version", std::to_string(modelVersion)}});
         THROW_IF_NULL(this->currentRequests, "cannot create metric");
     }
+
+    familyName = "ovms_infer_req_waiting";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of requests waiting for an idle inference request in the processing queue.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inferReqWaiting = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->inferReqWaiting, "cannot create metric");
+    }
+
+    familyName = "ovms_infer_req_busy_time_us";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Total time inference requests from the processing queue were consumed.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inferReqBusyTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->inferReqBusyTime, "cannot create metric");
+    }
+
+    familyName = "ovms_inference_batch_size";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Batch size of executed inferences.");
+        THROW_IF_NULL(family, "cannot create family");
+        std::vector<double> batchSizeBuckets;
+        for (int i = 0; i < NUMBER_OF_BATCH_SIZE_BUCKETS; i++) {
+            batchSizeBuckets.emplace_back(pow(2, i));
+        }
+        this->inferenceBatchSize = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            batchSizeBuckets);
+        THROW_IF_NULL(this->inferenceBatchSize, "cannot create metric");
+    }
+
+    familyName = "ovms_memory_bytes";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Estimated memory held by a servable, per kind of resource.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->memoryWeights = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}, {"kind", "weights"}});
+        THROW_IF_NULL(this->memoryWeights, "cannot create metric");
+        this->memoryCompiledModel = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}, {"kind", "compiled_model"}});
+        THROW_IF_NULL(this->memoryCompiledModel, "cannot create metric");
+        this->memoryInferRequests = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}, {"kind", "infer_requests"}});
+        THROW_IF_NULL(this->memoryInferRequests, "cannot create metric");
+        this->memorySequences = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}, {"kind", "sequences"}});
+        THROW_IF_NULL(this->memorySequences, "cannot create metric");
+    }
+
+    createHwEventMetrics(metricConfig, modelName, modelVersion, {PERF_STAGE_DESERIALIZE, PERF_STAGE_INFER, PERF_STAGE_SERIALIZE});
+}
+
+PipelineMetricReporter::PipelineMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& pipelineName, model_version_t pipelineVersion) :
+    ServableMetricReporter(metricConfig, registry, pipelineName, pipelineVersion) {
+    if (!registry) {
+        return;
+    }
+
+    if (!metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+
+    std::string familyName = "ovms_dag_executor_threads";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of threads currently executing requests to a DAG.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->dagExecutorThreads = family->addMetric(
+            {{"name", pipelineName}, {"version", std::to_string(pipelineVersion)}});
+        THROW_IF_NULL(this->dagExecutorThreads, "cannot create metric");
+    }
+
+    familyName = "ovms_dag_deferred_node_sessions";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of DAG node sessions ready for execution but waiting for an inference request of a model.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->dagDeferredNodeSessions = family->addMetric(
+            {{"name", pipelineName}, {"version", std::to_string(pipelineVersion)}});
+        THROW_IF_NULL(this->dagDeferredNodeSessions, "cannot create metric");
+    }
+
+    familyName = "ovms_memory_bytes";
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Estimated memory held by a servable, per kind of resource.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->dagCustomNodesMemory = family->addMetric(
+            {{"name", pipelineName}, {"version", std::to_string(pipelineVersion)}, {"kind", "custom_nodes"}});
+        THROW_IF_NULL(this->dagCustomNodesMemory, "cannot create metric");
+    }
+
+    createHwEventMetrics(metricConfig, pipelineName, pipelineVersion, {PERF_STAGE_DESERIALIZE, PERF_STAGE_DAG_NODE, PERF_STAGE_SERIALIZE});
+}
+
+void ServableMetricReporter::createHwEventMetrics(const MetricConfig* metricConfig, const std::string& name, model_version_t version, const std::vector<PerfStage>& stages) {
+    std::string familyName = "ovms_hw_events";
+    if (!metricConfig->isFamilyEnabled(familyName)) {
+        return;
+    }
+    auto family = registry->createFamily<MetricCounter>(familyName,
+        "Number of hardware and scheduler events counted on threads processing requests, per processing stage.");
+    THROW_IF_NULL(family, "cannot create family");
+    for (auto stage : stages) {
+        for (size_t event = 0; event < PERF_EVENTS_COUNT; event++) {
+            this->hwEvents[stage][event] = family->addMetric({{"name", name},
+                {"version", std::to_string(version)},
+                {"stage", getPerfStageName(stage)},
+                {"event", getPerfEventName(static_cast<PerfEvent>(event))}});
+            THROW_IF_NULL(this->hwEvents[stage][event], "cannot create metric");
+        }
+    }
+    this->hwEventsEnabled = true;
 }
 
 }  // namespace ovms
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@
 #include "execution_context.hpp"
 #include "metric.hpp"
 #include "modelversion.hpp"
+#include "perf_counters.hpp"
 
 namespace ovms {
 
@@ -34,6 +36,8 @@ class ServableMetricReporter {
 protected:
     std::vector<double> buckets;
 
+    void createHwEventMetrics(const MetricConfig* metricConfig, const std::string& name, model_version_t version, const std::vector<PerfStage>& stages);
+
 public:
     ServableMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
 
@@ -74,6 +78,19 @@ public:
     std::unique_ptr<MetricHistogram> requestTimeGrpc;
     std::unique_ptr<MetricHistogram> requestTimeRest;
 
+    // DAG only, created by PipelineMetricReporter
+    std::unique_ptr<MetricGauge> dagExecutorThreads;
+    std::unique_ptr<MetricGauge> dagDeferredNodeSessions;
+    std::unique_ptr<MetricGauge> dagCustomNodesMemory;
+
+    // Hardware performance counters of request processing stages
+    std::array<perf_metrics_t, PERF_STAGES_COUNT> hwEvents;
+    bool hwEventsEnabled = false;
+
+    inline perf_metrics_t* getHwEvents(PerfStage stage) {
+        return this->hwEventsEnabled ? &this->hwEvents[stage] : nullptr;
+    }
+
     inline std::unique_ptr<MetricCounter>& getGetModelStatusRequestSuccessMetric(const ExecutionContext& context) {
         if (context.method != ExecutionContext::Method::GetModelStatus) {
             static std::unique_ptr<MetricCounter> empty = nullptr;
@@ -146,8 +163,21 @@ public:
     std::unique_ptr<MetricGauge> inferReqQueueSize;
     std::unique_ptr<MetricGauge> inferReqActive;
     std::unique_ptr<MetricGauge> currentRequests;
+    std::unique_ptr<MetricGauge> inferReqWaiting;
+    std::unique_ptr<MetricCounter> inferReqBusyTime;
+    std::unique_ptr<MetricHistogram> inferenceBatchSize;
+
+    std::unique_ptr<MetricGauge> memoryWeights;
+    std::unique_ptr<MetricGauge> memoryCompiledModel;
+    std::unique_ptr<MetricGauge> memoryInferRequests;
+    std::unique_ptr<MetricGauge> memorySequences;
 
     ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
 };
 
+class PipelineMetricReporter : public ServableMetricReporter {
+public:
+    PipelineMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& pipelineName, model_version_t pipelineVersion);
+};
+
 }  // namespace ovms
@@ -0,0 +1,267 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_profiler.hpp"
+
+#include <cstring>
+#include <utility>
+
+#include <openvino/runtime/exec_model_info.hpp>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+const uint32_t ModelProfiler::MAX_SAMPLES = 10000;
+
+ModelProfiler::~ModelProfiler() {
+    stopWorker();
+}
+
+Status ModelProfiler::start(ov::Core& ieCore, const std::shared_ptr<ov::Model>& model, const std::string& targetDevice, plugin_config_t pluginConfig, uint32_t samples) {
+    std::lock_guard<std::mutex> controlLock(controlMtx);
+    stopWorker();
+    std::unique_lock<std::mutex> lock(mtx);
+    requestedSamples = 0;
+    collectedSamples = 0;
+    failedSamples = 0;
+    layers.clear();
+    layersIndex.clear();
+    runtimePrecisions.clear();
+    if (samples == 0) {
+        return StatusCode::OK;
+    }
+    // Compilation may take long, it must not block sampled requests checking profiler state
+    lock.unlock();
+    pluginConfig[ov::enable_profiling.name()] = true;
+    std::unique_ptr<ov::CompiledModel> profiledModel;
+    std::unique_ptr<ov::InferRequest> profiledRequest;
+    try {
+        profiledModel = std::make_unique<ov::CompiledModel>(ieCore.compile_model(model, targetDevice, pluginConfig));
+        profiledRequest = std::make_unique<ov::InferRequest>(profiledModel->create_infer_request());
+    } catch (const ov::Exception& e) {
+        SPDLOG_ERROR("Failed to compile model for profiling on device: {}; error: {}", targetDevice, e.what());
+        return StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
+    }
+    std::unordered_map<std::string, std::string> precisions;
+    try {
+        for (const auto& op : profiledModel->get_runtime_model()->get_ops()) {
+            const auto& rtInfo = op->get_rt_info();
+            auto it = rtInfo.find(ov::exec_model_info::RUNTIME_PRECISION);
+            if (it != rtInfo.end()) {
+                precisions[op->get_friendly_name()] = it->second.as<std::string>();
+            }
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("Runtime precisions of profiled layers are not available: {}", e.what());
+    }
+    lock.lock();
+    inputs = profiledModel->inputs();
+    compiledModel = std::move(profiledModel);
+    inferRequest = std::move(profiledRequest);
+    runtimePrecisions = std::move(precisions);
+    requestedSamples = samples;
+    remainingSamples.store(samples);
+    worker = std::thread(&ModelProfiler::run, this);
+    SPDLOG_INFO("Started profiling of next {} requests on device: {}", samples, targetDevice);
+    return StatusCode::OK;
+}
+
+void ModelProfiler::stop() {
+    std::lock_guard<std::mutex> controlLock(controlMtx);
+    stopWorker();
+}
+
+void ModelProfiler::stopWorker() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopRequested = true;
+        remainingSamples.store(0);
+    }
+    sampleSignal.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    stopRequested = false;
+    sampleInProgress = false;
+    pendingInputs.reset();
+    inputs.clear();
+    inferRequest.reset();
+    compiledModel.reset();
+}
+
+void ModelProfiler::profile(ov::InferRequest& source) {
+    // Request is not sampled when other sample is being profiled, so it is delayed only by copying its inputs
+    std::unique_lock<std::mutex> lock(mtx, std::try_to_lock);
+    if (!lock.owns_lock() || remainingSamples.load() == 0 || sampleInProgress) {
+        return;
+    }
+    std::vector<ov::Tensor> tensors;
+    tensors.reserve(inputs.size());
+    try {
+        for (const auto& input : inputs) {
+            const ov::Tensor sourceTensor = source.get_tensor(input.get_any_name());
+            ov::Tensor tensor(sourceTensor.get_element_type(), sourceTensor.get_shape());
+            std::memcpy(tensor.data(), sourceTensor.data(), sourceTensor.get_byte_size());
+            tensors.emplace_back(std::move(tensor));
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_WARN("Copying inputs for profiling failed: {}", e.what());
+        return;
+    }
+    remainingSamples--;
+    sampleInProgress = true;
+    pendingInputs = std::move(tensors);
+    lock.unlock();
+    sampleSignal.notify_one();
+}
+
+void ModelProfiler::run() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        sampleSignal.wait(lock, [this]() { return stopRequested || pendingInputs.has_value(); });
+        if (stopRequested) {
+            return;
+        }
+        std::vector<ov::Tensor> tensors = std::move(pendingInputs.value());
+        pendingInputs.reset();
+        lock.unlock();
+        // Side infer request is used only by this thread, until it is joined
+        std::vector<ov::ProfilingInfo> profilingInfo;
+        bool succeeded = false;
+        try {
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                inferRequest->set_tensor(inputs[i], tensors[i]);
+            }
+            inferRequest->infer();
+            profilingInfo = inferRequest->get_profiling_info();
+            succeeded = true;
+        } catch (const ov::Exception& e) {
+            SPDLOG_WARN("Profiling inference failed: {}", e.what());
+        }
+        lock.lock();
+        sampleInProgress = false;
+        if (succeeded) {
+            aggregate(profilingInfo);
+            collectedSamples++;
+        } else {
+            failedSamples++;
+        }
+        if (remainingSamples.load() == 0) {
+            SPDLOG_INFO("Profiling finished; collected samples: {}", collectedSamples);
+            inputs.clear();
+            inferRequest.reset();
+            compiledModel.reset();
+            return;
+        }
+    }
+}
+
+void ModelProfiler::aggregate(const std::vector<ov::ProfilingInfo>& profilingInfo) {
+    for (const auto& info : profilingInfo) {
+        if (info.status != ov::ProfilingInfo::Status::EXECUTED) {
+            continue;
+        }
+        auto it = layersIndex.find(info.node_name);
+        if (it == layersIndex.end()) {
+            LayerProfile layer;
+            layer.name = info.node_name;
+            layer.nodeType = info.node_type;
+            layer.execType = info.exec_type;
+            auto precisionIt = runtimePrecisions.find(info.node_name);
+            if (precisionIt != runtimePrecisions.end()) {
+                layer.precision = precisionIt->second;
+            }
+            it = layersIndex.emplace(info.node_name, layers.size()).first;
+            layers.emplace_back(std::move(layer));
+        }
+        auto& layer = layers[it->second];
+        layer.count++;
+        layer.realTime += info.real_time;
+        layer.cpuTime += info.cpu_time;
+    }
+}
+
+uint32_t ModelProfiler::getRequestedSamples() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return requestedSamples;
+}
+
+uint32_t ModelProfiler::getCollectedSamples() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return collectedSamples;
+}
+
+std::vector<LayerProfile> ModelProfiler::getLayers() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return layers;
+}
+
+std::string ModelProfiler::toJson(const std::string& modelName, int64_t modelVersion) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.String("model");
+    writer.String(modelName.c_str());
+    writer.String("version");
+    writer.Int64(modelVersion);
+    writer.String("state");
+    if (requestedSamples == 0) {
+        writer.String("IDLE");
+    } else if (remainingSamples.load() > 0 || sampleInProgress) {
+        writer.String("IN_PROGRESS");
+    } else {
+        writer.String("FINISHED");
+    }
+    writer.String("requested_samples");
+    writer.Uint(requestedSamples);
+    writer.String("collected_samples");
+    writer.Uint(collectedSamples);
+    writer.String("failed_samples");
+    writer.Uint(failedSamples);
+    writer.String("layers");
+    writer.StartArray();
+    for (const auto& layer : layers) {
+        writer.StartObject();
+        writer.String("name");
+        writer.String(layer.name.c_str());
+        writer.String("node_type");
+        writer.String(layer.nodeType.c_str());
+        writer.String("exec_type");
+        writer.String(layer.execType.c_str());
+        writer.String("precision");
+        writer.String(layer.precision.c_str());
+        writer.String("count");
+        writer.Uint(layer.count);
+        writer.String("real_time_us");
+        writer.Int64(layer.realTime.count());
+        writer.String("avg_real_time_us");
+        writer.Double(layer.count ? static_cast<double>(layer.realTime.count()) / layer.count : 0.0);
+        writer.String("cpu_time_us");
+        writer.Int64(layer.cpuTime.count());
+        writer.String("avg_cpu_time_us");
+        writer.Double(layer.count ? static_cast<double>(layer.cpuTime.count()) / layer.count : 0.0);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+}  // namespace ovms
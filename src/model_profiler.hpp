@@ -0,0 +1,119 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "modelconfig.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Per layer profiling counters aggregated over sampled requests
+ */
+struct LayerProfile {
+    std::string name;
+    std::string nodeType;
+    std::string execType;
+    std::string precision;
+    uint32_t count = 0;
+    std::chrono::microseconds realTime{0};
+    std::chrono::microseconds cpuTime{0};
+};
+
+/**
+ * @brief Collects per layer execution times of a model version on demand.
+ * Profiling is enabled on a side compiled model, so infer requests serving regular traffic
+ * are not affected. Inputs of each of the next N requests of the model version are copied and
+ * executed on the side compiled model by the profiler's own thread, and its ov::ProfilingInfo
+ * is aggregated. Side compiled model is released as soon as N samples are collected.
+ */
+class ModelProfiler {
+    mutable std::mutex mtx;
+    // Serializes starting and stopping of profiling thread
+    std::mutex controlMtx;
+    std::condition_variable sampleSignal;
+    std::thread worker;
+    std::atomic<uint32_t> remainingSamples{0};
+
+    std::unique_ptr<ov::CompiledModel> compiledModel;
+    std::unique_ptr<ov::InferRequest> inferRequest;
+    std::vector<ov::Output<const ov::Node>> inputs;
+    std::optional<std::vector<ov::Tensor>> pendingInputs;
+    bool sampleInProgress = false;
+    bool stopRequested = false;
+
+    uint32_t requestedSamples = 0;
+    uint32_t collectedSamples = 0;
+    uint32_t failedSamples = 0;
+    std::vector<LayerProfile> layers;
+    std::unordered_map<std::string, size_t> layersIndex;
+    std::unordered_map<std::string, std::string> runtimePrecisions;
+
+    void aggregate(const std::vector<ov::ProfilingInfo>& profilingInfo);
+    void run();
+    void stopWorker();
+
+public:
+    static const uint32_t MAX_SAMPLES;
+
+    ModelProfiler() = default;
+    ModelProfiler(const ModelProfiler&) = delete;
+    ModelProfiler& operator=(const ModelProfiler&) = delete;
+    ~ModelProfiler();
+
+    /**
+     * @brief Compiles model with profiling enabled and starts sampling of next requests.
+     * Results of previous session are discarded. Zero samples stops current session.
+     */
+    Status start(ov::Core& ieCore, const std::shared_ptr<ov::Model>& model, const std::string& targetDevice, plugin_config_t pluginConfig, uint32_t samples);
+    void stop();
+
+    bool isActive() const {
+        return remainingSamples.load(std::memory_order_relaxed) > 0;
+    }
+
+    /**
+     * @brief Copies input tensors of already executed infer request for profiled inference,
+     * if sampling is still in progress and previous sample is already processed.
+     * Does not wait for profiled inference.
+     */
+    void profile(ov::InferRequest& source);
+
+    uint32_t getRequestedSamples() const;
+    uint32_t getCollectedSamples() const;
+    std::vector<LayerProfile> getLayers() const;
+
+    /**
+     * @brief Serializes session state and per layer results to JSON
+     */
+    std::string toJson(const std::string& modelName, int64_t modelVersion) const;
+};
+
+}  // namespace ovms
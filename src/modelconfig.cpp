@@ -91,6 +91,10 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to named layout mismatch", this->name);
         return true;
     }
+    if (!isColorFormatConfigurationEqual(rhs)) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to color format mismatch", this->name);
+        return true;
+    }
     if (!isShapeConfigurationEqual(rhs)) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shape configuration mismatch", this->name);
         return true;
@@ -148,6 +152,22 @@ bool ModelConfig::isLayoutConfigurationEqual(const ModelConfig& rhs) const {
     return true;
 }
 
+bool ModelConfig::isColorFormatConfigurationEqual(const ModelConfig& rhs) const {
+    if (this->colorFormats.size() != rhs.colorFormats.size()) {
+        return false;
+    }
+    for (const auto& [name, colorFormat] : this->colorFormats) {
+        auto it = rhs.colorFormats.find(name);
+        if (it == rhs.colorFormats.end()) {
+            return false;
+        }
+        if (colorFormat != it->second) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ModelConfig::isShapeConfigurationEqual(const ModelConfig& rhs) const {
     if (this->shapes.size() != rhs.shapes.size()) {
         return false;
@@ -371,6 +391,40 @@ Status ModelConfig::parseLayoutParameter(const std::string& command) {
     return parseLayoutParameter(node);
 }
 
+Status ModelConfig::parseColorFormatParameter(const rapidjson::Value& node) {
+    if (!node.IsObject()) {
+        return StatusCode::COLOR_FORMAT_WRONG_FORMAT;
+    }
+    color_format_configurations_map_t colorFormats;
+    for (auto it = node.MemberBegin(); it != node.MemberEnd(); ++it) {
+        if (!it->value.IsString()) {
+            return StatusCode::COLOR_FORMAT_WRONG_FORMAT;
+        }
+        ColorFormatConfiguration colorFormat;
+        auto status = ColorFormatConfiguration::fromString(it->value.GetString(), colorFormat);
+        if (!status.ok()) {
+            return status;
+        }
+        colorFormats[it->name.GetString()] = colorFormat;
+    }
+    setColorFormats(colorFormats);
+
+    return StatusCode::OK;
+}
+
+Status ModelConfig::parseColorFormatParameter(const std::string& command) {
+    this->colorFormats.clear();
+    if (command.empty()) {
+        return StatusCode::OK;
+    }
+
+    rapidjson::Document node;
+    if (node.Parse(command.c_str()).HasParseError()) {
+        return StatusCode::COLOR_FORMAT_WRONG_FORMAT;
+    }
+    return parseColorFormatParameter(node);
+}
+
 Status ModelConfig::parseShape(ShapeInfo& shapeInfo, const std::string& str) {
     if (str == "auto") {
         shapeInfo.shapeMode = AUTO;
@@ -525,6 +579,13 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         }
     }
 
+    if (v.HasMember("color_format")) {
+        Status status = this->parseColorFormatParameter(v["color_format"]);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
     if (v.HasMember("plugin_config")) {
         auto status = parsePluginConfig(v["plugin_config"]);
         if (!status.ok()) {
@@ -622,6 +683,21 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         SPDLOG_DEBUG("low_latency_transformation: {}", isLowLatencyTransformationUsed());
     }
 
+    if (v.HasMember("overload_fallback")) {
+        if (this->isStateful()) {
+            SPDLOG_ERROR("Overload fallback was set for stateful model {}.", v["name"].GetString());
+            return StatusCode::OVERLOAD_FALLBACK_STATEFUL_MODEL;
+        }
+        OverloadFallbackPolicy policy;
+        auto status = OverloadFallbackPolicy::fromJson(v["overload_fallback"], policy);
+        if (!status.ok()) {
+            SPDLOG_ERROR("Couldn't parse overload fallback for model {}.", v["name"].GetString());
+            return status;
+        }
+        this->setOverloadFallbackPolicy(policy);
+        SPDLOG_DEBUG("overload_fallback: {}", policy.toString());
+    }
+
     // Model Cache options
     if (v.HasMember("allow_cache")) {
         setAllowCache(v["allow_cache"].GetBool());
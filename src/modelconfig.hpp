@@ -26,9 +26,11 @@
 
 #include <rapidjson/document.h>
 
+#include "color_format_configuration.hpp"
 #include "layout_configuration.hpp"
 #include "metric_config.hpp"
 #include "model_version_policy.hpp"
+#include "overload_fallback.hpp"
 #include "shape.hpp"
 #include "status.hpp"
 
@@ -143,6 +145,11 @@ private:
          */
     layout_configurations_map_t layouts;
 
+    /**
+         * @brief Map of raw frame color formats
+         */
+    color_format_configurations_map_t colorFormats;
+
     /**
          * @brief Input mapping configuration
          */
@@ -182,6 +189,11 @@ private:
          */
     static const std::set<std::string> configAllowedLayouts;
 
+    /**
+         * @brief Routing of requests to lighter version under overload
+         */
+    OverloadFallbackPolicy overloadFallbackPolicy;
+
     /**
          * @brief custom_loader_options config as map
          */
@@ -230,6 +242,7 @@ public:
         layout(""),
         shapes({}),
         layouts({}),
+        colorFormats({}),
         mappingInputs({}),
         mappingOutputs({}) {
         setBatchingParams(configBatchSize);
@@ -271,6 +284,15 @@ public:
          */
     bool isLayoutConfigurationEqual(const ModelConfig& rhs) const;
 
+    /**
+         * @brief Compares two ModelConfig instances for color format configuration
+         * 
+         * @param rhs
+         *  
+         * @return true if configurations are equal false otherwise
+         */
+    bool isColorFormatConfigurationEqual(const ModelConfig& rhs) const;
+
     /**
          * @brief Compares two ModelConfig instances for shape configuration
          * 
@@ -675,6 +697,24 @@ public:
          */
     Status parseLayoutParameter(const std::string& command);
 
+    /**
+         * @brief Parses value from json and extracts color formats of raw frame inputs
+         * 
+         * @param rapidjson::Value& node
+         * 
+         * @return status
+         */
+    Status parseColorFormatParameter(const rapidjson::Value& node);
+
+    /**
+         * @brief Parses json string and extracts color formats of raw frame inputs
+         * 
+         * @param string
+         * 
+         * @return status
+         */
+    Status parseColorFormatParameter(const std::string& command);
+
     /**
          * @brief Returns true if any input shape specified in shapes map is in AUTO mode
          * 
@@ -795,6 +835,24 @@ public:
         this->layout = LayoutConfiguration();
     }
 
+    /**
+         * @brief Get the color formats
+         * 
+         * @return const color_format_configurations_map_t& 
+         */
+    const color_format_configurations_map_t& getColorFormats() const {
+        return this->colorFormats;
+    }
+
+    /**
+         * @brief Set the color formats
+         * 
+         * @param colorFormats 
+         */
+    void setColorFormats(const color_format_configurations_map_t& colorFormats) {
+        this->colorFormats = colorFormats;
+    }
+
     /**
          * @brief Get the version
          * 
@@ -980,6 +1038,24 @@ public:
         return this->customLoaderOptionsStr;
     }
 
+    /**
+         * @brief Get the overload fallback policy
+         *
+         * @return const OverloadFallbackPolicy&
+         */
+    const OverloadFallbackPolicy& getOverloadFallbackPolicy() const {
+        return this->overloadFallbackPolicy;
+    }
+
+    /**
+         * @brief Set the overload fallback policy
+         *
+         * @param policy
+         */
+    void setOverloadFallbackPolicy(const OverloadFallbackPolicy& policy) {
+        this->overloadFallbackPolicy = policy;
+    }
+
     /**
          * @brief Parses json node for custom_loader_options config keys and values
          *
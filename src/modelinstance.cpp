@@ -17,27 +17,36 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <exception>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
 
 #include <dirent.h>
 #include <spdlog/spdlog.h>
 #include <sys/types.h>
 
+#include "alloc_tracker.hpp"
+#include "color_format_configuration.hpp"
 #include "config.hpp"
+#include "cpu_topology.hpp"
 #include "customloaders.hpp"
 #include "deserialization.hpp"
 #include "executingstreamidguard.hpp"
 #include "filesystem.hpp"
 #include "layout.hpp"
 #include "layout_configuration.hpp"
+#include "load_phase_profiler.hpp"
 #include "logging.hpp"
+#include "memory_accounting.hpp"
 #include "model_metric_reporter.hpp"
 #include "ov_utils.hpp"
+#include "perf_counters.hpp"
 #include "predict_request_validation_utils.hpp"
 #include "prediction_service_utils.hpp"
 #include "profiler.hpp"
@@ -160,6 +169,18 @@ Status validateConfigurationAgainstNetwork(const ModelConfig& config, std::share
             return StatusCode::CONFIG_LAYOUT_IS_NOT_IN_MODEL;
         }
     }
+    for (const auto& [name, colorFormat] : config.getColorFormats()) {
+        // Model with color conversion already applied exposes separate inputs for planes
+        const auto planeNames = colorFormat.getPlaneNames();
+        const std::string firstPlaneName = planeNames.empty() ? name : name + "/" + planeNames[0];
+        if (hasInputWithName(model, name) && config.getMappingInputByKey(name) != "") {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Config color format - {} is mapped by {}. Changes will not apply", name, config.getMappingInputByKey(name));
+            return StatusCode::CONFIG_LAYOUT_MAPPED_BUT_USED_REAL_NAME;
+        } else if (!hasInputWithName(model, name) && !hasInputWithName(model, config.getRealInputNameByValue(name)) && !hasInputWithName(model, firstPlaneName)) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Config color format - {} not found in model", name);
+            return StatusCode::CONFIG_COLOR_FORMAT_IS_NOT_IN_MODEL;
+        }
+    }
     return StatusCode::OK;
 }
 
@@ -197,6 +218,56 @@ const Layout ModelInstance::getReportedTensorLayout(const ModelConfig& config, c
     return layout;
 }
 
+static ov::preprocess::ColorFormat getOvColorFormat(SourceColorFormat colorFormat) {
+    switch (colorFormat) {
+    case SourceColorFormat::NV12:
+        return ov::preprocess::ColorFormat::NV12_SINGLE_PLANE;
+    case SourceColorFormat::NV12_TWO_PLANES:
+        return ov::preprocess::ColorFormat::NV12_TWO_PLANES;
+    case SourceColorFormat::I420:
+        return ov::preprocess::ColorFormat::I420_SINGLE_PLANE;
+    case SourceColorFormat::I420_THREE_PLANES:
+        return ov::preprocess::ColorFormat::I420_THREE_PLANES;
+    }
+    return ov::preprocess::ColorFormat::UNDEFINED;
+}
+
+static ov::preprocess::ColorFormat getOvColorFormat(TargetColorFormat colorFormat) {
+    return colorFormat == TargetColorFormat::RGB ? ov::preprocess::ColorFormat::RGB : ov::preprocess::ColorFormat::BGR;
+}
+
+/**
+ * @brief Makes input accept raw u8 frames of any resolution. Color conversion, element type conversion
+ * and resize to model resolution become part of the compiled model, so they run on the target device.
+ */
+static void applyColorFormatConfiguration(ov::preprocess::InputInfo& input, const ColorFormatConfiguration& colorFormat) {
+    input.tensor()
+        .set_element_type(ov::element::u8)
+        .set_color_format(getOvColorFormat(colorFormat.getSource()), colorFormat.getPlaneNames())
+        .set_spatial_dynamic_shape();
+    input.preprocess()
+        .convert_color(getOvColorFormat(colorFormat.getTarget()))
+        .convert_element_type()
+        .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR);
+}
+
+/**
+ * @brief Resize of raw frames requires height and width dimensions to be known. Without layout
+ * in configuration or model, they are located by the position of 3 channels dimension in 4D shape.
+ */
+static std::optional<ov::Layout> guessImageLayout(const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic() || shape.rank().get_length() != 4) {
+        return std::nullopt;
+    }
+    if (shape[1].is_static() && shape[1].get_length() == 3) {
+        return ov::Layout("NCHW");
+    }
+    if (shape[3].is_static() && shape[3].get_length() == 3) {
+        return ov::Layout("NHWC");
+    }
+    return std::nullopt;
+}
+
 Status applyLayoutConfiguration(const ModelConfig& config, std::shared_ptr<ov::Model>& model, const std::string& modelName, model_version_t modelVersion) {
     ov::preprocess::PrePostProcessor preproc(model);
 
@@ -206,6 +277,8 @@ Status applyLayoutConfiguration(const ModelConfig& config, std::shared_ptr<ov::M
         try {
             std::string name = input.get_any_name();
             std::string mappedName = config.getMappingInputByKey(name).empty() ? name : config.getMappingInputByKey(name);
+            auto colorFormatIt = config.getColorFormats().find(mappedName);
+            bool hasColorFormat = colorFormatIt != config.getColorFormats().end();
             if (config.getLayout().isSet()) {
                 SPDLOG_LOGGER_DEBUG(modelmanager_logger, "model: {}, version: {}; Adding preprocessing step: Tensor Layout:{}; Network Layout:{}; single input",
                     modelName,
@@ -228,17 +301,32 @@ Status applyLayoutConfiguration(const ModelConfig& config, std::shared_ptr<ov::M
                 preproc.input(name).model().set_layout(ov::Layout(layout.getModelLayout()));
             } else {
                 auto inheritedModelLayout = getLayoutFromRTMap(input.get_rt_info());
-                auto guessedModelLayout = Layout::getDefaultLayout();
-
-                ov::Layout targetModelLayout = inheritedModelLayout.has_value() ? inheritedModelLayout.value() : ov::Layout(guessedModelLayout);
+                ov::Layout targetModelLayout = inheritedModelLayout.has_value() ? inheritedModelLayout.value() : ov::Layout(Layout::getDefaultLayout());
 
                 if (inheritedModelLayout.has_value()) {
                     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "model: {}, version: {}; Configuring layout: Tensor Layout:; Network Layout:{} (inherited from network); input name: {}", modelName, modelVersion, targetModelLayout.to_string(), name);
+                } else if (hasColorFormat) {
+                    auto guessedModelLayout = guessImageLayout(input.get_partial_shape());
+                    if (!guessedModelLayout.has_value()) {
+                        SPDLOG_LOGGER_ERROR(modelmanager_logger, "model: {}, version: {}; Cannot determine layout of input: {} with color format; shape: {}; set layout parameter",
+                            modelName, modelVersion, mappedName, input.get_partial_shape().to_string());
+                        return StatusCode::CONFIG_COLOR_FORMAT_LAYOUT_UNKNOWN;
+                    }
+                    targetModelLayout = guessedModelLayout.value();
+                    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "model: {}, version: {}; Configuring layout: Tensor Layout:; Network Layout:{} (guessed from shape for color format); input name: {}", modelName, modelVersion, targetModelLayout.to_string(), name);
                 } else {
                     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "model: {}, version: {}; Configuring layout: Tensor Layout:; Network Layout:{} (default); input name: {}", modelName, modelVersion, targetModelLayout.to_string(), name);
                 }
                 preproc.input(name).model().set_layout(targetModelLayout);
             }
+            if (hasColorFormat) {
+                SPDLOG_LOGGER_DEBUG(modelmanager_logger, "model: {}, version: {}; Adding preprocessing step: Color Format:{}; Resize:linear; input name: {}",
+                    modelName,
+                    modelVersion,
+                    colorFormatIt->second.toString(),
+                    mappedName);
+                applyColorFormatConfiguration(preproc.input(name), colorFormatIt->second);
+            }
         } catch (const ov::Exception& e) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to configure input layout for model:{}; version:{}; from OpenVINO with error:{}",
                 modelName,
@@ -655,6 +743,16 @@ void ModelInstance::loadCompiledModelPtr(const plugin_config_t& pluginConfig) {
 
 plugin_config_t ModelInstance::prepareDefaultPluginConfig(const ModelConfig& config) {
     plugin_config_t pluginConfig = config.getPluginConfig();
+    // When inference cores are reserved, let CPU plugin size & pin its threads to that set only
+    const auto& inferenceCores = CpuTopology::instance().getInferenceCores();
+    if (!inferenceCores.empty() && config.isSingleDeviceUsed("CPU")) {
+        if (pluginConfig.count("CPU_BIND_THREAD") == 0) {
+            pluginConfig["CPU_BIND_THREAD"] = "YES";
+        }
+        if (pluginConfig.count("CPU_THREADS_NUM") == 0) {
+            pluginConfig["CPU_THREADS_NUM"] = std::to_string(inferenceCores.size());
+        }
+    }
     // Do not add CPU_THROUGHPUT_AUTO when performance hint is specified.
     bool isPerformanceHintSpecified = pluginConfig.count("PERFORMANCE_HINT") > 0;
     if (isPerformanceHintSpecified) {
@@ -676,6 +774,7 @@ plugin_config_t ModelInstance::prepareDefaultPluginConfig(const ModelConfig& con
 
 Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
     plugin_config_t pluginConfig = prepareDefaultPluginConfig(config);
+    CompiledModelMemoryProbe memoryProbe(ieCore, config.getTargetDevice());
     try {
         loadCompiledModelPtr(pluginConfig);
     } catch (ov::Exception& e) {
@@ -697,6 +796,10 @@ Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
             config.getTargetDevice());
         return status;
     }
+    memoryUsage.compiledModel = memoryProbe.getAllocatedBytes();
+    memoryUsage.weights = getModelWeightsBytes(model);
+    SET_IF_ENABLED(this->getMetricReporter().memoryCompiledModel, memoryUsage.compiledModel);
+    SET_IF_ENABLED(this->getMetricReporter().memoryWeights, memoryUsage.weights);
 
     uint32_t numberOfStreams = 0;
     try {
@@ -803,11 +906,29 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     }
     inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*compiledModel, numberOfParallelInferRequests);
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, numberOfParallelInferRequests);
+    if (this->getMetricReporter().inferReqWaiting) {
+        MetricGauge* inferReqWaiting = this->getMetricReporter().inferReqWaiting.get();
+        inferReqWaiting->set(0);
+        inferRequestsQueue->setWaitersObserver([inferReqWaiting](size_t waiters) {
+            inferReqWaiting->set(waiters);
+        });
+    }
+    memoryUsage.inferRequests = 0;
+    for (uint i = 0; i < numberOfParallelInferRequests; ++i) {
+        memoryUsage.inferRequests += getInferRequestTensorsBytes(inferRequestsQueue->getInferRequest(i), *compiledModel);
+    }
+    SET_IF_ENABLED(this->getMetricReporter().memoryInferRequests, memoryUsage.inferRequests);
     SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}",
         getName(),
         getVersion(),
         getBatchSize().toString(),
         numberOfParallelInferRequests);
+    SPDLOG_INFO("Memory usage of model {}; version: {}; weights: {} bytes; compiled model: {} bytes; infer requests: {} bytes",
+        getName(),
+        getVersion(),
+        memoryUsage.weights,
+        memoryUsage.compiledModel,
+        memoryUsage.inferRequests);
     return StatusCode::OK;
 }
 
@@ -820,7 +941,7 @@ void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicM
 }
 
 Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicModelParameter& parameter) {
-    bool isLayoutConfigurationChanged = !config.isLayoutConfigurationEqual(this->config);
+    bool isLayoutConfigurationChanged = !config.isLayoutConfigurationEqual(this->config) || !config.isColorFormatConfigurationEqual(this->config);
     bool needsToApplyLayoutConfiguration = isLayoutConfigurationChanged || !this->model;
 
     subscriptionManager.notifySubscribers();
@@ -841,6 +962,7 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
         }
 
         if (!this->model || isLayoutConfigurationChanged) {
+            ScopedLoadPhaseTimer phaseTimer(LoadPhase::READ);
             if (this->config.isCustomLoaderRequiredToLoadModel()) {
                 // loading the model using the custom loader
                 status = loadOVModelUsingCustomLoader();
@@ -854,17 +976,26 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             return status;
         }
 
-        status = loadTensors(this->config, needsToApplyLayoutConfiguration, parameter);
+        {
+            ScopedLoadPhaseTimer phaseTimer(LoadPhase::RESHAPE);
+            status = loadTensors(this->config, needsToApplyLayoutConfiguration, parameter);
+        }
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
-        status = loadOVCompiledModel(this->config);
+        {
+            ScopedLoadPhaseTimer phaseTimer(LoadPhase::COMPILE);
+            status = loadOVCompiledModel(this->config);
+        }
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
-        status = prepareInferenceRequestsQueue(this->config);
+        {
+            ScopedLoadPhaseTimer phaseTimer(LoadPhase::INFER_REQUESTS_CREATION);
+            status = prepareInferenceRequestsQueue(this->config);
+        }
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
@@ -1094,7 +1225,13 @@ void ModelInstance::unloadModelComponents() {
         std::this_thread::sleep_for(std::chrono::milliseconds(UNLOAD_AVAILABILITY_CHECKING_INTERVAL_MILLISECONDS));
     }
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, 0);
+    SET_IF_ENABLED(this->getMetricReporter().inferReqWaiting, 0);
     SET_IF_ENABLED(this->getMetricReporter().streams, 0);
+    SET_IF_ENABLED(this->getMetricReporter().memoryWeights, 0);
+    SET_IF_ENABLED(this->getMetricReporter().memoryCompiledModel, 0);
+    SET_IF_ENABLED(this->getMetricReporter().memoryInferRequests, 0);
+    memoryUsage = ModelMemoryUsage();
+    profiler.stop();
     inferRequestsQueue.reset();
     compiledModel.reset();
     model.reset();
@@ -1134,8 +1271,32 @@ const Status ModelInstance::validate(const RequestType* request) {
 template const Status ModelInstance::validate(const ::inference::ModelInferRequest* request);
 template const Status ModelInstance::validate(const tensorflow::serving::PredictRequest* request);
 
+void ModelInstance::observeBatchSize(ov::InferRequest& inferRequest) {
+    if (!this->getMetricReporter().inferenceBatchSize) {
+        return;
+    }
+    const auto& inputItr = this->inputsInfo.cbegin();
+    if (inputItr == this->inputsInfo.cend()) {
+        return;
+    }
+    const auto& input = inputItr->second;
+    const auto batchIndex = input->getLayout().getBatchIndex();
+    if (!batchIndex.has_value()) {
+        return;
+    }
+    try {
+        const auto shape = inferRequest.get_tensor(input->getName()).get_shape();
+        if (batchIndex.value() < shape.size()) {
+            this->getMetricReporter().inferenceBatchSize->observe(shape[batchIndex.value()]);
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("Cannot read batch size of model: {}, version: {}, input: {}; {}", getName(), getVersion(), input->getName(), e.what());
+    }
+}
+
 Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
     OVMS_PROFILE_FUNCTION();
+    observeBatchSize(inferRequest);
     try {
         enum : unsigned int {
             INFER,
@@ -1157,17 +1318,31 @@ Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
         SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
         return status;
     }
+    if (profiler.isActive()) {
+        profiler.profile(inferRequest);
+    }
     return StatusCode::OK;
 }
 
-Status ModelInstance::infer(const tensorflow::serving::PredictRequest* requestProto,
-    tensorflow::serving::PredictResponse* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
-    OVMS_PROFILE_FUNCTION();
+Status ModelInstance::startProfiling(uint32_t samples) {
+    // Loading lock is not taken, since unloading holds it while waiting for unload guards to be released
+    if (samples > 0 && (getStatus().getState() != ModelVersionState::AVAILABLE || !model)) {
+        return StatusCode::MODEL_VERSION_NOT_LOADED_YET;
+    }
+    SPDLOG_DEBUG("Setting profiling samples: {} of model: {} version: {}", samples, getName(), getVersion());
+    return profiler.start(ieCore, model, targetDevice, prepareDefaultPluginConfig(config), samples);
+}
+
+template <typename RequestType>
+Status ModelInstance::prepareInference(const RequestType* requestProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    std::unique_ptr<ExecutingStreamIdGuard>& executingStreamIdGuard) {
     Timer<TIMER_END> timer;
     using std::chrono::microseconds;
 
+    AllocTrackingScope validationAllocScope(ALLOC_STAGE_VALIDATION);
     auto status = validate(requestProto);
+    validationAllocScope.stop();
     auto requestBatchSize = getRequestBatchSize(requestProto, this->getBatchSizeIndex());
     auto requestShapes = getRequestShapes(requestProto);
     status = reloadModelIfRequired(status, requestBatchSize, requestShapes, modelUnloadGuardPtr);
@@ -1175,102 +1350,190 @@ Status ModelInstance::infer(const tensorflow::serving::PredictRequest* requestPr
         return status;
     timer.start(GET_INFER_REQUEST);
     OVMS_PROFILE_SYNC_BEGIN("getInferRequest");
-    ExecutingStreamIdGuard executingStreamIdGuard(getInferRequestsQueue(), this->getMetricReporter());
-    int executingInferId = executingStreamIdGuard.getId();
-    ov::InferRequest& inferRequest = executingStreamIdGuard.getInferRequest();
+    executingStreamIdGuard = std::make_unique<ExecutingStreamIdGuard>(getInferRequestsQueue(), this->getMetricReporter());
+    int executingInferId = executingStreamIdGuard->getId();
+    ov::InferRequest& inferRequest = executingStreamIdGuard->getInferRequest();
     OVMS_PROFILE_SYNC_END("getInferRequest");
     timer.stop(GET_INFER_REQUEST);
     double getInferRequestTime = timer.elapsed<microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    this->inferRequestWaitEstimator.observe(getInferRequestTime / 1000);
     SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_spec().name(), getVersion(), executingInferId, getInferRequestTime / 1000);
+        getName(), getVersion(), executingInferId, getInferRequestTime / 1000);
 
     timer.start(DESERIALIZE);
+    PerfCountersScope deserializeCounters(getMetricReporter().getHwEvents(PERF_STAGE_DESERIALIZE));
+    AllocTrackingScope deserializeAllocScope(ALLOC_STAGE_DESERIALIZE);
     InputSink<ov::InferRequest&> inputSink(inferRequest);
     bool isPipeline = false;
     status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
+    deserializeAllocScope.stop();
+    deserializeCounters.stop();
     timer.stop(DESERIALIZE);
     if (!status.ok())
         return status;
     SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_spec().name(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
-
-    timer.start(PREDICTION);
-    status = performInference(inferRequest);
-    timer.stop(PREDICTION);
-    if (!status.ok())
-        return status;
-    SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_spec().name(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
+        getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
+    return StatusCode::OK;
+}
 
+template <typename ResponseType>
+Status ModelInstance::serializeResponse(ov::InferRequest& inferRequest, ResponseType* responseProto, int executingInferId) {
+    Timer<TIMER_END> timer;
     timer.start(SERIALIZE);
+    PerfCountersScope serializeCounters(getMetricReporter().getHwEvents(PERF_STAGE_SERIALIZE));
+    AllocTrackingScope serializeAllocScope(ALLOC_STAGE_SERIALIZE);
     OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
-    status = serializePredictResponse(outputGetter, getOutputsInfo(), responseProto, getTensorInfoName);
+    auto status = serializePredictResponse(outputGetter, getOutputsInfo(), responseProto, getTensorInfoName);
+    serializeAllocScope.stop();
+    serializeCounters.stop();
     timer.stop(SERIALIZE);
     if (!status.ok())
         return status;
+    // Version may differ from requested default one when overload fallback is active
+    if constexpr (std::is_same_v<ResponseType, ::inference::ModelInferResponse>) {
+        responseProto->set_model_name(getName());
+        responseProto->set_model_version(std::to_string(getVersion()));
+    } else {
+        responseProto->mutable_model_spec()->set_name(getName());
+        responseProto->mutable_model_spec()->mutable_version()->set_value(getVersion());
+    }
 
     SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_spec().name(), getVersion(), executingInferId, timer.elapsed<microseconds>(SERIALIZE) / 1000);
-
+        getName(), getVersion(), executingInferId, timer.elapsed<std::chrono::microseconds>(SERIALIZE) / 1000);
     return StatusCode::OK;
 }
 
-Status ModelInstance::infer(const ::inference::ModelInferRequest* requestProto,
-    ::inference::ModelInferResponse* responseProto,
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::inferImpl(const RequestType* requestProto,
+    ResponseType* responseProto,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
     OVMS_PROFILE_FUNCTION();
     Timer<TIMER_END> timer;
     using std::chrono::microseconds;
 
-    auto status = validate(requestProto);
-    auto requestBatchSize = getRequestBatchSize(requestProto, this->getBatchSizeIndex());
-    auto requestShapes = getRequestShapes(requestProto);
-    status = reloadModelIfRequired(status, requestBatchSize, requestShapes, modelUnloadGuardPtr);
-    if (!status.ok())
-        return status;
-    timer.start(GET_INFER_REQUEST);
-    ExecutingStreamIdGuard executingStreamIdGuard(getInferRequestsQueue(), this->getMetricReporter());
-    int executingInferId = executingStreamIdGuard.getId();
-    ov::InferRequest& inferRequest = executingStreamIdGuard.getInferRequest();
-    timer.stop(GET_INFER_REQUEST);
-    double getInferRequestTime = timer.elapsed<microseconds>(GET_INFER_REQUEST);
-    OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, getInferRequestTime);
-    SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_name(), getVersion(), executingInferId, getInferRequestTime / 1000);
-
-    timer.start(DESERIALIZE);
-    InputSink<ov::InferRequest&> inputSink(inferRequest);
-    bool isPipeline = false;
-    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
-    timer.stop(DESERIALIZE);
+    std::unique_ptr<ExecutingStreamIdGuard> executingStreamIdGuard;
+    auto status = prepareInference(requestProto, modelUnloadGuardPtr, executingStreamIdGuard);
     if (!status.ok())
         return status;
-    SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_name(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
+    int executingInferId = executingStreamIdGuard->getId();
+    ov::InferRequest& inferRequest = executingStreamIdGuard->getInferRequest();
 
     timer.start(PREDICTION);
+    PerfCountersScope inferCounters(getMetricReporter().getHwEvents(PERF_STAGE_INFER));
+    AllocTrackingScope inferAllocScope(ALLOC_STAGE_INFER);
     status = performInference(inferRequest);
+    inferAllocScope.stop();
+    inferCounters.stop();
     timer.stop(PREDICTION);
     if (!status.ok())
         return status;
     SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_name(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
+        getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
 
-    timer.start(SERIALIZE);
-    OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
-    status = serializePredictResponse(outputGetter, getOutputsInfo(), responseProto, getTensorInfoName);
-    timer.stop(SERIALIZE);
+    return serializeResponse(inferRequest, responseProto, executingInferId);
+}
+
+Status ModelInstance::infer(const tensorflow::serving::PredictRequest* requestProto,
+    tensorflow::serving::PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    return inferImpl(requestProto, responseProto, modelUnloadGuardPtr);
+}
+
+Status ModelInstance::infer(const ::inference::ModelInferRequest* requestProto,
+    ::inference::ModelInferResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    return inferImpl(requestProto, responseProto, modelUnloadGuardPtr);
+}
+
+namespace {
+struct AsyncInferenceState {
+    std::unique_ptr<ExecutingStreamIdGuard> executingStreamIdGuard;
+    std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+    std::chrono::steady_clock::time_point started;
+    std::chrono::steady_clock::time_point finished;
+    std::exception_ptr exception;
+};
+}  // namespace
+
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::startAsyncInference(const RequestType* requestProto,
+    ResponseType* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    AsyncInferenceCallback callback) {
+    OVMS_PROFILE_FUNCTION();
+    auto state = std::make_shared<AsyncInferenceState>();
+    auto status = prepareInference(requestProto, modelUnloadGuardPtr, state->executingStreamIdGuard);
     if (!status.ok())
         return status;
+    ov::InferRequest& inferRequest = state->executingStreamIdGuard->getInferRequest();
+    observeBatchSize(inferRequest);
+    state->unloadGuard = std::move(modelUnloadGuardPtr);
+
+    AsyncInferenceFinisher finisher = [this, state, responseProto]() -> Status {
+        Status status = StatusCode::OK;
+        if (state->exception) {
+            status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+            try {
+                std::rethrow_exception(state->exception);
+            } catch (const std::exception& e) {
+                SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+            }
+        } else {
+            double inferTime = std::chrono::duration_cast<std::chrono::microseconds>(state->finished - state->started).count();
+            OBSERVE_IF_ENABLED(this->getMetricReporter().inferenceTime, inferTime);
+            SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
+                getName(), getVersion(), state->executingStreamIdGuard->getId(), inferTime / 1000);
+            ov::InferRequest& inferRequest = state->executingStreamIdGuard->getInferRequest();
+            if (profiler.isActive()) {
+                profiler.profile(inferRequest);
+            }
+            status = serializeResponse(inferRequest, responseProto, state->executingStreamIdGuard->getId());
+        }
+        // Infer request is returned to the queue before model instance may be unloaded
+        state->executingStreamIdGuard.reset();
+        state->unloadGuard.reset();
+        return status;
+    };
 
-    responseProto->set_model_name(getName());
-    responseProto->set_model_version(std::to_string(getVersion()));
+    try {
+        inferRequest.set_callback([state, callback = std::move(callback), finisher](std::exception_ptr exception) mutable {
+            state->finished = std::chrono::steady_clock::now();
+            state->exception = exception;
+            auto onCompleted = std::move(callback);
+            auto finish = std::move(finisher);
+            // Infer request is reused by synchronous requests, so the callback can not outlive this inference
+            state->executingStreamIdGuard->getInferRequest().set_callback([](std::exception_ptr exception_ptr) {});
+            onCompleted(std::move(finish));
+        });
+        state->started = std::chrono::steady_clock::now();
+        // Only submission is counted on this thread, inference itself runs on plugin threads
+        PerfCountersScope inferCounters(getMetricReporter().getHwEvents(PERF_STAGE_INFER));
+        AllocTrackingScope inferAllocScope(ALLOC_STAGE_INFER);
+        OVMS_PROFILE_SYNC_BEGIN("ov::InferRequest::start_async");
+        inferRequest.start_async();
+        OVMS_PROFILE_SYNC_END("ov::InferRequest::start_async");
+    } catch (const ov::Exception& e) {
+        inferRequest.set_callback([](std::exception_ptr exception_ptr) {});
+        Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+        return status;
+    }
+    return StatusCode::OK;
+}
 
-    SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
-        requestProto->model_name(), getVersion(), executingInferId, timer.elapsed<microseconds>(SERIALIZE) / 1000);
+Status ModelInstance::inferAsync(const tensorflow::serving::PredictRequest* requestProto,
+    tensorflow::serving::PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    AsyncInferenceCallback callback) {
+    return startAsyncInference(requestProto, responseProto, modelUnloadGuardPtr, std::move(callback));
+}
 
-    return StatusCode::OK;
+Status ModelInstance::inferAsync(const ::inference::ModelInferRequest* requestProto,
+    ::inference::ModelInferResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    AsyncInferenceCallback callback) {
+    return startAsyncInference(requestProto, responseProto, modelUnloadGuardPtr, std::move(callback));
 }
 
 const size_t ModelInstance::getBatchSizeIndex() const {
@@ -33,12 +33,15 @@
 
 #include "customloaderconfig.hpp"
 #include "customloaderinterface.hpp"
+#include "memory_accounting.hpp"
 #include "model_metric_reporter.hpp"
+#include "model_profiler.hpp"
 #include "modelchangesubscription.hpp"
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelversionstatus.hpp"
 #include "ovinferrequestsqueue.hpp"
+#include "overload_fallback.hpp"
 #include "sequence_processing_spec.hpp"
 #include "status.hpp"
 #include "tensorinfo.hpp"
@@ -73,9 +76,21 @@ private:
     std::map<std::string, shape_t> shapes;
 };
 
+class ExecutingStreamIdGuard;
 class PipelineDefinition;
 class MetricRegistry;
 
+/**
+ * @brief Serializes outputs of completed asynchronous inference and releases infer request and model unload guard
+ */
+using AsyncInferenceFinisher = std::function<Status()>;
+
+/**
+ * @brief Called from OpenVINO callback thread once asynchronous inference ends. It should only schedule
+ * a continuation calling the finisher, so that serialization does not run on inference threads.
+ */
+using AsyncInferenceCallback = std::function<void(AsyncInferenceFinisher)>;
+
 /**
      * @brief This class contains all the information about model
      */
@@ -178,6 +193,21 @@ protected:
 
     std::unique_ptr<ModelMetricReporter> reporter;
 
+    /**
+         * @brief Collects per layer profiling info of sampled requests on demand
+         */
+    ModelProfiler profiler;
+
+    /**
+         * @brief Memory held by loaded model version, measured during load
+         */
+    ModelMemoryUsage memoryUsage;
+
+    /**
+         * @brief Average time requests wait for idle infer request, drives overload fallback of the model
+         */
+    InferRequestWaitEstimator inferRequestWaitEstimator;
+
     /**
          * @brief Load OV Engine
          */
@@ -319,6 +349,38 @@ private:
       */
     bool isCustomLoaderConfigChanged;
 
+    /**
+         * @brief Validates request, reloads model if required, acquires infer request and deserializes inputs into it.
+         * Shared by synchronous and asynchronous inference.
+         *
+         * @param executingStreamIdGuard set to guard holding acquired infer request
+         *
+         * @return Status
+         */
+    template <typename RequestType>
+    Status prepareInference(const RequestType* requestProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        std::unique_ptr<ExecutingStreamIdGuard>& executingStreamIdGuard);
+
+    /**
+         * @brief Serializes outputs of finished inference into response, together with served model name and version
+         *
+         * @return Status
+         */
+    template <typename ResponseType>
+    Status serializeResponse(ov::InferRequest& inferRequest, ResponseType* responseProto, int executingInferId);
+
+    template <typename RequestType, typename ResponseType>
+    Status inferImpl(const RequestType* requestProto,
+        ResponseType* responseProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+
+    template <typename RequestType, typename ResponseType>
+    Status startAsyncInference(const RequestType* requestProto,
+        ResponseType* responseProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        AsyncInferenceCallback callback);
+
 public:
     /**
          * @brief A default constructor
@@ -550,6 +612,25 @@ public:
 
     Status performInference(ov::InferRequest& inferRequest);
 
+    /**
+         * @brief Reports batch size of inputs set in infer request, when batch size histogram is enabled
+         */
+    void observeBatchSize(ov::InferRequest& inferRequest);
+
+    /**
+         * @brief Starts profiling of next samples requests on side compiled model, zero stops profiling.
+         * Caller has to hold unload guard of this instance.
+         *
+         * @return Status
+         */
+    Status startProfiling(uint32_t samples);
+
+    const ModelProfiler& getProfiler() const { return profiler; }
+
+    const ModelMemoryUsage& getMemoryUsage() const { return memoryUsage; }
+
+    InferRequestWaitEstimator& getInferRequestWaitEstimator() { return inferRequestWaitEstimator; }
+
     virtual Status infer(const tensorflow::serving::PredictRequest* requestProto,
         tensorflow::serving::PredictResponse* responseProto,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
@@ -557,6 +638,22 @@ public:
         ::inference::ModelInferResponse* responseProto,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
 
+    /**
+         * @brief Validates and deserializes request, then starts inference without waiting for it.
+         * Request and response have to stay valid until the finisher passed to callback is called.
+         * Callback is not called when returned status is not OK. Takes over model unload guard.
+         *
+         * @return Status
+         */
+    virtual Status inferAsync(const tensorflow::serving::PredictRequest* requestProto,
+        tensorflow::serving::PredictResponse* responseProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        AsyncInferenceCallback callback);
+    virtual Status inferAsync(const ::inference::ModelInferRequest* requestProto,
+        ::inference::ModelInferResponse* responseProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        AsyncInferenceCallback callback);
+
     ModelMetricReporter& getMetricReporter() const { return *this->reporter; }
 
     uint32_t getNumOfStreams() const;
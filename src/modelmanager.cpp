@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -34,7 +35,9 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "alloc_tracker.hpp"
 #include "azurefilesystem.hpp"
+#include "batch_job.hpp"
 #include "cleaner_utils.hpp"
 #include "config.hpp"
 #include "custom_node_library_manager.hpp"
@@ -47,6 +50,7 @@
 #include "logging.hpp"
 #include "metric_config.hpp"
 #include "metric_registry.hpp"
+#include "model_archive.hpp"
 #include "node_library.hpp"
 #include "openssl/md5.h"
 #include "ov_utils.hpp"
@@ -91,6 +95,9 @@ ModelManager::ModelManager(const std::string& modelCacheDirectory, MetricRegistr
         }
     }
     this->customNodeLibraryManager = std::make_unique<CustomNodeLibraryManager>();
+    this->tenantLimiter.setMetrics(&this->metricConfig, this->metricRegistry);
+    this->batchJobManager = std::make_unique<BatchJobManager>(*this);
+    AllocTracker::instance().setMetrics(&this->metricConfig, this->metricRegistry);
     if (ovms::Config::instance().cpuExtensionLibraryPath() != "") {
         SPDLOG_INFO("Loading custom CPU extension from {}", ovms::Config::instance().cpuExtensionLibraryPath());
         try {
@@ -140,7 +147,10 @@ void ModelManager::logPluginConfiguration() {
     }
 }
 
-ModelManager::~ModelManager() = default;
+ModelManager::~ModelManager() {
+    // Jobs use servables owned by manager, so they have to be stopped first
+    this->batchJobManager->stop();
+}
 
 Status ModelManager::start(const Config& config) {
     watcherIntervalSec = config.filesystemPollWaitSeconds();
@@ -150,6 +160,14 @@ Status ModelManager::start(const Config& config) {
         SPDLOG_LOGGER_WARN(modelmanager_logger, "Parameter: custom_node_resources_cleaner_interval has to be greater than 0. Applying default value(1 second)");
         resourcesCleanupIntervalSec = 1;
     }
+    TenantQuota tenantQuota;
+    tenantQuota.rateLimit = config.tenantRateLimit();
+    tenantQuota.burst = config.tenantBurst();
+    tenantQuota.maxConcurrency = config.tenantMaxConcurrency();
+    this->tenantLimiter.configure(config.tenantHeader(), tenantQuota, config.tenantMaxTracked());
+    if (this->tenantLimiter.isEnabled()) {
+        SPDLOG_LOGGER_INFO(modelmanager_logger, "Tenant isolation enabled. Tenant is identified by: {}", config.tenantHeader());
+    }
     Status status;
     bool startFromConfigFile = (config.configPath() != "");
     if (startFromConfigFile) {
@@ -163,6 +181,10 @@ Status ModelManager::start(const Config& config) {
     }
     startWatcher(startFromConfigFile);
     startCleaner();
+    status = this->batchJobManager->start(config.batchJobPath());
+    if (!status.ok()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Couldn't start batch jobs in directory: {}", config.batchJobPath());
+    }
     return status;
 }
 
@@ -255,6 +277,12 @@ Status ModelManager::startFromConfig() {
         return status;
     }
 
+    status = modelConfig.parseColorFormatParameter(config.colorFormat());
+    if (!status.ok()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Couldn't parse color_format parameter");
+        return status;
+    }
+
     bool batchSizeSet = (modelConfig.getBatchingMode() != FIXED || modelConfig.getBatchSize() != 0);
     bool shapeSet = (modelConfig.getShapes().size() > 0);
 
@@ -394,6 +422,7 @@ Status processPipelineConfig(rapidjson::Document& configJson, const rapidjson::V
 
         DLNodeInfo dlNodeInfo;
         CustomNodeInfo customNodeInfo;
+        std::optional<NodeCondition> condition;
         if (nodeKind == NodeKind::DL) {
             processDLNodeConfig(nodeConfig, dlNodeInfo);
         } else if (nodeKind == NodeKind::CUSTOM) {
@@ -401,6 +430,13 @@ Status processPipelineConfig(rapidjson::Document& configJson, const rapidjson::V
             if (!status.ok()) {
                 return status;
             }
+        } else if (nodeKind == NodeKind::CONDITION) {
+            condition.emplace();
+            status = condition->parse(nodeConfig["condition"]);
+            if (!status.ok()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Pipeline: {} node: {} has invalid condition: {}", pipelineName, nodeName, status.string());
+                return status;
+            }
         } else {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Pipeline {} contains unknown node kind", pipelineName);
             throw std::invalid_argument("unknown node kind");
@@ -440,7 +476,8 @@ Status processPipelineConfig(rapidjson::Document& configJson, const rapidjson::V
             demultiplyCount,
             gatherFromNode,
             customNodeInfo.library,
-            customNodeInfo.parameters);
+            customNodeInfo.parameters,
+            condition);
         auto nodeInputItr = nodeConfig.FindMember("inputs");
         processNodeInputs(nodeName, nodeInputItr, connections);
     }
@@ -591,6 +628,19 @@ Status ModelManager::loadMetricsConfig(rapidjson::Document& configJson) {
     }
 }
 
+Status ModelManager::loadTenantQuotasConfig(rapidjson::Document& configJson) {
+    const auto itr = configJson.FindMember("tenant_quotas");
+    if (itr == configJson.MemberEnd()) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Configuration file doesn't have tenant quotas property.");
+        this->tenantLimiter.setServableQuotas({});
+        return StatusCode::OK;
+    }
+    if (!this->tenantLimiter.isEnabled()) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Tenant quotas are configured but tenant_header parameter is not set. Quotas will not be applied.");
+    }
+    return this->tenantLimiter.parseServableQuotas(itr->value);
+}
+
 Status ModelManager::loadModelsConfig(rapidjson::Document& configJson, std::vector<ModelConfig>& gatedModelConfigs) {
     Status firstErrorStatus = StatusCode::OK;
 
@@ -764,6 +814,11 @@ Status ModelManager::loadConfig(const std::string& jsonFilename) {
 
     Status firstErrorStatus = StatusCode::OK;
 
+    status = loadTenantQuotasConfig(configJson);
+    if (!status.ok()) {
+        IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
+    }
+
     // load the custom loader config, if available
     status = loadCustomLoadersConfig(configJson);
     if (!status.ok()) {
@@ -965,9 +1020,11 @@ void ModelManager::cleanupResources() {
     // Unlock mutex so new resources can be put into container owned by ModelManager
     resourcesLock.unlock();
     // Temporary container will fall out of scope and therefore deinitialize should be called on every resource inside of it
+    this->tenantLimiter.cleanupIdleTenants();
 }
 
 void ModelManager::join() {
+    this->batchJobManager->stop();
     if (watcherStarted)
         exitTrigger.set_value();
     if (cleanerStarted)
@@ -1159,6 +1216,19 @@ Status ModelManager::readAvailableVersions(std::shared_ptr<FileSystem>& fs, cons
         }
     }
 
+    if (fs->supportsModelVersionArchives()) {
+        std::map<model_version_t, std::string> archives;
+        status = ModelVersionArchive::findVersionArchives(*fs, base, archives);
+        if (status != StatusCode::OK) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Couldn't list files in path: {}", base);
+            return status;
+        }
+        for (const auto& [version, archive] : archives) {
+            SPDLOG_LOGGER_TRACE(modelmanager_logger, "Detected version archive: {}", archive);
+            versions.push_back(version);
+        }
+    }
+
     if (0 == versions.size()) {
         SPDLOG_LOGGER_WARN(modelmanager_logger, "No version found for model in path: {}", base);
     }
@@ -1262,6 +1332,12 @@ Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
             return StatusCode::OK;
         }
     }
+    model->setOverloadFallbackPolicy(config.getOverloadFallbackPolicy());
+    if (config.getOverloadFallbackPolicy().isEnabled() &&
+        std::find(requestedVersions.begin(), requestedVersions.end(), config.getOverloadFallbackPolicy().getFallbackVersion()) == requestedVersions.end()) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Overload fallback version: {} of model: {} is not served according to model version policy",
+            config.getOverloadFallbackPolicy().getFallbackVersion(), config.getName());
+    }
     getVersionsToChange(config, model->getModelVersions(), requestedVersions, versionsToStart, versionsToReload, versionsToRetire);
     bool reloadNeeded = false;
     if (versionsToStart->size() > 0 || versionsToReload->size() > 0 || versionsToRetire->size() > 0) {
@@ -1363,6 +1439,27 @@ Status ModelManager::getModelInstance(const std::string& modelName,
     return modelInstance->waitForLoaded(waitForModelLoadedTimeoutMs, modelInstanceUnloadGuardPtr);
 }
 
+Status ModelManager::getModelInstanceForInference(const std::string& modelName,
+    ovms::model_version_t modelVersionId,
+    std::shared_ptr<ovms::ModelInstance>& modelInstance,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const {
+    if (modelVersionId != 0) {
+        return getModelInstance(modelName, modelVersionId, modelInstance, modelInstanceUnloadGuardPtr);
+    }
+    SPDLOG_DEBUG("Requesting model: {}; default version for inference.", modelName);
+
+    auto model = findModelByName(modelName);
+    if (model == nullptr) {
+        return StatusCode::MODEL_NAME_MISSING;
+    }
+    modelInstance = model->getDefaultModelInstanceForInference();
+    if (modelInstance == nullptr) {
+        return StatusCode::MODEL_VERSION_MISSING;
+    }
+
+    return modelInstance->waitForLoaded(waitForModelLoadedTimeoutMs, modelInstanceUnloadGuardPtr);
+}
+
 const CustomNodeLibraryManager& ModelManager::getCustomNodeLibraryManager() const {
     return *customNodeLibraryManager;
 }
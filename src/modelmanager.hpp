@@ -38,12 +38,14 @@
 #include "model.hpp"
 #include "pipeline.hpp"
 #include "pipeline_factory.hpp"
+#include "tenant_limiter.hpp"
 
 namespace ovms {
 
 const uint32_t DEFAULT_WAIT_FOR_MODEL_LOADED_TIMEOUT_MS = 10000;
 const std::string DEFAULT_MODEL_CACHE_DIRECTORY = "/opt/cache";
 
+class BatchJobManager;
 class Config;
 class IVersionReader;
 class CustomNodeLibraryManager;
@@ -149,6 +151,16 @@ private:
          */
     bool metricConfigLoadedOnce = false;
 
+    /**
+     * @brief Per tenant rate limits & concurrency quotas
+     */
+    TenantLimiter tenantLimiter;
+
+    /**
+     * @brief Offline batch jobs scoring local datasets
+     */
+    std::unique_ptr<BatchJobManager> batchJobManager;
+
     /**
      * @brief An exit trigger to notify watcher thread to exit
      */
@@ -225,6 +237,14 @@ public:
         return watcherIntervalSec;
     }
 
+    /**
+     *  @brief Disables model cache regardless of --cache_dir and existence of default cache directory.
+     *  Applies to models loaded afterwards.
+     */
+    void disableModelCache() {
+        modelCacheDirectory.clear();
+    }
+
     /**
      *  @brief Gets the cleaner resources interval timestep in seconds
      */
@@ -289,6 +309,15 @@ public:
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const;
 
+    /**
+     * @brief Same as getModelInstance, but request for default version may be served by fallback version
+     * when overload fallback policy of the model is active
+     */
+    Status getModelInstanceForInference(const std::string& modelName,
+        ovms::model_version_t modelVersionId,
+        std::shared_ptr<ovms::ModelInstance>& modelInstance,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const;
+
     const bool modelExists(const std::string& name) const {
         if (findModelByName(name) == nullptr)
             return false;
@@ -355,6 +384,20 @@ public:
 
     Status loadMetricsConfig(rapidjson::Document& configJson);
 
+    Status loadTenantQuotasConfig(rapidjson::Document& configJson);
+
+    TenantLimiter& getTenantLimiter() {
+        return this->tenantLimiter;
+    }
+
+    const TenantLimiter& getTenantLimiter() const {
+        return this->tenantLimiter;
+    }
+
+    BatchJobManager& getBatchJobManager() {
+        return *this->batchJobManager;
+    }
+
     /**
          * @brief Set the metric config
          * 
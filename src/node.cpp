@@ -65,6 +65,12 @@ Status Node::fetchResults(session_key_t sessionId, SessionResults& nodeSessionOu
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Could not find session: {} for node: {}", sessionId, getName());
         return StatusCode::UNKNOWN_ERROR;
     }
+    if (nodeSession->isSkipped()) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} was skipped", getName(), sessionId);
+        auto status = fetchSkippedResults(*nodeSession, nodeSessionOutputs);
+        nodeSessions.erase(sessionId);
+        return status;
+    }
     auto status = fetchResults(*nodeSession, nodeSessionOutputs);
     if (status.ok() && demultiplexCount) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will demultiply node: {} outputs with demultiplyCount: {}", getName(), demultiplyCountSettingToString(demultiplexCount));
@@ -75,6 +81,25 @@ Status Node::fetchResults(session_key_t sessionId, SessionResults& nodeSessionOu
     return status;
 }
 
+bool Node::isSessionSkipped(const session_key_t& sessionKey) const {
+    return getNodeSession(sessionKey).isSkipped();
+}
+
+Status Node::skip(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Skipping execution of node: {} session: {}", getName(), sessionKey);
+    getNodeSession(sessionKey).skipExecution();
+    notifyEndQueue.push(NodeSessionKeyPair(*this, sessionKey));
+    return StatusCode::OK;
+}
+
+Status Node::fetchSkippedResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) {
+    NodeSessionMetadata metadata = nodeSession.getNodeSessionMetadata();
+    metadata.setSkipped();
+    const auto& sessionKey = metadata.getSessionKey();
+    nodeSessionOutputs.emplace(sessionKey, SessionResult{std::move(metadata), TensorWithSourceMap{}});
+    return StatusCode::OK;
+}
+
 void Node::printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs) {
     std::stringstream ss;
     ss << "Links from:" << sourceNode << " to:" << nodeName << ":\n";
@@ -104,6 +129,11 @@ Status Node::setInputs(const Node& dependency, TensorWithSourceMap& inputs, Node
     if (!nodeSession) {
         return StatusCode::INTERNAL_ERROR;
     }
+    if (metadata.isSkipped()) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "node: {} received skipped results from node: {}", getName(), dependency.getName());
+        nodeSession->markSkipped();
+        return nodeSession->notifyFinishedDependency();
+    }
     session_id_t shardId;
     try {
         static const std::set<std::string> emptySet;
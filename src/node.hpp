@@ -64,13 +64,21 @@ public:
     virtual Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) = 0;
     Status fetchResults(session_key_t sessionId, SessionResults& nodeSessionOutputs);
 
+    /**
+     * @brief Sessions which received skipped results from any dependency
+     * are not executed, they are forwarded to the queue with ::skip instead
+     */
+    bool isSessionSkipped(const session_key_t& sessionKey) const;
+    virtual Status skip(session_key_t sessionId, PipelineEventQueue& notifyEndQueue);
+
 protected:
     virtual Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) = 0;
+    virtual Status fetchSkippedResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs);
     Status demultiplyOutputs(SessionResults& nodeSessionOutputs);
     virtual Status createShardedTensor(ov::Tensor& dividedTensor, Precision precision, const shape_t& shape, const ov::Tensor& tensor, size_t i, size_t step, const NodeSessionMetadata& metadata, const std::string tensorName);
 
 public:
-    Status setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata);
+    virtual Status setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata);
     Status setInputs(const Node& dependency, SessionResults& inputs);
 
     virtual void addDependency(Node& node, const Aliases& tensorNamesMapping) {
@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "nodecondition.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+static const std::vector<std::pair<std::string, ConditionReduction>> reductionNames{
+    {"count", ConditionReduction::COUNT},
+    {"min", ConditionReduction::MIN},
+    {"max", ConditionReduction::MAX},
+    {"sum", ConditionReduction::SUM}};
+
+static const std::vector<std::pair<std::string, ConditionOperator>> operatorNames{
+    {">", ConditionOperator::GREATER},
+    {">=", ConditionOperator::GREATER_EQUAL},
+    {"<", ConditionOperator::LESS},
+    {"<=", ConditionOperator::LESS_EQUAL},
+    {"==", ConditionOperator::EQUAL},
+    {"!=", ConditionOperator::NOT_EQUAL}};
+
+template <typename T>
+static bool fromName(const std::vector<std::pair<std::string, T>>& names, const std::string& name, T& value) {
+    auto it = std::find_if(names.begin(), names.end(), [&name](const auto& pair) { return pair.first == name; });
+    if (it == names.end()) {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+template <typename T>
+static const std::string& toName(const std::vector<std::pair<std::string, T>>& names, T value) {
+    return std::find_if(names.begin(), names.end(), [value](const auto& pair) { return pair.second == value; })->first;
+}
+
+Status NodeCondition::parse(const rapidjson::Value& v) {
+    if (!v.IsObject() ||
+        !v.HasMember("input") || !v["input"].IsString() ||
+        !v.HasMember("reduce") || !v["reduce"].IsString() ||
+        !v.HasMember("operator") || !v["operator"].IsString() ||
+        !v.HasMember("threshold") || !v["threshold"].IsNumber()) {
+        return StatusCode::PIPELINE_CONDITION_WRONG_FORMAT;
+    }
+    this->inputName = v["input"].GetString();
+    if (!fromName(reductionNames, v["reduce"].GetString(), this->reduction)) {
+        return Status(StatusCode::PIPELINE_CONDITION_WRONG_FORMAT, std::string("unknown reduce: ") + v["reduce"].GetString());
+    }
+    if (!fromName(operatorNames, v["operator"].GetString(), this->op)) {
+        return Status(StatusCode::PIPELINE_CONDITION_WRONG_FORMAT, std::string("unknown operator: ") + v["operator"].GetString());
+    }
+    this->threshold = v["threshold"].GetDouble();
+    return StatusCode::OK;
+}
+
+template <typename T>
+static double reduce(const ov::Tensor& tensor, ConditionReduction reduction) {
+    const T* data = tensor.data<T>();
+    const size_t size = tensor.get_size();
+    double result = static_cast<double>(data[0]);
+    for (size_t i = 1; i < size; ++i) {
+        double value = static_cast<double>(data[i]);
+        switch (reduction) {
+        case ConditionReduction::MIN:
+            result = std::min(result, value);
+            break;
+        case ConditionReduction::MAX:
+            result = std::max(result, value);
+            break;
+        default:
+            result += value;
+        }
+    }
+    return result;
+}
+
+static bool compare(double value, ConditionOperator op, double threshold) {
+    switch (op) {
+    case ConditionOperator::GREATER:
+        return value > threshold;
+    case ConditionOperator::GREATER_EQUAL:
+        return value >= threshold;
+    case ConditionOperator::LESS:
+        return value < threshold;
+    case ConditionOperator::LESS_EQUAL:
+        return value <= threshold;
+    case ConditionOperator::EQUAL:
+        return value == threshold;
+    case ConditionOperator::NOT_EQUAL:
+        return value != threshold;
+    }
+    return false;
+}
+
+Status NodeCondition::evaluate(const ov::Tensor& tensor, bool& result) const {
+    if (reduction == ConditionReduction::COUNT) {
+        const auto& shape = tensor.get_shape();
+        double count = shape.empty() ? 1 : static_cast<double>(shape[0]);
+        result = compare(count, op, threshold);
+        return StatusCode::OK;
+    }
+    if (tensor.get_size() == 0) {
+        result = false;
+        return StatusCode::OK;
+    }
+    double value;
+    switch (tensor.get_element_type()) {
+    case ov::element::Type_t::f32:
+        value = reduce<float>(tensor, reduction);
+        break;
+    case ov::element::Type_t::f64:
+        value = reduce<double>(tensor, reduction);
+        break;
+    case ov::element::Type_t::f16:
+        value = reduce<ov::float16>(tensor, reduction);
+        break;
+    case ov::element::Type_t::i8:
+        value = reduce<int8_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::u8:
+        value = reduce<uint8_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::i16:
+        value = reduce<int16_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::u16:
+        value = reduce<uint16_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::i32:
+        value = reduce<int32_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::u32:
+        value = reduce<uint32_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::i64:
+        value = reduce<int64_t>(tensor, reduction);
+        break;
+    case ov::element::Type_t::u64:
+        value = reduce<uint64_t>(tensor, reduction);
+        break;
+    default:
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Condition cannot be evaluated on tensor with precision: {}", tensor.get_element_type().get_type_name());
+        return StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION;
+    }
+    result = compare(value, op, threshold);
+    return StatusCode::OK;
+}
+
+std::string NodeCondition::toString() const {
+    std::stringstream ss;
+    ss << toName(reductionNames, reduction) << "(" << inputName << ") " << toName(operatorNames, op) << " " << threshold;
+    return ss.str();
+}
+
+}  // namespace ovms
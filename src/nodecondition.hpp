@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+
+#include <openvino/openvino.hpp>
+#include <rapidjson/document.h>
+
+#include "status.hpp"
+
+namespace ovms {
+
+enum class ConditionReduction {
+    COUNT,
+    MIN,
+    MAX,
+    SUM
+};
+
+enum class ConditionOperator {
+    GREATER,
+    GREATER_EQUAL,
+    LESS,
+    LESS_EQUAL,
+    EQUAL,
+    NOT_EQUAL
+};
+
+/**
+ * @brief Predicate evaluated by condition node on one of its input tensors,
+ * e.g. count of detections > 0 or max score >= threshold.
+ */
+struct NodeCondition {
+    std::string inputName;
+    ConditionReduction reduction = ConditionReduction::COUNT;
+    ConditionOperator op = ConditionOperator::GREATER;
+    double threshold = 0;
+
+    Status parse(const rapidjson::Value& v);
+
+    /**
+     * @brief Count reduction takes size of the first dimension. Other reductions
+     * are computed over all tensor elements and are false for empty tensors.
+     */
+    Status evaluate(const ov::Tensor& tensor, bool& result) const;
+
+    std::string toString() const;
+};
+
+}  // namespace ovms
@@ -26,6 +26,7 @@
 #include "aliases.hpp"
 #include "modelversion.hpp"
 #include "node_library.hpp"
+#include "nodecondition.hpp"
 #include "status.hpp"
 #include "tensorinfo.hpp"
 
@@ -41,11 +42,13 @@ enum class NodeKind {
     ENTRY,
     DL,
     CUSTOM,
+    CONDITION,
     EXIT
 };
 
 const std::string DL_NODE_CONFIG_TYPE = "DL model";
 const std::string CUSTOM_NODE_CONFIG_TYPE = "custom";
+const std::string CONDITION_NODE_CONFIG_TYPE = "condition";
 
 Status toNodeKind(const std::string& str, NodeKind& nodeKind);
 
@@ -69,6 +72,7 @@ struct NodeInfo {
     std::set<std::string> gatherFromNode;
     NodeLibrary library;
     parameters_t parameters;
+    std::optional<NodeCondition> condition;
 
     NodeInfo(NodeKind kind,
         const std::string& nodeName,
@@ -78,7 +82,8 @@ struct NodeInfo {
         std::optional<size_t> demultiplyCount = std::nullopt,
         const std::set<std::string>& gatherFromNode = {},
         const NodeLibrary& library = {},
-        const parameters_t& parameters = {}) :
+        const parameters_t& parameters = {},
+        const std::optional<NodeCondition>& condition = std::nullopt) :
         kind(kind),
         nodeName(nodeName),
         modelName(modelName),
@@ -87,6 +92,7 @@ struct NodeInfo {
         demultiplyCount(demultiplyCount),
         gatherFromNode(gatherFromNode),
         library(library),
-        parameters(parameters) {}
+        parameters(parameters),
+        condition(condition) {}
 };
 }  // namespace ovms
@@ -35,13 +35,26 @@ Status NodeInputHandler::setInput(const std::string& inputName, TensorWithSource
     }
     inputTensors.emplace(inputName, tensor.getActualTensor());
     if (tensor.hasSource()) {
-        sourceTensorRefs.push_back(tensor.getSourceTensor());
+        inputSourceTensors.emplace(inputName, tensor.getSourceTensor());
     }
     return StatusCode::OK;
 }
 
+std::optional<TensorWithSource> NodeInputHandler::getInputWithSource(const std::string& inputName) const {
+    auto it = inputTensors.find(inputName);
+    if (it == inputTensors.end()) {
+        return std::nullopt;
+    }
+    auto sourceIt = inputSourceTensors.find(inputName);
+    if (sourceIt == inputSourceTensors.end()) {
+        return TensorWithSource(it->second);
+    }
+    return TensorWithSource(it->second, sourceIt->second);
+}
+
 void NodeInputHandler::clearInputs() {
     inputTensors.clear();
+    inputSourceTensors.clear();
     sourceTensorRefs.clear();
 }
 
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -35,6 +36,7 @@ namespace ovms {
 class NodeInputHandler {
 protected:
     TensorMap inputTensors;
+    TensorMap inputSourceTensors;
     TensorVector sourceTensorRefs;
     uint32_t remainingDependencies;
     bool isUsed = false;
@@ -46,7 +48,13 @@ public:
         isUsed = true;
         return inputTensors;
     }
+    /**
+     * @brief Returns input together with source tensor owning its data, so that it can be passed on
+     * after inputs are cleared
+     */
+    std::optional<TensorWithSource> getInputWithSource(const std::string& inputName) const;
     void clearInputs();
+    void markUsed() { isUsed = true; }
     bool isReady();
     virtual Status notifyFinishedDependency();
     virtual ~NodeInputHandler() = default;
@@ -63,6 +63,11 @@ Timer<TIMER_END>& NodeSession::getTimer() const {
     return *this->timer;
 }
 
+void NodeSession::skipExecution() {
+    this->inputHandler->markUsed();
+    this->inputHandler->clearInputs();
+}
+
 ReleaseSessionGuard::ReleaseSessionGuard(NodeSession& nodeSession) :
     nodeSession(nodeSession) {}
 
@@ -39,6 +39,7 @@ class NodeSession {
     NodeSessionMetadata metadata;
     session_key_t sessionKey;
     const std::string& nodeName;
+    bool skipped = false;
 
 protected:
     std::unique_ptr<Timer<TIMER_END>> timer;
@@ -57,6 +58,9 @@ public:
     virtual bool tryDisarm(uint microseconds) { return true; }
     Status notifyFinishedDependency();
     Timer<TIMER_END>& getTimer() const;
+    bool isSkipped() const { return skipped; }
+    void markSkipped() { skipped = true; }
+    void skipExecution();
 };
 
 class ReleaseSessionGuard {
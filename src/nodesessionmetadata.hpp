@@ -41,6 +41,7 @@ class NodeSessionMetadata {
     ExecutionContext context;
     mutable std::string cachedSessionKey = "";
     mutable bool cached = false;
+    bool skipped = false;
 
 protected:
     NodeSessionMetadata();
@@ -54,6 +55,9 @@ public:
     session_id_t getSubsessionSize(const std::string& subsessionName) const;
     session_id_t getShardId(const std::set<std::string>& collapsedNames = {}) const;
     ExecutionContext getContext() const;
+    // Set on results of node sessions skipped by condition node, marks dependants to be skipped as well
+    bool isSkipped() const { return skipped; }
+    void setSkipped() { skipped = true; }
 
 private:
     std::string createSessionKey(const std::set<std::string>& ignoredNodeNames = {}) const;
@@ -18,6 +18,7 @@
 #include <future>
 #include <optional>
 
+#include "executingstreamidguard.hpp"
 #include "logging.hpp"
 #include "model_metric_reporter.hpp"
 #include "ovinferrequestsqueue.hpp"
@@ -27,7 +28,7 @@ namespace ovms {
 
 NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
     inferRequestsQueue_(inferRequestsQueue),
-    futureStreamId(inferRequestsQueue_.getIdleStream()),
+    futureStreamId(inferRequestsQueue_.getIdleStream(LowPriorityInferenceScope::isActive())),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
 }
@@ -37,10 +38,10 @@ NodeStreamIdGuard::~NodeStreamIdGuard() {
         if (!this->streamId) {
             SPDLOG_DEBUG("Trying to disarm stream Id that is not needed anymore...");
             this->streamId = this->futureStreamId.get();
-            INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+            markAcquired();
         }
         SPDLOG_DEBUG("Returning streamId: {}", this->streamId.value());
-        DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
+        markReleased();
         this->inferRequestsQueue_.returnStream(this->streamId.value());
     }
     DECREMENT_IF_ENABLED(this->reporter.currentRequests);
@@ -51,7 +52,7 @@ std::optional<int> NodeStreamIdGuard::tryGetId(const uint microseconds) {
     if (!this->streamId) {
         if (std::future_status::ready == this->futureStreamId.wait_for(std::chrono::microseconds(microseconds))) {
             this->streamId = this->futureStreamId.get();
-            INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+            markAcquired();
         }
     }
     return this->streamId;
@@ -67,4 +68,18 @@ bool NodeStreamIdGuard::tryDisarm(const uint microseconds) {
     return this->disarmed;
 }
 
+void NodeStreamIdGuard::markAcquired() {
+    INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    if (this->reporter.inferReqBusyTime) {
+        this->acquiredAt = std::chrono::steady_clock::now();
+    }
+}
+
+void NodeStreamIdGuard::markReleased() {
+    DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    if (this->reporter.inferReqBusyTime) {
+        this->reporter.inferReqBusyTime->increment(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - this->acquiredAt).count());
+    }
+}
+
 }  // namespace ovms
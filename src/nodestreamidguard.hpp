@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <optional>
 
@@ -36,5 +37,9 @@ private:
     std::optional<int> streamId = std::nullopt;
     bool disarmed = false;
     ModelMetricReporter& reporter;
+    std::chrono::steady_clock::time_point acquiredAt;
+
+    void markAcquired();
+    void markReleased();
 };
 }  // namespace ovms
@@ -0,0 +1,518 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "numpy_utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+#include <spdlog/spdlog.h>
+
+namespace ovms {
+
+const std::string NPY_CONTENT_TYPE = "application/x-npy";
+const std::string NPZ_CONTENT_TYPE = "application/x-npz";
+
+namespace {
+const char NPY_MAGIC[] = "\x93NUMPY";
+const size_t NPY_MAGIC_SIZE = 6;
+const size_t NPY_HEADER_ALIGNMENT = 64;
+
+const uint32_t ZIP_LOCAL_HEADER_SIGNATURE = 0x04034b50;
+const uint32_t ZIP_CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+const uint32_t ZIP_END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06064b50;
+const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE = 0x07064b50;
+const uint16_t ZIP64_EXTRA_FIELD_ID = 0x0001;
+const size_t ZIP_LOCAL_HEADER_SIZE = 30;
+const size_t ZIP_CENTRAL_HEADER_SIZE = 46;
+const size_t ZIP_END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+const size_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE = 20;
+const size_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE = 56;
+const uint16_t ZIP_METHOD_STORED = 0;
+const uint16_t ZIP_VERSION = 20;
+
+// Type part of numpy descr, byte order is handled separately
+const std::unordered_map<std::string, Precision> NUMPY_TYPES{
+    {"f2", Precision::FP16},
+    {"f4", Precision::FP32},
+    {"f8", Precision::FP64},
+    {"i1", Precision::I8},
+    {"i2", Precision::I16},
+    {"i4", Precision::I32},
+    {"i8", Precision::I64},
+    {"u1", Precision::U8},
+    {"u2", Precision::U16},
+    {"u4", Precision::U32},
+    {"u8", Precision::U64},
+    {"b1", Precision::BOOL}};
+
+Status invalidNpy(const std::string& details) {
+    return Status(StatusCode::NUMPY_INVALID_FORMAT, details);
+}
+
+template <typename T>
+T readLittleEndian(const char* data) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        value |= static_cast<T>(static_cast<uint8_t>(data[i])) << (8 * i);
+    }
+    return value;
+}
+
+template <typename T>
+bool readLittleEndian(std::string_view content, size_t offset, T& value) {
+    if (offset > content.size() || content.size() - offset < sizeof(T)) {
+        return false;
+    }
+    value = readLittleEndian<T>(content.data() + offset);
+    return true;
+}
+
+// Extracts value of a key from python dict literal used in npy header, e.g. {'descr': '<f4', 'shape': (1, 3), }
+bool findHeaderValue(std::string_view header, const std::string& key, std::string_view& value) {
+    for (const char quote : {'\'', '"'}) {
+        const std::string quotedKey = std::string(1, quote) + key + std::string(1, quote);
+        auto pos = header.find(quotedKey);
+        if (pos == std::string_view::npos) {
+            continue;
+        }
+        pos = header.find(':', pos + quotedKey.size());
+        if (pos == std::string_view::npos) {
+            return false;
+        }
+        pos = header.find_first_not_of(' ', pos + 1);
+        if (pos == std::string_view::npos) {
+            return false;
+        }
+        size_t end;
+        if (header[pos] == '(') {
+            end = header.find(')', pos);
+            if (end == std::string_view::npos) {
+                return false;
+            }
+            end++;
+        } else if (header[pos] == '\'' || header[pos] == '"') {
+            end = header.find(header[pos], pos + 1);
+            if (end == std::string_view::npos) {
+                return false;
+            }
+            end++;
+        } else {
+            end = header.find_first_of(",}", pos);
+            if (end == std::string_view::npos) {
+                return false;
+            }
+        }
+        value = header.substr(pos, end - pos);
+        return true;
+    }
+    return false;
+}
+
+Status parseDescr(std::string_view descr, Precision& precision) {
+    if (descr.size() < 2 || descr.front() != descr.back() || (descr.front() != '\'' && descr.front() != '"')) {
+        return invalidNpy("descr is not a string");
+    }
+    descr = descr.substr(1, descr.size() - 2);
+    if (descr.size() != 3) {
+        return invalidNpy("unsupported dtype: " + std::string(descr));
+    }
+    auto it = NUMPY_TYPES.find(std::string(descr.substr(1)));
+    if (it == NUMPY_TYPES.end()) {
+        return invalidNpy("unsupported dtype: " + std::string(descr));
+    }
+    const char byteOrder = descr[0];
+    const bool singleByte = getNumpyItemSize(it->second) == 1;
+    if (byteOrder != '<' && byteOrder != '=' && !(singleByte && byteOrder == '|')) {
+        return invalidNpy("only little endian arrays are supported");
+    }
+    precision = it->second;
+    return StatusCode::OK;
+}
+
+Status parseShape(std::string_view tuple, shape_t& shape) {
+    if (tuple.size() < 2 || tuple.front() != '(' || tuple.back() != ')') {
+        return invalidNpy("shape is not a tuple");
+    }
+    shape.clear();
+    std::stringstream ss{std::string(tuple.substr(1, tuple.size() - 2))};
+    std::string dim;
+    while (std::getline(ss, dim, ',')) {
+        auto begin = dim.find_first_not_of(' ');
+        if (begin == std::string::npos) {
+            continue;  // trailing comma of single element tuple
+        }
+        auto end = dim.find_last_not_of(' ');
+        dim = dim.substr(begin, end - begin + 1);
+        if (dim.empty() || dim.find_first_not_of("0123456789") != std::string::npos || dim.size() > 18) {
+            return invalidNpy("invalid shape dimension: " + dim);
+        }
+        shape.push_back(std::stoull(dim));
+    }
+    return StatusCode::OK;
+}
+
+// Reads value overridden in zip64 extra field when 32 bit field is saturated
+bool readZip64Extra(std::string_view extra, std::vector<uint64_t*> saturatedFields) {
+    size_t offset = 0;
+    while (offset + 4 <= extra.size()) {
+        uint16_t id = readLittleEndian<uint16_t>(extra.data() + offset);
+        uint16_t size = readLittleEndian<uint16_t>(extra.data() + offset + 2);
+        offset += 4;
+        if (offset + size > extra.size()) {
+            return false;
+        }
+        if (id == ZIP64_EXTRA_FIELD_ID) {
+            size_t fieldOffset = 0;
+            for (auto* field : saturatedFields) {
+                if (fieldOffset + sizeof(uint64_t) > size) {
+                    return false;
+                }
+                *field = readLittleEndian<uint64_t>(extra.data() + offset + fieldOffset);
+                fieldOffset += sizeof(uint64_t);
+            }
+            return true;
+        }
+        offset += size;
+    }
+    return saturatedFields.empty();
+}
+}  // namespace
+
+size_t getNumpyItemSize(Precision precision) {
+    switch (precision) {
+    case Precision::FP64:
+    case Precision::I64:
+    case Precision::U64:
+        return 8;
+    case Precision::FP32:
+    case Precision::I32:
+    case Precision::U32:
+        return 4;
+    case Precision::FP16:
+    case Precision::I16:
+    case Precision::U16:
+        return 2;
+    case Precision::I8:
+    case Precision::U8:
+    case Precision::BOOL:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+Status parseNpy(std::string_view content, NumpyArray& array) {
+    if (content.size() < NPY_MAGIC_SIZE + 4 || content.compare(0, NPY_MAGIC_SIZE, NPY_MAGIC) != 0) {
+        return invalidNpy("missing npy magic string");
+    }
+    const uint8_t majorVersion = static_cast<uint8_t>(content[NPY_MAGIC_SIZE]);
+    size_t headerOffset = NPY_MAGIC_SIZE + 2;
+    size_t headerSize = 0;
+    if (majorVersion == 1) {
+        uint16_t size;
+        readLittleEndian(content, headerOffset, size);
+        headerSize = size;
+        headerOffset += sizeof(uint16_t);
+    } else if (majorVersion == 2 || majorVersion == 3) {
+        uint32_t size;
+        if (!readLittleEndian(content, headerOffset, size)) {
+            return invalidNpy("truncated header");
+        }
+        headerSize = size;
+        headerOffset += sizeof(uint32_t);
+    } else {
+        return invalidNpy("unsupported npy version: " + std::to_string(majorVersion));
+    }
+    if (content.size() - headerOffset < headerSize) {
+        return invalidNpy("truncated header");
+    }
+    std::string_view header = content.substr(headerOffset, headerSize);
+
+    std::string_view descr, fortranOrder, shape;
+    if (!findHeaderValue(header, "descr", descr) ||
+        !findHeaderValue(header, "fortran_order", fortranOrder) ||
+        !findHeaderValue(header, "shape", shape)) {
+        return invalidNpy("header has to contain descr, fortran_order and shape");
+    }
+    if (fortranOrder != "False") {
+        return invalidNpy("fortran ordered arrays are not supported");
+    }
+    auto status = parseDescr(descr, array.precision);
+    if (!status.ok()) {
+        return status;
+    }
+    status = parseShape(shape, array.shape);
+    if (!status.ok()) {
+        return status;
+    }
+    size_t expectedSize = getNumpyItemSize(array.precision);
+    for (const auto dim : array.shape) {
+        if (dim != 0 && expectedSize > std::numeric_limits<size_t>::max() / dim) {
+            return invalidNpy("array size overflow");
+        }
+        expectedSize *= dim;
+    }
+    array.data = content.substr(headerOffset + headerSize);
+    if (array.data.size() != expectedSize) {
+        return invalidNpy("data size " + std::to_string(array.data.size()) + " does not match shape, expected " + std::to_string(expectedSize));
+    }
+    return StatusCode::OK;
+}
+
+Status parseNpz(std::string_view content, numpy_arrays_t& arrays) {
+    arrays.clear();
+    if (content.size() < ZIP_END_OF_CENTRAL_DIRECTORY_SIZE) {
+        return invalidNpy("npz archive is too short");
+    }
+    // End of central directory is followed only by archive comment of up to 64KB
+    size_t eocdOffset = std::string_view::npos;
+    const size_t searchStart = content.size() - ZIP_END_OF_CENTRAL_DIRECTORY_SIZE;
+    const size_t searchEnd = searchStart > std::numeric_limits<uint16_t>::max() ? searchStart - std::numeric_limits<uint16_t>::max() : 0;
+    for (size_t offset = searchStart + 1; offset-- > searchEnd;) {
+        if (readLittleEndian<uint32_t>(content.data() + offset) == ZIP_END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+            eocdOffset = offset;
+            break;
+        }
+    }
+    if (eocdOffset == std::string_view::npos) {
+        return invalidNpy("npz end of central directory not found");
+    }
+    uint64_t entries = readLittleEndian<uint16_t>(content.data() + eocdOffset + 10);
+    uint64_t directoryOffset = readLittleEndian<uint32_t>(content.data() + eocdOffset + 16);
+    if ((entries == 0xFFFF || directoryOffset == 0xFFFFFFFF) && eocdOffset >= ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE) {
+        const size_t locatorOffset = eocdOffset - ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE;
+        uint64_t zip64EocdOffset;
+        uint32_t signature;
+        if (readLittleEndian<uint32_t>(content.data() + locatorOffset) == ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE &&
+            readLittleEndian(content, locatorOffset + 8, zip64EocdOffset) &&
+            zip64EocdOffset + ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE <= content.size() &&
+            readLittleEndian(content, zip64EocdOffset, signature) && signature == ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+            entries = readLittleEndian<uint64_t>(content.data() + zip64EocdOffset + 32);
+            directoryOffset = readLittleEndian<uint64_t>(content.data() + zip64EocdOffset + 48);
+        }
+    }
+
+    size_t offset = directoryOffset;
+    for (uint64_t i = 0; i < entries; i++) {
+        uint32_t signature;
+        if (!readLittleEndian(content, offset, signature) || signature != ZIP_CENTRAL_HEADER_SIGNATURE ||
+            content.size() - offset < ZIP_CENTRAL_HEADER_SIZE) {
+            return invalidNpy("invalid npz central directory");
+        }
+        const char* header = content.data() + offset;
+        const uint16_t method = readLittleEndian<uint16_t>(header + 10);
+        uint64_t compressedSize = readLittleEndian<uint32_t>(header + 20);
+        uint64_t uncompressedSize = readLittleEndian<uint32_t>(header + 24);
+        const uint16_t nameLength = readLittleEndian<uint16_t>(header + 28);
+        const uint16_t extraLength = readLittleEndian<uint16_t>(header + 30);
+        const uint16_t commentLength = readLittleEndian<uint16_t>(header + 32);
+        uint64_t localHeaderOffset = readLittleEndian<uint32_t>(header + 42);
+        if (content.size() - offset - ZIP_CENTRAL_HEADER_SIZE < static_cast<size_t>(nameLength) + extraLength + commentLength) {
+            return invalidNpy("invalid npz central directory");
+        }
+        std::string name(header + ZIP_CENTRAL_HEADER_SIZE, nameLength);
+        std::vector<uint64_t*> saturatedFields;
+        if (uncompressedSize == 0xFFFFFFFF)
+            saturatedFields.push_back(&uncompressedSize);
+        if (compressedSize == 0xFFFFFFFF)
+            saturatedFields.push_back(&compressedSize);
+        if (localHeaderOffset == 0xFFFFFFFF)
+            saturatedFields.push_back(&localHeaderOffset);
+        if (!readZip64Extra(std::string_view(header + ZIP_CENTRAL_HEADER_SIZE + nameLength, extraLength), saturatedFields)) {
+            return invalidNpy("invalid zip64 extra field of entry: " + name);
+        }
+        offset += ZIP_CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+
+        if (method != ZIP_METHOD_STORED || compressedSize != uncompressedSize) {
+            return invalidNpy("compressed npz entries are not supported, use numpy.savez instead of numpy.savez_compressed");
+        }
+        uint16_t localNameLength, localExtraLength;
+        if (!readLittleEndian(content, localHeaderOffset, signature) || signature != ZIP_LOCAL_HEADER_SIGNATURE ||
+            !readLittleEndian(content, localHeaderOffset + 26, localNameLength) ||
+            !readLittleEndian(content, localHeaderOffset + 28, localExtraLength)) {
+            return invalidNpy("invalid npz local header of entry: " + name);
+        }
+        const uint64_t dataOffset = localHeaderOffset + ZIP_LOCAL_HEADER_SIZE + localNameLength + localExtraLength;
+        if (dataOffset > content.size() || content.size() - dataOffset < uncompressedSize) {
+            return invalidNpy("truncated npz entry: " + name);
+        }
+        const std::string extension = ".npy";
+        if (name.size() > extension.size() && name.compare(name.size() - extension.size(), extension.size(), extension) == 0) {
+            name.resize(name.size() - extension.size());
+        }
+        NumpyArray array;
+        auto status = parseNpy(content.substr(dataOffset, uncompressedSize), array);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Failed to parse npz entry: {}", name);
+            return status;
+        }
+        arrays.emplace_back(std::move(name), array);
+    }
+    return StatusCode::OK;
+}
+
+NumpyFormat getNumpyFormat(const std::string& mediaType) {
+    std::string type = mediaType.substr(0, mediaType.find(';'));
+    type.erase(std::remove_if(type.begin(), type.end(), ::isspace), type.end());
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+    if (type == NPY_CONTENT_TYPE) {
+        return NumpyFormat::NPY;
+    }
+    if (type == NPZ_CONTENT_TYPE) {
+        return NumpyFormat::NPZ;
+    }
+    return NumpyFormat::NONE;
+}
+
+Status makeNpy(Precision precision, const shape_t& shape, std::string_view data, std::string& content) {
+    std::string type;
+    for (const auto& [name, numpyPrecision] : NUMPY_TYPES) {
+        if (numpyPrecision == precision) {
+            type = name;
+        }
+    }
+    if (type.empty()) {
+        return invalidNpy("precision " + toString(precision) + " can not be stored in npy");
+    }
+    size_t elements = 1;
+    for (const auto dim : shape) {
+        elements *= dim;
+    }
+    if (elements * getNumpyItemSize(precision) != data.size()) {
+        return invalidNpy("data size does not match shape");
+    }
+    // Same format as written by numpy, single dimension tuple requires trailing comma
+    std::stringstream header;
+    header << "{'descr': '" << (getNumpyItemSize(precision) == 1 ? '|' : '<') << type << "', 'fortran_order': False, 'shape': (";
+    for (size_t i = 0; i < shape.size(); i++) {
+        header << (i > 0 ? ", " : "") << shape[i];
+    }
+    header << (shape.size() == 1 ? ",), }" : "), }");
+    std::string headerStr = header.str();
+    // Header is padded with spaces and terminated with newline, so data starts at aligned offset
+    const size_t prefixSize = NPY_MAGIC_SIZE + 2 + sizeof(uint16_t);
+    const size_t totalSize = ((prefixSize + headerStr.size() + 1 + NPY_HEADER_ALIGNMENT - 1) / NPY_HEADER_ALIGNMENT) * NPY_HEADER_ALIGNMENT;
+    headerStr.append(totalSize - prefixSize - headerStr.size() - 1, ' ');
+    headerStr.push_back('\n');
+
+    content.clear();
+    content.reserve(totalSize + data.size());
+    content.append(NPY_MAGIC, NPY_MAGIC_SIZE);
+    content.push_back(1);
+    content.push_back(0);
+    content.push_back(static_cast<char>(headerStr.size() & 0xFF));
+    content.push_back(static_cast<char>((headerStr.size() >> 8) & 0xFF));
+    content.append(headerStr);
+    content.append(data.data(), data.size());
+    return StatusCode::OK;
+}
+
+namespace {
+uint32_t crc32(std::string_view data) {
+    static const std::array<uint32_t, 256> table = []() {
+        std::array<uint32_t, 256> result;
+        for (uint32_t i = 0; i < result.size(); i++) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? (0xEDB88320 ^ (value >> 1)) : (value >> 1);
+            }
+            result[i] = value;
+        }
+        return result;
+    }();
+    uint32_t crc = 0xFFFFFFFF;
+    for (const char c : data) {
+        crc = table[(crc ^ static_cast<uint8_t>(c)) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+template <typename T>
+void appendLittleEndian(std::string& content, T value) {
+    for (size_t i = 0; i < sizeof(T); i++) {
+        content.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+}  // namespace
+
+Status makeNpz(const std::vector<std::pair<std::string, std::string>>& npyContents, std::string& content) {
+    size_t totalSize = ZIP_END_OF_CENTRAL_DIRECTORY_SIZE;
+    for (const auto& [name, npy] : npyContents) {
+        totalSize += ZIP_LOCAL_HEADER_SIZE + ZIP_CENTRAL_HEADER_SIZE + 2 * (name.size() + 4) + npy.size();
+    }
+    // Zip64 is not needed for responses, so archive is limited to 4GB
+    if (totalSize > std::numeric_limits<uint32_t>::max() || npyContents.size() > std::numeric_limits<uint16_t>::max()) {
+        return invalidNpy("npz archive exceeds 4GB");
+    }
+    content.clear();
+    content.reserve(totalSize);
+    std::string directory;
+    for (const auto& [name, npy] : npyContents) {
+        const std::string fileName = name + ".npy";
+        const uint32_t crc = crc32(npy);
+        const uint32_t localHeaderOffset = static_cast<uint32_t>(content.size());
+        appendLittleEndian<uint32_t>(content, ZIP_LOCAL_HEADER_SIGNATURE);
+        appendLittleEndian<uint16_t>(content, ZIP_VERSION);
+        appendLittleEndian<uint16_t>(content, 0);  // flags
+        appendLittleEndian<uint16_t>(content, ZIP_METHOD_STORED);
+        appendLittleEndian<uint32_t>(content, 0);  // modification time & date
+        appendLittleEndian<uint32_t>(content, crc);
+        appendLittleEndian<uint32_t>(content, static_cast<uint32_t>(npy.size()));
+        appendLittleEndian<uint32_t>(content, static_cast<uint32_t>(npy.size()));
+        appendLittleEndian<uint16_t>(content, static_cast<uint16_t>(fileName.size()));
+        appendLittleEndian<uint16_t>(content, 0);  // extra field length
+        content += fileName;
+        content += npy;
+
+        appendLittleEndian<uint32_t>(directory, ZIP_CENTRAL_HEADER_SIGNATURE);
+        appendLittleEndian<uint16_t>(directory, ZIP_VERSION);  // version made by
+        appendLittleEndian<uint16_t>(directory, ZIP_VERSION);  // version needed to extract
+        appendLittleEndian<uint16_t>(directory, 0);
+        appendLittleEndian<uint16_t>(directory, ZIP_METHOD_STORED);
+        appendLittleEndian<uint32_t>(directory, 0);
+        appendLittleEndian<uint32_t>(directory, crc);
+        appendLittleEndian<uint32_t>(directory, static_cast<uint32_t>(npy.size()));
+        appendLittleEndian<uint32_t>(directory, static_cast<uint32_t>(npy.size()));
+        appendLittleEndian<uint16_t>(directory, static_cast<uint16_t>(fileName.size()));
+        appendLittleEndian<uint16_t>(directory, 0);  // extra field length
+        appendLittleEndian<uint16_t>(directory, 0);  // comment length
+        appendLittleEndian<uint16_t>(directory, 0);  // disk number
+        appendLittleEndian<uint16_t>(directory, 0);  // internal attributes
+        appendLittleEndian<uint32_t>(directory, 0);  // external attributes
+        appendLittleEndian<uint32_t>(directory, localHeaderOffset);
+        directory += fileName;
+    }
+    const uint32_t directoryOffset = static_cast<uint32_t>(content.size());
+    content += directory;
+    appendLittleEndian<uint32_t>(content, ZIP_END_OF_CENTRAL_DIRECTORY_SIGNATURE);
+    appendLittleEndian<uint16_t>(content, 0);  // disk number
+    appendLittleEndian<uint16_t>(content, 0);  // disk with central directory
+    appendLittleEndian<uint16_t>(content, static_cast<uint16_t>(npyContents.size()));
+    appendLittleEndian<uint16_t>(content, static_cast<uint16_t>(npyContents.size()));
+    appendLittleEndian<uint32_t>(content, static_cast<uint32_t>(directory.size()));
+    appendLittleEndian<uint32_t>(content, directoryOffset);
+    appendLittleEndian<uint16_t>(content, 0);  // comment length
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "precision.hpp"
+#include "shape.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Array stored in NumPy .npy format. Data points into parsed buffer, so it is valid as long as the buffer is.
+ */
+struct NumpyArray {
+    Precision precision = Precision::UNDEFINED;
+    shape_t shape;
+    std::string_view data;
+};
+
+using numpy_arrays_t = std::vector<std::pair<std::string, NumpyArray>>;
+
+extern const std::string NPY_CONTENT_TYPE;
+extern const std::string NPZ_CONTENT_TYPE;
+
+enum class NumpyFormat {
+    NONE,
+    NPY,
+    NPZ
+};
+
+/**
+ * @brief Maps HTTP Content-Type or Accept header value to NumPy format. Media type parameters are ignored.
+ */
+NumpyFormat getNumpyFormat(const std::string& mediaType);
+
+/**
+ * @brief Parses .npy content. Only C ordered, little endian arrays of numeric and bool types are accepted.
+ */
+Status parseNpy(std::string_view content, NumpyArray& array);
+
+/**
+ * @brief Parses .npz archive created with numpy.savez. Array names are entry names without .npy extension.
+ * Entries compressed with numpy.savez_compressed are not supported.
+ */
+Status parseNpz(std::string_view content, numpy_arrays_t& arrays);
+
+/**
+ * @brief Creates .npy content from data in row-major order
+ */
+Status makeNpy(Precision precision, const shape_t& shape, std::string_view data, std::string& content);
+
+/**
+ * @brief Creates .npz archive readable with numpy.load from named .npy contents. Entries are stored without compression.
+ */
+Status makeNpz(const std::vector<std::pair<std::string, std::string>>& npyContents, std::string& content);
+
+size_t getNumpyItemSize(Precision precision);
+
+}  // namespace ovms
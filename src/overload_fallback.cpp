@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "overload_fallback.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <utility>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+const double OverloadFallbackPolicy::DEFAULT_FRACTION = 0.5;
+const double InferRequestWaitEstimator::SMOOTHING_FACTOR = 0.1;
+
+bool OverloadFallbackPolicy::operator==(const OverloadFallbackPolicy& rhs) const {
+    return fallbackVersion == rhs.fallbackVersion &&
+           queueWaitThresholdMs == rhs.queueWaitThresholdMs &&
+           recoveryThresholdMs == rhs.recoveryThresholdMs &&
+           fraction == rhs.fraction;
+}
+
+bool OverloadFallbackPolicy::operator!=(const OverloadFallbackPolicy& rhs) const {
+    return !(*this == rhs);
+}
+
+Status OverloadFallbackPolicy::fromJson(const rapidjson::Value& node, OverloadFallbackPolicy& policyOut) {
+    if (!node.IsObject()) {
+        return StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT;
+    }
+    auto it = node.FindMember("version");
+    if (it == node.MemberEnd() || !it->value.IsUint64() || it->value.GetUint64() == 0) {
+        SPDLOG_ERROR("Overload fallback requires positive version");
+        return StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT;
+    }
+    const model_version_t fallbackVersion = it->value.GetUint64();
+
+    it = node.FindMember("queue_wait_threshold_ms");
+    if (it == node.MemberEnd() || !it->value.IsNumber() || it->value.GetDouble() <= 0) {
+        SPDLOG_ERROR("Overload fallback requires positive queue_wait_threshold_ms");
+        return StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT;
+    }
+    const double queueWaitThresholdMs = it->value.GetDouble();
+
+    double recoveryThresholdMs = queueWaitThresholdMs / 2;
+    it = node.FindMember("recovery_threshold_ms");
+    if (it != node.MemberEnd()) {
+        if (!it->value.IsNumber() || it->value.GetDouble() < 0 || it->value.GetDouble() >= queueWaitThresholdMs) {
+            SPDLOG_ERROR("Overload fallback recovery_threshold_ms must be lower than queue_wait_threshold_ms");
+            return StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT;
+        }
+        recoveryThresholdMs = it->value.GetDouble();
+    }
+
+    double fraction = DEFAULT_FRACTION;
+    it = node.FindMember("fraction");
+    if (it != node.MemberEnd()) {
+        // Default version has to keep receiving requests, otherwise its wait time would never be measured again
+        if (!it->value.IsNumber() || it->value.GetDouble() <= 0 || it->value.GetDouble() >= 1) {
+            SPDLOG_ERROR("Overload fallback fraction must be greater than 0 and lower than 1");
+            return StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT;
+        }
+        fraction = it->value.GetDouble();
+    }
+    policyOut = OverloadFallbackPolicy(fallbackVersion, queueWaitThresholdMs, recoveryThresholdMs, fraction);
+    return StatusCode::OK;
+}
+
+std::string OverloadFallbackPolicy::toString() const {
+    if (!isEnabled()) {
+        return "disabled";
+    }
+    std::stringstream ss;
+    ss << "version: " << fallbackVersion
+       << ", queue_wait_threshold_ms: " << queueWaitThresholdMs
+       << ", recovery_threshold_ms: " << recoveryThresholdMs
+       << ", fraction: " << fraction;
+    return ss.str();
+}
+
+void InferRequestWaitEstimator::observe(double waitMs) {
+    double current = averageMs.load(std::memory_order_relaxed);
+    while (!averageMs.compare_exchange_weak(current, current + SMOOTHING_FACTOR * (waitMs - current), std::memory_order_relaxed)) {
+    }
+}
+
+void OverloadFallbackRouter::setPolicy(const OverloadFallbackPolicy& newPolicy) {
+    std::unique_lock<std::mutex> lock(policyMtx);
+    if (*policy == newPolicy) {
+        return;
+    }
+    SPDLOG_INFO("Overload fallback policy for model: {} set to {}", modelName, newPolicy.toString());
+    policy = std::make_shared<const OverloadFallbackPolicy>(newPolicy);
+    lock.unlock();
+    degraded.store(false);
+}
+
+std::shared_ptr<const OverloadFallbackPolicy> OverloadFallbackRouter::getPolicy() const {
+    std::unique_lock<std::mutex> lock(policyMtx);
+    return policy;
+}
+
+model_version_t OverloadFallbackRouter::route(model_version_t defaultVersion, double defaultVersionWaitMs) {
+    auto currentPolicy = getPolicy();
+    if (!currentPolicy->isEnabled() || currentPolicy->getFallbackVersion() == defaultVersion) {
+        return defaultVersion;
+    }
+    if (!degraded.load(std::memory_order_relaxed)) {
+        if (defaultVersionWaitMs > currentPolicy->getQueueWaitThresholdMs() && !degraded.exchange(true)) {
+            SPDLOG_WARN("Model: {} version: {} average wait for infer request {:.3f} ms exceeded {} ms, routing part of requests to version: {}",
+                modelName, defaultVersion, defaultVersionWaitMs, currentPolicy->getQueueWaitThresholdMs(), currentPolicy->getFallbackVersion());
+        }
+    } else if (defaultVersionWaitMs < currentPolicy->getRecoveryThresholdMs() && degraded.exchange(false)) {
+        SPDLOG_INFO("Model: {} version: {} average wait for infer request {:.3f} ms dropped below {} ms, stopped routing requests to version: {}",
+            modelName, defaultVersion, defaultVersionWaitMs, currentPolicy->getRecoveryThresholdMs(), currentPolicy->getFallbackVersion());
+    }
+    if (!degraded.load(std::memory_order_relaxed)) {
+        return defaultVersion;
+    }
+    // Spreads fallback requests evenly, n-th request goes to fallback when it crosses next multiple of 1/fraction
+    const uint64_t n = requestCounter.fetch_add(1, std::memory_order_relaxed);
+    const double fraction = currentPolicy->getFraction();
+    if (std::floor((n + 1) * fraction) > std::floor(n * fraction)) {
+        return currentPolicy->getFallbackVersion();
+    }
+    return defaultVersion;
+}
+
+}  // namespace ovms
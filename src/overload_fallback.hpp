@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <rapidjson/document.h>
+
+#include "modelversion.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Model config section routing part of requests for default version to lighter fallback version,
+ * when waiting for infer request of the default version gets longer than threshold.
+ * Requests are routed back with hysteresis, once the wait drops below recovery threshold.
+ */
+class OverloadFallbackPolicy {
+    model_version_t fallbackVersion = 0;
+    double queueWaitThresholdMs = 0;
+    double recoveryThresholdMs = 0;
+    double fraction = DEFAULT_FRACTION;
+
+public:
+    static const double DEFAULT_FRACTION;
+
+    OverloadFallbackPolicy() = default;
+    OverloadFallbackPolicy(model_version_t fallbackVersion, double queueWaitThresholdMs, double recoveryThresholdMs, double fraction = DEFAULT_FRACTION) :
+        fallbackVersion(fallbackVersion),
+        queueWaitThresholdMs(queueWaitThresholdMs),
+        recoveryThresholdMs(recoveryThresholdMs),
+        fraction(fraction) {}
+
+    bool isEnabled() const { return fallbackVersion != 0; }
+    model_version_t getFallbackVersion() const { return fallbackVersion; }
+    double getQueueWaitThresholdMs() const { return queueWaitThresholdMs; }
+    double getRecoveryThresholdMs() const { return recoveryThresholdMs; }
+    double getFraction() const { return fraction; }
+
+    bool operator==(const OverloadFallbackPolicy& rhs) const;
+    bool operator!=(const OverloadFallbackPolicy& rhs) const;
+
+    static Status fromJson(const rapidjson::Value& node, OverloadFallbackPolicy& policyOut);
+    std::string toString() const;
+};
+
+/**
+ * @brief Exponential moving average of time requests spend waiting for idle infer request
+ */
+class InferRequestWaitEstimator {
+    std::atomic<double> averageMs{0};
+
+public:
+    static const double SMOOTHING_FACTOR;
+
+    void observe(double waitMs);
+    double getAverageMs() const { return averageMs.load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Decides which version serves request for default version of a model. Policy is switched to degraded
+ * state when average wait of default version exceeds threshold and back when it drops below recovery threshold.
+ * In degraded state the configured fraction of requests is spread evenly and routed to fallback version.
+ */
+class OverloadFallbackRouter {
+    std::shared_ptr<const OverloadFallbackPolicy> policy = std::make_shared<const OverloadFallbackPolicy>();
+    mutable std::mutex policyMtx;
+    std::atomic<bool> degraded{false};
+    std::atomic<uint64_t> requestCounter{0};
+    const std::string modelName;
+
+public:
+    OverloadFallbackRouter(const std::string& modelName) :
+        modelName(modelName) {}
+
+    void setPolicy(const OverloadFallbackPolicy& newPolicy);
+    std::shared_ptr<const OverloadFallbackPolicy> getPolicy() const;
+    bool isDegraded() const { return degraded.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns version which should serve next request for default version
+     *
+     * @param defaultVersion current default version of the model
+     * @param defaultVersionWaitMs average wait for infer request of default version
+     */
+    model_version_t route(model_version_t defaultVersion, double defaultVersionWaitMs);
+};
+
+}  // namespace ovms
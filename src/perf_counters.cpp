@@ -0,0 +1,190 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "perf_counters.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "logging.hpp"
+#include "metric.hpp"
+
+namespace ovms {
+
+const char* getPerfEventName(PerfEvent event) {
+    switch (event) {
+    case PERF_EVENT_CYCLES:
+        return "cycles";
+    case PERF_EVENT_INSTRUCTIONS:
+        return "instructions";
+    case PERF_EVENT_LLC_MISSES:
+        return "llc_misses";
+    case PERF_EVENT_CONTEXT_SWITCHES:
+        return "context_switches";
+    default:
+        return "unknown";
+    }
+}
+
+const char* getPerfStageName(PerfStage stage) {
+    switch (stage) {
+    case PERF_STAGE_DESERIALIZE:
+        return "deserialize";
+    case PERF_STAGE_INFER:
+        return "infer";
+    case PERF_STAGE_SERIALIZE:
+        return "serialize";
+    case PERF_STAGE_DAG_NODE:
+        return "dag_node";
+    default:
+        return "unknown";
+    }
+}
+
+static int openPerfEvent(uint32_t type, uint64_t config, int groupFd, uint64_t readFormat) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = readFormat;
+    attr.exclude_hv = 1;
+    // Kernel time is counted when perf_event_paranoid allows it, user space only otherwise
+    int fd = syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC);
+    if (fd < 0 && (errno == EACCES || errno == EPERM)) {
+        attr.exclude_kernel = 1;
+        fd = syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC);
+    }
+    return fd;
+}
+
+ThreadPerfCounters::ThreadPerfCounters() {
+    static const uint64_t GROUP_READ_FORMAT = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    static const std::array<std::pair<PerfEvent, uint64_t>, 3> HARDWARE_EVENTS{{
+        {PERF_EVENT_CYCLES, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_EVENT_INSTRUCTIONS, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_EVENT_LLC_MISSES, PERF_COUNT_HW_CACHE_MISSES},
+    }};
+    int firstError = 0;
+    for (const auto& [event, config] : HARDWARE_EVENTS) {
+        int fd = openPerfEvent(PERF_TYPE_HARDWARE, config, groupLeaderFd, GROUP_READ_FORMAT);
+        if (fd < 0) {
+            firstError = firstError ? firstError : errno;
+            continue;
+        }
+        if (groupLeaderFd < 0) {
+            groupLeaderFd = fd;
+        }
+        fds.push_back(fd);
+        groupEvents.push_back(event);
+    }
+    contextSwitchesFd = openPerfEvent(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, -1, 0);
+    if (contextSwitchesFd < 0) {
+        firstError = firstError ? firstError : errno;
+    }
+    if (firstError) {
+        static std::once_flag warnOnce;
+        std::call_once(warnOnce, [firstError]() {
+            SPDLOG_WARN("Some hardware performance counters are not available, those will be reported as zeros: {}", std::strerror(firstError));
+        });
+    }
+}
+
+ThreadPerfCounters::~ThreadPerfCounters() {
+    for (int fd : fds) {
+        close(fd);
+    }
+    if (contextSwitchesFd >= 0) {
+        close(contextSwitchesFd);
+    }
+}
+
+ThreadPerfCounters& ThreadPerfCounters::current() {
+    thread_local ThreadPerfCounters counters;
+    return counters;
+}
+
+bool ThreadPerfCounters::isAvailable(PerfEvent event) const {
+    if (event == PERF_EVENT_CONTEXT_SWITCHES) {
+        return contextSwitchesFd >= 0;
+    }
+    return std::find(groupEvents.begin(), groupEvents.end(), event) != groupEvents.end();
+}
+
+bool ThreadPerfCounters::isAnyAvailable() const {
+    return groupLeaderFd >= 0 || contextSwitchesFd >= 0;
+}
+
+void ThreadPerfCounters::read(perf_values_t& values) const {
+    values.fill(0);
+    if (groupLeaderFd >= 0) {
+        // nr, time_enabled, time_running, values[nr]
+        std::array<uint64_t, 3 + PERF_EVENTS_COUNT> buffer;
+        ssize_t expectedSize = (3 + groupEvents.size()) * sizeof(uint64_t);
+        if (::read(groupLeaderFd, buffer.data(), expectedSize) == expectedSize) {
+            uint64_t nr = std::min<uint64_t>(buffer[0], groupEvents.size());
+            uint64_t timeEnabled = buffer[1];
+            uint64_t timeRunning = buffer[2];
+            for (uint64_t i = 0; i < nr; i++) {
+                uint64_t value = buffer[3 + i];
+                if (timeRunning > 0 && timeRunning < timeEnabled) {
+                    value = static_cast<uint64_t>(static_cast<double>(value) * timeEnabled / timeRunning);
+                }
+                values[groupEvents[i]] = value;
+            }
+        }
+    }
+    if (contextSwitchesFd >= 0) {
+        uint64_t value = 0;
+        if (::read(contextSwitchesFd, &value, sizeof(value)) == sizeof(value)) {
+            values[PERF_EVENT_CONTEXT_SWITCHES] = value;
+        }
+    }
+}
+
+PerfCountersScope::PerfCountersScope(perf_metrics_t* metrics) :
+    metrics(metrics) {
+    if (this->metrics) {
+        ThreadPerfCounters::current().read(startValues);
+    }
+}
+
+PerfCountersScope::~PerfCountersScope() {
+    stop();
+}
+
+void PerfCountersScope::stop() {
+    if (!metrics) {
+        return;
+    }
+    perf_values_t endValues;
+    ThreadPerfCounters::current().read(endValues);
+    for (size_t i = 0; i < PERF_EVENTS_COUNT; i++) {
+        // Scaled values of multiplexed counters are estimates and may decrease slightly
+        if ((*metrics)[i] && endValues[i] > startValues[i]) {
+            (*metrics)[i]->increment(static_cast<double>(endValues[i] - startValues[i]));
+        }
+    }
+    metrics = nullptr;
+}
+
+}  // namespace ovms
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ovms {
+
+class MetricCounter;
+
+enum PerfEvent : size_t {
+    PERF_EVENT_CYCLES,
+    PERF_EVENT_INSTRUCTIONS,
+    PERF_EVENT_LLC_MISSES,
+    PERF_EVENT_CONTEXT_SWITCHES,
+    PERF_EVENTS_COUNT
+};
+
+enum PerfStage : size_t {
+    PERF_STAGE_DESERIALIZE,
+    PERF_STAGE_INFER,
+    PERF_STAGE_SERIALIZE,
+    PERF_STAGE_DAG_NODE,
+    PERF_STAGES_COUNT
+};
+
+const char* getPerfEventName(PerfEvent event);
+const char* getPerfStageName(PerfStage stage);
+
+using perf_values_t = std::array<uint64_t, PERF_EVENTS_COUNT>;
+using perf_metrics_t = std::array<std::unique_ptr<MetricCounter>, PERF_EVENTS_COUNT>;
+
+/**
+ * @brief perf_event_open counters of the calling thread. Hardware events are opened as a single
+ * group, so all of them are read with one syscall. Counters are opened on first use in each thread
+ * and events not supported by the host (eg. in VMs or with restrictive perf_event_paranoid) are
+ * reported as zeros.
+ */
+class ThreadPerfCounters {
+    int groupLeaderFd = -1;
+    std::vector<int> fds;
+    std::vector<PerfEvent> groupEvents;
+    int contextSwitchesFd = -1;
+
+    ThreadPerfCounters();
+
+public:
+    ~ThreadPerfCounters();
+    ThreadPerfCounters(const ThreadPerfCounters&) = delete;
+    ThreadPerfCounters& operator=(const ThreadPerfCounters&) = delete;
+
+    static ThreadPerfCounters& current();
+
+    bool isAvailable(PerfEvent event) const;
+    bool isAnyAvailable() const;
+
+    /**
+     * @brief Reads current counter values, scaled when hardware counters were multiplexed
+     */
+    void read(perf_values_t& values) const;
+};
+
+/**
+ * @brief Counts hardware & scheduler events of the calling thread from construction until stop()
+ * or destruction and adds them to metrics. Does nothing when metrics are null.
+ */
+class PerfCountersScope {
+    perf_metrics_t* metrics;
+    perf_values_t startValues;
+
+public:
+    explicit PerfCountersScope(perf_metrics_t* metrics);
+    ~PerfCountersScope();
+    PerfCountersScope(const PerfCountersScope&) = delete;
+    PerfCountersScope& operator=(const PerfCountersScope&) = delete;
+
+    void stop();
+};
+
+}  // namespace ovms
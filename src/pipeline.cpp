@@ -21,8 +21,11 @@
 #include <string>
 #include <utility>
 
+#include "alloc_tracker.hpp"
 #include "logging.hpp"
+#include "model_metric_reporter.hpp"
 #include "node.hpp"
+#include "perf_counters.hpp"
 #include "pipelineeventqueue.hpp"
 #include "profiler.hpp"
 
@@ -30,6 +33,53 @@ namespace ovms {
 
 using DeferredNodeSessions = std::vector<std::pair<std::reference_wrapper<Node>, session_key_t>>;
 
+/**
+ * @brief Reports executing thread and deferred node sessions of single pipeline execution to DAG gauges
+ */
+class PipelineExecutionMetricGuard {
+    ServableMetricReporter& reporter;
+    size_t reportedDeferredNodeSessions = 0;
+
+public:
+    PipelineExecutionMetricGuard(ServableMetricReporter& reporter) :
+        reporter(reporter) {
+        INCREMENT_IF_ENABLED(this->reporter.dagExecutorThreads);
+    }
+
+    ~PipelineExecutionMetricGuard() {
+        DECREMENT_IF_ENABLED(this->reporter.dagExecutorThreads);
+        reportDeferredNodeSessions(0);
+    }
+
+    void reportDeferredNodeSessions(size_t count) {
+        if (!this->reporter.dagDeferredNodeSessions || count == this->reportedDeferredNodeSessions) {
+            return;
+        }
+        if (count > this->reportedDeferredNodeSessions) {
+            this->reporter.dagDeferredNodeSessions->increment(count - this->reportedDeferredNodeSessions);
+        } else {
+            this->reporter.dagDeferredNodeSessions->decrement(this->reportedDeferredNodeSessions - count);
+        }
+        this->reportedDeferredNodeSessions = count;
+    }
+};
+
+/**
+ * @brief Executes node session and counts hardware events and heap allocations of the calling thread as a processing stage of the pipeline
+ */
+static Status executeNode(Node& node, const Node& entry, ServableMetricReporter& reporter, const session_key_t& sessionKey, PipelineEventQueue& notifyEndQueue) {
+    // Exit node serializes response in fetchResults and counts it there
+    PerfStage stage = PERF_STAGE_DAG_NODE;
+    AllocStage allocStage = ALLOC_STAGE_DAG_NODE;
+    if (&node == &entry) {
+        stage = PERF_STAGE_DESERIALIZE;
+        allocStage = ALLOC_STAGE_DESERIALIZE;
+    }
+    PerfCountersScope perfCounters(reporter.getHwEvents(stage));
+    AllocTrackingScope allocScope(allocStage);
+    return node.execute(sessionKey, notifyEndQueue);
+}
+
 Pipeline::~Pipeline() = default;
 
 Pipeline::Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name) :
@@ -91,6 +141,7 @@ Status Pipeline::execute(ExecutionContext context) {
         return StatusCode::INTERNAL_ERROR;
     }
 
+    PipelineExecutionMetricGuard metricGuard(this->reporter);
     PipelineEventQueue finishedNodeQueue;
     ovms::Status firstErrorStatus{ovms::StatusCode::OK};
     std::set<std::string> startedSessions;
@@ -103,7 +154,7 @@ Status Pipeline::execute(ExecutionContext context) {
     }
     auto entrySessionKey = meta.getSessionKey();
     startedSessions.emplace(entry.getName() + entrySessionKey);
-    ovms::Status status = entry.execute(entrySessionKey, finishedNodeQueue);  // first node will triger first message
+    ovms::Status status = executeNode(entry, entry, this->reporter, entrySessionKey, finishedNodeQueue);  // first node will triger first message
     if (!status.ok()) {
         SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} failed with: {}",
             getName(), entry.getName(), status.string());
@@ -164,7 +215,11 @@ Status Pipeline::execute(ExecutionContext context) {
                 for (auto& sessionKey : readySessions) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {} session: {}", getName(), nextNode.get().getName(), sessionKey);
                     startedSessions.emplace(nextNode.get().getName() + sessionKey);
-                    status = nextNode.get().execute(sessionKey, finishedNodeQueue);
+                    if (nextNode.get().isSessionSkipped(sessionKey)) {
+                        status = nextNode.get().skip(sessionKey, finishedNodeQueue);
+                    } else {
+                        status = executeNode(nextNode.get(), entry, this->reporter, sessionKey, finishedNodeQueue);
+                    }
                     if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
                         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} not ready for execution yet", nextNode.get().getName(), sessionKey);
                         tmpDeferredNodeSessions.emplace_back(nextNode.get(), sessionKey);
@@ -186,13 +241,13 @@ Status Pipeline::execute(ExecutionContext context) {
             OVMS_PROFILE_SYNC_BEGIN("Try deferred nodes");
             for (auto it = deferredNodeSessions.begin(); it != deferredNodeSessions.end();) {
                 // Quit trying to schedule deferred nodes since handling newly finished node has bigger priority (the node can unlock stream ID or allow scheduling next nodes)
-                if (finishedNodeQueue.size() > 0) {
+                if (!finishedNodeQueue.empty()) {
                     break;
                 }
                 auto& [nodeRef, sessionKey] = *it;
                 auto& node = nodeRef.get();
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to trigger node: {} session: {} execution", node.getName(), sessionKey);
-                status = node.execute(sessionKey, finishedNodeQueue);
+                status = executeNode(node, entry, this->reporter, sessionKey, finishedNodeQueue);
                 if (status.ok()) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} is ready", node.getName(), sessionKey);
                     it = deferredNodeSessions.erase(it);
@@ -217,6 +272,7 @@ Status Pipeline::execute(ExecutionContext context) {
                 tmpDeferredNodeSessions.begin(),
                 tmpDeferredNodeSessions.end());
             OVMS_PROFILE_SYNC_END("Merge deferred containers");
+            metricGuard.reportDeferredNodeSessions(deferredNodeSessions.size());
 
             if (startedSessions.size() == finishedSessions.size()) {
                 break;
@@ -257,7 +313,7 @@ Status Pipeline::execute(ExecutionContext context) {
                 auto& [nodeRef, sessionKey] = *it;
                 auto& node = nodeRef.get();
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to trigger node: {} session: {} execution", node.getName(), sessionKey);
-                status = node.execute(sessionKey, finishedNodeQueue);
+                status = executeNode(node, entry, this->reporter, sessionKey, finishedNodeQueue);
                 if (status.ok()) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} is ready", node.getName(), sessionKey);
                     it = deferredNodeSessions.erase(it);
@@ -272,6 +328,7 @@ Status Pipeline::execute(ExecutionContext context) {
                 }
             }
             OVMS_PROFILE_SYNC_END("Try deferred nodes");
+            metricGuard.reportDeferredNodeSessions(deferredNodeSessions.size());
         }
     }
     return firstErrorStatus;
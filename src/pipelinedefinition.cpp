@@ -19,11 +19,14 @@
 #include <set>
 #include <thread>
 
+#include "condition_node.hpp"
 #include "custom_node.hpp"
 #include "dl_node.hpp"
 #include "entry_node.hpp"
 #include "exit_node.hpp"
+#include "load_phase_profiler.hpp"
 #include "logging.hpp"
+#include "memory_accounting.hpp"
 #include "modelmanager.hpp"
 #include "node_library_utils.hpp"
 #include "pipeline.hpp"
@@ -41,12 +44,17 @@ Status toNodeKind(const std::string& str, NodeKind& nodeKind) {
         nodeKind = NodeKind::CUSTOM;
         return StatusCode::OK;
     }
+    if (str == CONDITION_NODE_CONFIG_TYPE) {
+        nodeKind = NodeKind::CONDITION;
+        return StatusCode::OK;
+    }
     SPDLOG_LOGGER_ERROR(modelmanager_logger, "Unsupported node type: {}", str);
     return StatusCode::PIPELINE_NODE_WRONG_KIND_CONFIGURATION;
 }
 
 Status PipelineDefinition::validate(ModelManager& manager) {
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Started validation of pipeline: {}", getName());
+    ScopedLoadPhaseTimer phaseTimer(LoadPhase::PIPELINE_VALIDATION);
     ValidationResultNotifier notifier(status, loadedNotify);
     auto& models = manager.getModels();
     if (std::find_if(models.begin(), models.end(), [this](auto pair) { return this->pipelineName == pair.first; }) != models.end()) {
@@ -70,6 +78,10 @@ Status PipelineDefinition::validate(ModelManager& manager) {
     if (!validationResult.ok()) {
         return validationResult;
     }
+    validationResult = validateConditionalBranches();
+    if (!validationResult.ok()) {
+        return validationResult;
+    }
     std::unique_lock lock(metadataMtx);
     validationResult = updateInputsInfo(manager);
     if (!validationResult.ok()) {
@@ -97,19 +109,40 @@ Status PipelineDefinition::initializeNodeResources(ModelManager& manager) {
                 SPDLOG_LOGGER_ERROR(modelmanager_logger, "Pipeline: {} node: {} refers to invalid library", pipelineName, nodeInfo.nodeName);
                 return StatusCode::PIPELINE_DEFINITION_INVALID_NODE_LIBRARY;
             }
+            // Libraries preallocate their buffer pools in initialize, so growth of process memory is attributed to the node
+            uint64_t rssBefore = getProcessRssBytes();
             auto status = nodeInfo.library.initialize(&customNodeLibraryInternalManager, params.get(), paramsLength);
             if (status != 0) {
                 SPDLOG_LOGGER_ERROR(modelmanager_logger, "Initialization of library with base path: {} failed", nodeInfo.library.basePath);
                 return StatusCode::NODE_LIBRARY_INITIALIZE_FAILED;
             }
+            uint64_t rssAfter = getProcessRssBytes();
             std::shared_ptr<CNLIMWrapper> sharedCustomNodeLibraryInternalManager(new CNLIMWrapper{customNodeLibraryInternalManager, nodeInfo.library.deinitialize});
             manager.addResourceToCleaner(sharedCustomNodeLibraryInternalManager);
-            nodeResources.emplace(std::make_pair(nodeInfo.nodeName, std::move(sharedCustomNodeLibraryInternalManager)));
+            auto emplaced = nodeResources.emplace(std::make_pair(nodeInfo.nodeName, std::move(sharedCustomNodeLibraryInternalManager)));
+            if (emplaced.second) {
+                nodeResourcesMemory[nodeInfo.nodeName] = rssAfter > rssBefore ? rssAfter - rssBefore : 0;
+                SPDLOG_LOGGER_INFO(modelmanager_logger, "Pipeline: {} node: {} library initialization allocated: {} bytes",
+                    pipelineName, nodeInfo.nodeName, nodeResourcesMemory[nodeInfo.nodeName]);
+            }
         }
     }
+    updateNodeResourcesMemoryMetric();
     return StatusCode::OK;
 }
 
+uint64_t PipelineDefinition::getNodeResourcesMemoryBytes() const {
+    uint64_t total = 0;
+    for (const auto& [nodeName, bytes] : nodeResourcesMemory) {
+        total += bytes;
+    }
+    return total;
+}
+
+void PipelineDefinition::updateNodeResourcesMemoryMetric() {
+    SET_IF_ENABLED(this->reporter->dagCustomNodesMemory, getNodeResourcesMemoryBytes());
+}
+
 // returns NodeInfos that are in PipelineDefinition, but are not in nodeInfos(std::vector argument)
 std::vector<NodeInfo> PipelineDefinition::calculateNodeInfosDiff(const std::vector<NodeInfo>& nodeInfos) {
     std::vector<NodeInfo> diff;
@@ -131,8 +164,10 @@ void PipelineDefinition::deinitializeNodeResources(const std::vector<NodeInfo>&
                 continue;
             }
             nodeResources.erase(nodeInfo.nodeName);
+            nodeResourcesMemory.erase(nodeInfo.nodeName);
         }
     }
+    updateNodeResourcesMemoryMetric();
 }
 
 Status PipelineDefinition::reload(ModelManager& manager, const std::vector<NodeInfo>&& nodeInfos, const pipeline_connections_t&& connections) {
@@ -255,8 +290,14 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
                                              info.gatherFromNode,
                                              nodeResources.at(info.nodeName)));
             break;
+        case NodeKind::CONDITION:
+            nodes.emplace(info.nodeName, std::make_unique<ConditionNode>(
+                                             info.nodeName,
+                                             info.condition.value(),
+                                             info.outputNameAliases));
+            break;
         case NodeKind::EXIT: {
-            auto node = std::make_unique<ExitNode<ResponseType>>(response, getOutputsInfo(), info.gatherFromNode);
+            auto node = std::make_unique<ExitNode<ResponseType>>(response, getOutputsInfo(), info.gatherFromNode, this->reporter->getHwEvents(PERF_STAGE_SERIALIZE));
             exit = node.get();
             nodes.emplace(info.nodeName, std::move(node));
             break;
@@ -332,6 +373,46 @@ void PipelineDefinition::makeSubscriptions(ModelManager& manager) {
     }
 }
 
+// Condition nodes pass their inputs through, so data item of condition node is resolved
+// to the data item of the node connected to corresponding condition node input.
+static Status resolveConditionNodeDataSource(
+    const std::vector<NodeInfo>& nodeInfos,
+    const pipeline_connections_t& connections,
+    const NodeInfo& conditionNodeInfo,
+    const std::string& alias,
+    const NodeInfo*& sourceNodeInfo,
+    std::string& sourceAlias) {
+    sourceNodeInfo = &conditionNodeInfo;
+    sourceAlias = alias;
+    while (sourceNodeInfo->kind == NodeKind::CONDITION) {
+        auto aliasIt = sourceNodeInfo->outputNameAliases.find(sourceAlias);
+        const auto& inputName = aliasIt != sourceNodeInfo->outputNameAliases.end() ? aliasIt->second : sourceAlias;
+        auto connectionsIt = connections.find(sourceNodeInfo->nodeName);
+        if (connectionsIt == connections.end()) {
+            return StatusCode::PIPELINE_CONDITION_OUTPUT_NOT_INPUT;
+        }
+        const NodeInfo* nextNodeInfo = nullptr;
+        for (const auto& [dependencyNodeName, mapping] : connectionsIt->second) {
+            auto pairIt = std::find_if(mapping.begin(), mapping.end(), [&inputName](const auto& pair) { return pair.second == inputName; });
+            if (pairIt == mapping.end()) {
+                continue;
+            }
+            auto nodeInfoIt = std::find_if(nodeInfos.begin(), nodeInfos.end(), [&dependencyNodeName](const NodeInfo& nodeInfo) { return nodeInfo.nodeName == dependencyNodeName; });
+            if (nodeInfoIt == nodeInfos.end()) {
+                return StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_NODE;
+            }
+            nextNodeInfo = &(*nodeInfoIt);
+            sourceAlias = pairIt->first;
+            break;
+        }
+        if (nextNodeInfo == nullptr) {
+            return StatusCode::PIPELINE_CONDITION_OUTPUT_NOT_INPUT;
+        }
+        sourceNodeInfo = nextNodeInfo;
+    }
+    return StatusCode::OK;
+}
+
 class NodeValidator {
     const std::string& pipelineName;
     ModelManager& manager;
@@ -641,9 +722,66 @@ public:
         return StatusCode::OK;
     }
 
+    Status validateConditionNodeDependencyConnection(const NodeInfo& dependencyNodeInfo, const Aliases& mapping) {
+        for (const auto& [alias, realName] : mapping) {
+            auto result = checkConnectionMappedToExistingDataSource(dependencyNodeInfo, alias);
+            if (!result.ok()) {
+                return result;
+            }
+            const NodeInfo* sourceNodeInfo = nullptr;
+            std::string sourceAlias;
+            result = resolveConditionNodeDataSource(nodeInfos, connections, dependencyNodeInfo, alias, sourceNodeInfo, sourceAlias);
+            if (!result.ok()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline: {} definition failed. Condition node: {} data item: {} is not connected to any of its inputs",
+                    pipelineName,
+                    dependencyNodeInfo.nodeName,
+                    alias);
+                return result;
+            }
+            this->dependencyInputsInfo.clear();
+            this->dependencyOutputsInfo.clear();
+            result = validateConnection(*sourceNodeInfo, {{sourceAlias, realName}});
+            if (!result.ok()) {
+                return result;
+            }
+        }
+        return StatusCode::OK;
+    }
+
+    Status validateConditionNode() const {
+        std::set<std::string> connectedInputs;
+        auto it = connections.find(dependantNodeInfo.nodeName);
+        if (it != connections.end()) {
+            for (const auto& [dependencyNodeName, mapping] : it->second) {
+                for (const auto& [alias, realName] : mapping) {
+                    connectedInputs.insert(realName);
+                }
+            }
+        }
+        if (!dependantNodeInfo.condition || connectedInputs.count(dependantNodeInfo.condition->inputName) == 0) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline: {} definition failed. Condition node: {} input used in condition is not connected",
+                pipelineName,
+                dependantNodeInfo.nodeName);
+            return StatusCode::PIPELINE_CONDITION_INPUT_MISSING;
+        }
+        for (const auto& [alias, realName] : dependantNodeInfo.outputNameAliases) {
+            if (connectedInputs.count(realName) == 0) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline: {} definition failed. Condition node: {} output: {} is not one of node inputs",
+                    pipelineName,
+                    dependantNodeInfo.nodeName,
+                    realName);
+                return StatusCode::PIPELINE_CONDITION_OUTPUT_NOT_INPUT;
+            }
+        }
+        return StatusCode::OK;
+    }
+
     Status validateConnection(const NodeInfo& dependencyNodeInfo, const Aliases& mapping) {
-        // At this point dependency node can only be either DL model node, Custom node or entry node.
+        // At this point dependency node can only be either DL model node, Custom node, Condition node or entry node.
         // Take care when adding new node types.
+        if (dependencyNodeInfo.kind == NodeKind::CONDITION) {
+            return validateConditionNodeDependencyConnection(dependencyNodeInfo, mapping);
+        }
         std::unique_ptr<ModelInstanceUnloadGuard> dependencyModelUnloadGuard;
         std::shared_ptr<ModelInstance> dependencyModelInstance;
         if (dependencyNodeInfo.kind == NodeKind::DL) {
@@ -784,6 +922,13 @@ public:
             prepareRemainingUnconnectedDependantInputsSet();
         }
 
+        if (dependantNodeInfo.kind == NodeKind::CONDITION) {
+            auto result = validateConditionNode();
+            if (!result.ok()) {
+                return result;
+            }
+        }
+
         if (dependantNodeInfo.kind == NodeKind::DL || dependantNodeInfo.kind == NodeKind::CUSTOM) {
             for (const auto& [name, tensorOutput] : outputsInfo) {
                 auto result = validateShapeWithDemultiplexer(tensorOutput->getShape(), dependantNodeInfo);
@@ -963,6 +1108,41 @@ Status PipelineDefinition::validateDemultiplexerGatherNodesOrder() {
     return StatusCode::OK;
 }
 
+Status PipelineDefinition::validateConditionalBranches() {
+    // Skipped sessions are not demultiplied nor gathered, so nodes which can be skipped cannot take part in demultiplexing
+    std::map<std::string, std::vector<std::string>> dependants;
+    for (const auto& [dependantNodeName, allMappings] : connections) {
+        for (const auto& [dependencyNodeName, mapping] : allMappings) {
+            dependants[dependencyNodeName].emplace_back(dependantNodeName);
+        }
+    }
+    for (const auto& conditionNodeInfo : nodeInfos) {
+        if (conditionNodeInfo.kind != NodeKind::CONDITION) {
+            continue;
+        }
+        std::set<std::string> visited;
+        std::vector<std::string> nodesToCheck{conditionNodeInfo.nodeName};
+        while (!nodesToCheck.empty()) {
+            auto nodeName = nodesToCheck.back();
+            nodesToCheck.pop_back();
+            if (!visited.insert(nodeName).second) {
+                continue;
+            }
+            const auto& nodeInfo = findNodeByName(nodeName);
+            if (nodeInfo.demultiplyCount || !nodeInfo.gatherFromNode.empty()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "PipelineDefinition: {} node: {} depends on condition node: {} and cannot demultiply or gather",
+                    pipelineName, nodeName, conditionNodeInfo.nodeName);
+                return StatusCode::PIPELINE_CONDITION_SKIPPED_NODE_DEMULTIPLEXING;
+            }
+            auto it = dependants.find(nodeName);
+            if (it != dependants.end()) {
+                nodesToCheck.insert(nodesToCheck.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+    return StatusCode::OK;
+}
+
 Status PipelineDefinition::validateNodes(ModelManager& manager) {
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Validation of pipeline definition: {} nodes started.", getName());
 
@@ -1116,6 +1296,7 @@ Status PipelineDefinition::updateInputsInfo(const ModelManager& manager) {
             }
 
             switch (dependantNodeInfo->kind) {
+            case NodeKind::CONDITION:
             case NodeKind::EXIT: {
                 for (const auto& [alias, realName] : specificDependencyMapping) {
                     inputsInfo.insert({alias, TensorInfo::getUnspecifiedTensorInfo()});
@@ -1239,41 +1420,52 @@ Status PipelineDefinition::updateOutputsInfo(const ModelManager& manager) {
 
         for (const auto& [dependencyNodeName, specificDependencyMapping] : allMappings) {
             const auto& dependencyNodeInfo = std::find_if(std::begin(nodeInfos), std::end(nodeInfos), byName(dependencyNodeName));
-
-            switch (dependencyNodeInfo->kind) {
-            case NodeKind::ENTRY: {
-                for (const auto& [alias, realName] : specificDependencyMapping) {
-                    outputsInfo.insert({realName, TensorInfo::getUnspecifiedTensorInfo()});
+            if (dependencyNodeInfo->kind != NodeKind::CONDITION) {
+                auto status = populateOutputsInfoWithNodeOutputs(*dependencyNodeInfo, manager, outputsInfo, specificDependencyMapping, gatherShape);
+                if (!status.ok()) {
+                    return status;
                 }
-                break;
+                continue;
             }
-            case NodeKind::DL: {
-                auto status = populateOutputsInfoWithDLModelOutputs(
-                    *dependencyNodeInfo, manager, outputsInfo, specificDependencyMapping, gatherShape);
+            for (const auto& [alias, realName] : specificDependencyMapping) {
+                const NodeInfo* sourceNodeInfo = nullptr;
+                std::string sourceAlias;
+                auto status = resolveConditionNodeDataSource(nodeInfos, connections, *dependencyNodeInfo, alias, sourceNodeInfo, sourceAlias);
                 if (!status.ok()) {
                     return status;
                 }
-                break;
-            }
-            case NodeKind::CUSTOM: {
-                auto status = populateOutputsInfoWithCustomNodeOutputs(
-                    *dependencyNodeInfo, manager, outputsInfo, specificDependencyMapping, gatherShape);
+                status = populateOutputsInfoWithNodeOutputs(*sourceNodeInfo, manager, outputsInfo, {{sourceAlias, realName}}, gatherShape);
                 if (!status.ok()) {
                     return status;
                 }
-                break;
-            }
-            default: {
-                // Pipeline validation does not allow connections from exit node.
-                SPDLOG_ERROR("Unexpected dependency node kind (name: {})", this->getName());
-                return StatusCode::UNKNOWN_ERROR;
-            }
             }
         }
     }
     return StatusCode::OK;
 }
 
+Status PipelineDefinition::populateOutputsInfoWithNodeOutputs(const NodeInfo& dependencyNodeInfo, const ModelManager& manager, tensor_map_t& outputsInfo, const Aliases& specificDependencyMapping, const Shape& gatherShape) const {
+    switch (dependencyNodeInfo.kind) {
+    case NodeKind::ENTRY: {
+        for (const auto& [alias, realName] : specificDependencyMapping) {
+            outputsInfo.insert({realName, TensorInfo::getUnspecifiedTensorInfo()});
+        }
+        return StatusCode::OK;
+    }
+    case NodeKind::DL:
+        return populateOutputsInfoWithDLModelOutputs(
+            dependencyNodeInfo, manager, outputsInfo, specificDependencyMapping, gatherShape);
+    case NodeKind::CUSTOM:
+        return populateOutputsInfoWithCustomNodeOutputs(
+            dependencyNodeInfo, manager, outputsInfo, specificDependencyMapping, gatherShape);
+    default: {
+        // Pipeline validation does not allow connections from exit node.
+        SPDLOG_ERROR("Unexpected dependency node kind (name: {})", this->getName());
+        return StatusCode::UNKNOWN_ERROR;
+    }
+    }
+}
+
 Status PipelineDefinition::getCustomNodeMetadata(const NodeInfo& customNodeInfo, tensor_map_t& inputsInfo, metadata_fn callback, const std::string& pipelineName, void* customNodeLibraryInternalManager) {
     struct CustomNodeTensorInfo* info = nullptr;
     int infoCount = 0;
@@ -72,6 +72,8 @@ class PipelineDefinition {
     const std::string pipelineName;
     std::vector<NodeInfo> nodeInfos;
     std::map<std::string, std::shared_ptr<CNLIMWrapper>> nodeResources = {};
+    // Growth of process memory during initialization of each custom node library
+    std::map<std::string, uint64_t> nodeResourcesMemory = {};
     pipeline_connections_t connections;
 
 protected:
@@ -111,7 +113,7 @@ public:
         pipelineName(pipelineName),
         nodeInfos(nodeInfos),
         connections(connections),
-        reporter(std::make_unique<ServableMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
+        reporter(std::make_unique<PipelineMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
         status(this->pipelineName) {}
     template <typename RequestType, typename ResponseType>
     Status create(std::unique_ptr<Pipeline>& pipeline,
@@ -133,9 +135,12 @@ public:
     Status validateNodes(ModelManager& manager);
     Status validateForCycles();
     Status validateDemultiplexerGatherNodesOrder();
+    Status validateConditionalBranches();
     Status initializeNodeResources(ModelManager& manager);
     std::vector<NodeInfo> calculateNodeInfosDiff(const std::vector<NodeInfo>& nodeInfos);
     void deinitializeNodeResources(const std::vector<NodeInfo>& nodeInfosDiff);
+    void updateNodeResourcesMemoryMetric();
+    uint64_t getNodeResourcesMemoryBytes() const;
 
     const std::string& getName() const { return pipelineName; }
     const PipelineDefinitionStateCode getStateCode() const { return status.getStateCode(); }
@@ -169,6 +174,13 @@ public:
 private:
     static Status getCustomNodeMetadata(const NodeInfo& customNodeInfo, tensor_map_t& inputsInfo, metadata_fn callback, const std::string& pipelineName, void* customNodeLibraryInternalManager);
 
+    Status populateOutputsInfoWithNodeOutputs(
+        const NodeInfo& dependencyNodeInfo,
+        const ModelManager& manager,
+        tensor_map_t& outputsInfo,
+        const Aliases& aliases,
+        const Shape& gatherShape) const;
+
     Status populateOutputsInfoWithDLModelOutputs(
         const NodeInfo& dependencyNodeInfo,
         const ModelManager& manager,
@@ -17,12 +17,12 @@
 
 #include <utility>
 
-#include "threadsafequeue.hpp"
+#include "singleconsumerqueue.hpp"
 
 namespace ovms {
 
 class Node;
 
 using NodeSessionKeyPair = std::pair<std::reference_wrapper<Node>, session_key_t>;
-using PipelineEventQueue = ThreadSafeQueue<NodeSessionKeyPair>;
+using PipelineEventQueue = SingleConsumerQueue<NodeSessionKeyPair>;
 }  // namespace ovms
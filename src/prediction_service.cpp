@@ -71,7 +71,7 @@ Status PredictionServiceImpl::getModelInstance(const PredictRequest* request,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
     OVMS_PROFILE_FUNCTION();
-    return this->modelManager.getModelInstance(request->model_spec().name(), request->model_spec().version().value(), modelInstance, modelInstanceUnloadGuardPtr);
+    return this->modelManager.getModelInstanceForInference(request->model_spec().name(), request->model_spec().version().value(), modelInstance, modelInstanceUnloadGuardPtr);
 }
 
 Status PredictionServiceImpl::getPipeline(const PredictRequest* request,
@@ -115,6 +115,19 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
         ExecutionContext::Interface::GRPC,
         ExecutionContext::Method::Predict};
 
+    std::unique_ptr<TenantQuotaGuard> tenantQuotaGuard;
+    auto& tenantLimiter = this->modelManager.getTenantLimiter();
+    status = tenantLimiter.acquire(request->model_spec().name(), getRequestTenant(context, tenantLimiter.getHeaderName()), tenantQuotaGuard);
+    if (!status.ok()) {
+        if (pipelinePtr) {
+            INCREMENT_IF_ENABLED(pipelinePtr->getMetricReporter().getInferRequestMetric(executionContext, false));
+        } else {
+            INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+        }
+        SPDLOG_DEBUG("Tenant quota check failed. {}", status.string());
+        return status.grpc();
+    }
+
     if (pipelinePtr) {
         status = pipelinePtr->execute(executionContext);
         INCREMENT_IF_ENABLED(pipelinePtr->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
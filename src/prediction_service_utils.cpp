@@ -15,6 +15,8 @@
 //*****************************************************************************
 #include "prediction_service_utils.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <map>
 
 #include "deserialization.hpp"
@@ -97,4 +99,19 @@ std::map<std::string, shape_t> getRequestShapes(const tensorflow::serving::Predi
     return requestShapes;
 }
 
+std::string getRequestTenant(const ::grpc::ServerContext* context, const std::string& headerName) {
+    if (context == nullptr || headerName.empty()) {
+        return "";
+    }
+    // gRPC metadata keys are always lowercase
+    std::string key = headerName;
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return std::tolower(c); });
+    const auto& metadata = context->client_metadata();
+    auto it = metadata.find(key);
+    if (it == metadata.end()) {
+        return "";
+    }
+    return std::string(it->second.data(), it->second.size());
+}
+
 }  // namespace ovms
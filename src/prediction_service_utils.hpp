@@ -35,4 +35,9 @@ std::map<std::string, shape_t> getRequestShapes(const ::inference::ModelInferReq
 std::optional<Dimension> getRequestBatchSize(const tensorflow::serving::PredictRequest* request, const size_t batchSizeIndex);
 std::map<std::string, shape_t> getRequestShapes(const tensorflow::serving::PredictRequest* request);
 
+/**
+ * @brief Reads tenant of the request from gRPC metadata. Returns empty string if not present.
+ */
+std::string getRequestTenant(const ::grpc::ServerContext* context, const std::string& headerName);
+
 }  // namespace ovms
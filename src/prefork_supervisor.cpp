@@ -0,0 +1,332 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "prefork_supervisor.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+namespace {
+volatile sig_atomic_t reload_request = 0;
+
+void onHangup(int status) {
+    reload_request = 1;
+}
+
+const std::chrono::milliseconds SUPERVISOR_POLL_INTERVAL{200};
+}  // namespace
+
+const std::chrono::milliseconds PreforkSupervisor::MIN_RESTART_DELAY{500};
+const std::chrono::milliseconds PreforkSupervisor::MAX_RESTART_DELAY{30000};
+const std::chrono::seconds PreforkSupervisor::WORKER_STOP_TIMEOUT{30};
+
+PreforkSupervisor::PreforkSupervisor(uint32_t workersCount, std::function<bool()> isShutdownRequested) :
+    workersCount(workersCount),
+    isShutdownRequested(std::move(isShutdownRequested)),
+    workers(workersCount) {}
+
+PreforkSupervisor::~PreforkSupervisor() {
+    for (auto& worker : workers) {
+        closeReadyFd(worker);
+    }
+    if (readyWriteFd >= 0) {
+        close(readyWriteFd);
+    }
+}
+
+PreforkRole PreforkSupervisor::run() {
+    static struct sigaction sigHupHandler;
+    sigHupHandler.sa_handler = onHangup;
+    sigemptyset(&sigHupHandler.sa_mask);
+    sigHupHandler.sa_flags = 0;
+    sigaction(SIGHUP, &sigHupHandler, NULL);
+
+    SPDLOG_INFO("Starting {} worker processes in prefork mode", workersCount);
+    if (spawn(0)) {
+        return PreforkRole::WORKER;
+    }
+    // Remaining workers are started after the first one loaded models, so they can import compiled models from cache
+    while (!workers[0].ready && workers[0].pid != 0 && !isShutdownRequested()) {
+        pollReady(SUPERVISOR_POLL_INTERVAL);
+        reapExited();
+    }
+    if (!workers[0].ready) {
+        if (!isShutdownRequested()) {
+            SPDLOG_ERROR("First worker process failed to start, stopping supervisor");
+            exitCode = EXIT_FAILURE;
+        }
+        stopWorkers();
+        return PreforkRole::SUPERVISOR;
+    }
+    for (uint32_t i = 1; i < workersCount; ++i) {
+        if (spawn(i)) {
+            return PreforkRole::WORKER;
+        }
+    }
+    while (!isShutdownRequested()) {
+        pollReady(SUPERVISOR_POLL_INTERVAL);
+        reapExited();
+        if (restartPending()) {
+            return PreforkRole::WORKER;
+        }
+        if (reload_request) {
+            reload_request = 0;
+            if (reloadQueue.empty()) {
+                SPDLOG_INFO("Received SIGHUP, restarting worker processes one at a time");
+                for (uint32_t i = 0; i < workersCount; ++i) {
+                    reloadQueue.push_back(i);
+                }
+            }
+        }
+        progressRollingRestart();
+    }
+    SPDLOG_INFO("Stopping worker processes");
+    stopWorkers();
+    return PreforkRole::SUPERVISOR;
+}
+
+bool PreforkSupervisor::spawn(uint32_t index) {
+    Worker& worker = workers[index];
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0) {
+        SPDLOG_ERROR("Failed to create pipe for worker process {}: {}", index, std::strerror(errno));
+        worker.restartDelay = std::min(std::max(MIN_RESTART_DELAY, worker.restartDelay * 2), MAX_RESTART_DELAY);
+        worker.restartAt = std::chrono::steady_clock::now() + worker.restartDelay;
+        return false;
+    }
+    const pid_t supervisorPid = getpid();
+    const pid_t pid = fork();
+    if (pid < 0) {
+        SPDLOG_ERROR("Failed to fork worker process {}: {}", index, std::strerror(errno));
+        close(fds[0]);
+        close(fds[1]);
+        worker.restartDelay = std::min(std::max(MIN_RESTART_DELAY, worker.restartDelay * 2), MAX_RESTART_DELAY);
+        worker.restartAt = std::chrono::steady_clock::now() + worker.restartDelay;
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        for (auto& other : workers) {
+            closeReadyFd(other);
+        }
+        workers.clear();
+        reloadQueue.clear();
+        readyWriteFd = fds[1];
+        workerIndex = index;
+        // Reload is driven by supervisor, worker should not be stopped by terminal hangup either
+        signal(SIGHUP, SIG_IGN);
+        // Worker must not outlive supervisor, otherwise it would keep serving outside of its control
+        prctl(PR_SET_PDEATHSIG, SIGTERM);
+        if (getppid() != supervisorPid) {
+            raise(SIGTERM);
+        }
+        return true;
+    }
+    close(fds[1]);
+    worker.pid = pid;
+    worker.readyFd = fds[0];
+    worker.ready = false;
+    worker.reloading = false;
+    SPDLOG_INFO("Started worker process {} with pid {}", index, pid);
+    return false;
+}
+
+void PreforkSupervisor::notifyReady() {
+    if (readyWriteFd < 0) {
+        return;
+    }
+    const char ready = 1;
+    if (write(readyWriteFd, &ready, 1) != 1) {
+        SPDLOG_WARN("Failed to notify supervisor about worker readiness: {}", std::strerror(errno));
+    }
+    close(readyWriteFd);
+    readyWriteFd = -1;
+}
+
+void PreforkSupervisor::closeReadyFd(Worker& worker) {
+    if (worker.readyFd >= 0) {
+        close(worker.readyFd);
+        worker.readyFd = -1;
+    }
+}
+
+void PreforkSupervisor::pollReady(std::chrono::milliseconds timeout) {
+    std::vector<struct pollfd> fds;
+    std::vector<uint32_t> indexes;
+    for (uint32_t i = 0; i < workers.size(); ++i) {
+        if (workers[i].readyFd >= 0) {
+            fds.push_back({workers[i].readyFd, POLLIN, 0});
+            indexes.push_back(i);
+        }
+    }
+    if (fds.empty()) {
+        std::this_thread::sleep_for(timeout);
+        return;
+    }
+    // Interrupted by signal poll returns early, caller checks shutdown and reload requests
+    if (poll(fds.data(), fds.size(), timeout.count()) <= 0) {
+        return;
+    }
+    for (size_t i = 0; i < fds.size(); ++i) {
+        if (fds[i].revents == 0) {
+            continue;
+        }
+        Worker& worker = workers[indexes[i]];
+        char ready = 0;
+        if (read(worker.readyFd, &ready, 1) == 1) {
+            worker.ready = true;
+            SPDLOG_INFO("Worker process {} with pid {} is ready", indexes[i], worker.pid);
+        }
+        // Either readiness was reported or worker exited before it, exit is handled by reapExited
+        closeReadyFd(worker);
+    }
+}
+
+void PreforkSupervisor::reapExited() {
+    int status = 0;
+    pid_t pid;
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        auto it = std::find_if(workers.begin(), workers.end(), [pid](const Worker& worker) { return worker.pid == pid; });
+        if (it == workers.end()) {
+            continue;
+        }
+        Worker& worker = *it;
+        const uint32_t index = std::distance(workers.begin(), it);
+        closeReadyFd(worker);
+        if (worker.reloading) {
+            SPDLOG_INFO("Worker process {} with pid {} stopped for reload", index, pid);
+            worker.restartDelay = std::chrono::milliseconds(0);
+        } else {
+            if (WIFSIGNALED(status)) {
+                SPDLOG_ERROR("Worker process {} with pid {} killed by signal {}", index, pid, WTERMSIG(status));
+            } else {
+                SPDLOG_ERROR("Worker process {} with pid {} exited with code {}", index, pid, WEXITSTATUS(status));
+            }
+            // Backoff grows only while worker keeps failing before it gets ready
+            worker.restartDelay = worker.ready ? MIN_RESTART_DELAY : std::min(std::max(MIN_RESTART_DELAY, worker.restartDelay * 2), MAX_RESTART_DELAY);
+            SPDLOG_INFO("Worker process {} will be restarted in {} ms", index, worker.restartDelay.count());
+        }
+        worker.pid = 0;
+        worker.ready = false;
+        worker.reloading = false;
+        worker.restartAt = std::chrono::steady_clock::now() + worker.restartDelay;
+    }
+}
+
+bool PreforkSupervisor::restartPending() {
+    const auto now = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < workers.size(); ++i) {
+        if (workers[i].pid == 0 && now >= workers[i].restartAt) {
+            if (spawn(i)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void PreforkSupervisor::progressRollingRestart() {
+    if (reloadQueue.empty()) {
+        return;
+    }
+    Worker& worker = workers[reloadQueue.front()];
+    if (worker.reloading) {
+        if (std::chrono::steady_clock::now() > worker.stopDeadline) {
+            SPDLOG_WARN("Worker process {} with pid {} did not stop in {} s, killing it", reloadQueue.front(), worker.pid, WORKER_STOP_TIMEOUT.count());
+            kill(worker.pid, SIGKILL);
+            worker.stopDeadline = std::chrono::steady_clock::time_point::max();
+        }
+        return;
+    }
+    if (!reloadStepStarted) {
+        if (worker.pid == 0) {
+            // Worker is waiting for restart which picks up new configuration anyway
+            reloadQueue.erase(reloadQueue.begin());
+            return;
+        }
+        if (!worker.ready) {
+            return;
+        }
+        kill(worker.pid, SIGTERM);
+        worker.reloading = true;
+        worker.stopDeadline = std::chrono::steady_clock::now() + WORKER_STOP_TIMEOUT;
+        reloadStepStarted = true;
+        return;
+    }
+    // Next worker is replaced only after the new one is ready, so at most one process is out of service
+    if (worker.pid != 0 && worker.ready) {
+        reloadQueue.erase(reloadQueue.begin());
+        reloadStepStarted = false;
+        if (reloadQueue.empty()) {
+            SPDLOG_INFO("All worker processes restarted");
+        }
+    }
+}
+
+size_t PreforkSupervisor::runningWorkersCount() const {
+    return std::count_if(workers.begin(), workers.end(), [](const Worker& worker) { return worker.pid != 0; });
+}
+
+void PreforkSupervisor::stopWorkers() {
+    for (auto& worker : workers) {
+        if (worker.pid != 0) {
+            kill(worker.pid, SIGTERM);
+        }
+    }
+    const auto deadline = std::chrono::steady_clock::now() + WORKER_STOP_TIMEOUT;
+    while (runningWorkersCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        int status = 0;
+        const pid_t pid = waitpid(-1, &status, WNOHANG);
+        if (pid <= 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+        for (uint32_t i = 0; i < workers.size(); ++i) {
+            if (workers[i].pid == pid) {
+                SPDLOG_INFO("Worker process {} with pid {} stopped", i, pid);
+                closeReadyFd(workers[i]);
+                workers[i].pid = 0;
+            }
+        }
+    }
+    for (uint32_t i = 0; i < workers.size(); ++i) {
+        if (workers[i].pid == 0) {
+            continue;
+        }
+        SPDLOG_WARN("Worker process {} with pid {} did not stop in {} s, killing it", i, workers[i].pid, WORKER_STOP_TIMEOUT.count());
+        kill(workers[i].pid, SIGKILL);
+        int status = 0;
+        waitpid(workers[i].pid, &status, 0);
+        closeReadyFd(workers[i]);
+        workers[i].pid = 0;
+    }
+}
+
+}  // namespace ovms
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace ovms {
+
+enum class PreforkRole {
+    SUPERVISOR,
+    WORKER
+};
+
+/**
+ * @brief Supervises server worker processes in prefork mode. Each worker runs complete server with its own
+ * OpenVINO core, gRPC and REST listeners are opened with SO_REUSEPORT so the kernel balances connections
+ * between workers. Supervisor never loads models and stays single threaded, which keeps forking it safe.
+ *
+ * First worker is started alone and remaining ones are forked once it reports readiness. With model cache
+ * enabled only the first worker compiles models, others import compiled blobs from the cache directory.
+ * Failed workers are restarted with exponential backoff. SIGHUP triggers rolling restart - workers are
+ * replaced one at a time, so the ports are served during the whole reload.
+ */
+class PreforkSupervisor {
+public:
+    static const std::chrono::milliseconds MIN_RESTART_DELAY;
+    static const std::chrono::milliseconds MAX_RESTART_DELAY;
+    static const std::chrono::seconds WORKER_STOP_TIMEOUT;
+
+    PreforkSupervisor(uint32_t workersCount, std::function<bool()> isShutdownRequested);
+    PreforkSupervisor(const PreforkSupervisor&) = delete;
+    PreforkSupervisor& operator=(const PreforkSupervisor&) = delete;
+    ~PreforkSupervisor();
+
+    /**
+     * @brief Forks workers and supervises them until shutdown is requested. Returns WORKER in forked worker
+     * processes, which should continue regular server startup. Returns SUPERVISOR once all workers are stopped.
+     */
+    PreforkRole run();
+
+    /**
+     * @brief Called by worker once its server is started, lets supervisor continue with remaining workers
+     */
+    void notifyReady();
+
+    int getExitCode() const { return exitCode; }
+    std::optional<uint32_t> getWorkerIndex() const { return workerIndex; }
+
+private:
+    struct Worker {
+        pid_t pid = 0;
+        int readyFd = -1;
+        bool ready = false;
+        bool reloading = false;
+        std::chrono::milliseconds restartDelay{0};
+        std::chrono::steady_clock::time_point restartAt;
+        std::chrono::steady_clock::time_point stopDeadline;
+    };
+
+    bool spawn(uint32_t index);
+    void closeReadyFd(Worker& worker);
+    void pollReady(std::chrono::milliseconds timeout);
+    void reapExited();
+    bool restartPending();
+    void progressRollingRestart();
+    void stopWorkers();
+    size_t runningWorkersCount() const;
+
+    const uint32_t workersCount;
+    std::function<bool()> isShutdownRequested;
+    std::vector<Worker> workers;
+    std::optional<uint32_t> workerIndex;
+    int readyWriteFd = -1;
+    std::vector<uint32_t> reloadQueue;
+    bool reloadStepStarted = false;
+    int exitCode = 0;
+};
+
+}  // namespace ovms
@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -35,8 +36,10 @@ class Queue {
 public:
     /**
     * @brief Allocating idle stream for execution
+    *
+    * @param lowPriority when no stream is idle, wait behind all regular requests
     */
-    std::future<int> getIdleStream() {
+    std::future<int> getIdleStream(bool lowPriority = false) {
         // OVMS_PROFILE_FUNCTION();
         int value;
         std::promise<int> idleStreamPromise;
@@ -44,7 +47,8 @@ public:
         std::unique_lock<std::mutex> lk(front_mut);
         if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
             std::unique_lock<std::mutex> queueLock(queue_mutex);
-            promises.push(std::move(idleStreamPromise));
+            (lowPriority ? lowPriorityPromises : promises).push(std::move(idleStreamPromise));
+            notifyWaitersCountChanged();
         } else {  // we can give idle stream right away
             value = streams[front_idx];
             streams[front_idx] = -1;  // negative value indicate consumed vector index
@@ -76,9 +80,12 @@ public:
     void returnStream(int streamID) {
         // OVMS_PROFILE_FUNCTION();
         std::unique_lock<std::mutex> lk(queue_mutex);
-        if (promises.size()) {
-            std::promise<int> promise = std::move(promises.front());
-            promises.pop();
+        // Regular requests are served first, low priority ones only when no regular request waits
+        auto& waiters = promises.size() ? promises : lowPriorityPromises;
+        if (waiters.size()) {
+            std::promise<int> promise = std::move(waiters.front());
+            waiters.pop();
+            notifyWaitersCountChanged();
             lk.unlock();
             promise.set_value(streamID);
             return;
@@ -104,6 +111,31 @@ public:
         }
     }
 
+    /**
+     * @brief Sets callback invoked with number of requests waiting for idle stream whenever it changes.
+     * Callback is called under queue lock only when request has to wait, so it does not affect
+     * the path where idle stream is available right away. Must be set before queue is used.
+     */
+    void setWaitersObserver(std::function<void(size_t)> observer) {
+        waitersObserver = std::move(observer);
+    }
+
+    /**
+     * @brief Number of requests currently waiting for idle stream, including low priority ones
+     */
+    size_t getWaitersCount() {
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        return promises.size() + lowPriorityPromises.size();
+    }
+
+    /**
+     * @brief Number of low priority requests currently waiting for idle stream
+     */
+    size_t getLowPriorityWaitersCount() {
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        return lowPriorityPromises.size();
+    }
+
     /**
      * @brief Give InferRequest
      */
@@ -112,6 +144,12 @@ public:
     }
 
 protected:
+    void notifyWaitersCountChanged() {
+        if (waitersObserver) {
+            waitersObserver(promises.size() + lowPriorityPromises.size());
+        }
+    }
+
     /**
     * @brief Vector representing circular buffer for infer queue
     */
@@ -137,5 +175,7 @@ protected:
      */
     std::vector<T> inferRequests;
     std::queue<std::promise<int>> promises;
+    std::queue<std::promise<int>> lowPriorityPromises;
+    std::function<void(size_t)> waitersObserver;
 };
 }  // namespace ovms
@@ -18,6 +18,8 @@
 #include <functional>
 #include <string>
 
+#include "alloc_tracker.hpp"
+#include "base64.hpp"
 #include "rest_utils.hpp"
 #include "tfs_frontend/tfs_utils.hpp"
 
@@ -271,10 +273,13 @@ Status TFSRestParser::parseColumnFormat(rapidjson::Value& node) {
 }
 
 Status TFSRestParser::parse(const char* json) {
+    AllocTrackingScope parseAllocScope(ALLOC_STAGE_REST_PARSE);
     rapidjson::Document doc;
     if (doc.Parse(json).HasParseError()) {
         return StatusCode::JSON_INVALID;
     }
+    parseAllocScope.stop();
+    AllocTrackingScope protoAllocScope(ALLOC_STAGE_PROTO_BUILD);
     if (!doc.IsObject()) {
         return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
     }
@@ -311,15 +316,6 @@ bool TFSRestParser::setDimOrValidate(tensorflow::TensorProto& proto, int dim, in
     }
 }
 
-bool getB64FromValue(const rapidjson::Value& value, std::string& b64Val) {
-    if (!isBinary(value)) {
-        return false;
-    }
-
-    b64Val = value["b64"].GetString();
-    return true;
-}
-
 template <typename T>
 bool addToTensorContent(tensorflow::TensorProto& proto, T value) {
     if (sizeof(T) != DataTypeSize(proto.dtype())) {
@@ -402,17 +398,13 @@ bool addToIntVal(tensorflow::TensorProto& proto, const rapidjson::Value& value)
 
 bool TFSRestParser::addValue(tensorflow::TensorProto& proto, const rapidjson::Value& value) {
     if (isBinary(value)) {
-        std::string b64Val;
-        if (!getB64FromValue(value, b64Val))
-            return false;
-        std::string decodedBytes;
-        if (decodeBase64(b64Val, decodedBytes) == StatusCode::OK) {
-            proto.add_string_val(decodedBytes.c_str(), decodedBytes.length());
-            proto.set_dtype(tensorflow::DataType::DT_STRING);
-            return true;
-        } else {
+        // Decoded straight into the proto, without intermediate copies of encoded or decoded data
+        const rapidjson::Value& b64Val = value["b64"];
+        if (decodeBase64(b64Val.GetString(), b64Val.GetStringLength(), *proto.add_string_val()) != StatusCode::OK) {
             return false;
         }
+        proto.set_dtype(tensorflow::DataType::DT_STRING);
+        return true;
     }
 
     if (!value.IsNumber()) {
@@ -662,11 +654,14 @@ Status KFSRestParser::parseInputs(rapidjson::Value& node) {
 }
 
 Status KFSRestParser::parse(const char* json) {
+    AllocTrackingScope parseAllocScope(ALLOC_STAGE_REST_PARSE);
     rapidjson::Document doc;
     if (doc.Parse(json).HasParseError()) {
         SPDLOG_DEBUG("Request parsing is not a valid JSON");
         return StatusCode::JSON_INVALID;
     }
+    parseAllocScope.stop();
+    AllocTrackingScope protoAllocScope(ALLOC_STAGE_PROTO_BUILD);
     if (!doc.IsObject()) {
         SPDLOG_DEBUG("Request body is not an object");
         return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
@@ -15,18 +15,22 @@
 //*****************************************************************************
 #include "rest_utils.hpp"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/prettywriter.h>
 #include <spdlog/spdlog.h>
 
-#include "absl/strings/escaping.h"
-
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
 #include "tensorflow_serving/util/json_tensor.h"
 #pragma GCC diagnostic pop
+#include "alloc_tracker.hpp"
+#include "base64.hpp"
 #include "precision.hpp"
 #include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
 #include "tfs_frontend/tfs_utils.hpp"
@@ -63,6 +67,7 @@ Status makeJsonFromPredictResponse(
     if (order == Order::UNKNOWN) {
         return StatusCode::REST_PREDICT_UNKNOWN_ORDER;
     }
+    AllocTrackingScope allocScope(ALLOC_STAGE_JSON_WRITE);
 
     Timer<TIMER_END> timer;
     using std::chrono::microseconds;
@@ -438,6 +443,7 @@ Status parseOutputs(const ::inference::ModelInferResponse& response_proto, rapid
 Status makeJsonFromPredictResponse(
     const ::inference::ModelInferResponse& response_proto,
     std::string* response_json) {
+    AllocTrackingScope allocScope(ALLOC_STAGE_JSON_WRITE);
     Timer<TIMER_END> timer;
     using std::chrono::microseconds;
     timer.start(CONVERT);
@@ -482,10 +488,76 @@ Status makeJsonFromPredictResponse(
 }
 
 Status decodeBase64(std::string& bytes, std::string& decodedBytes) {
-    auto status = Status(absl::Base64Unescape(bytes, &decodedBytes) ? StatusCode::OK : StatusCode::REST_BASE64_DECODE_ERROR);
+    return decodeBase64(bytes.data(), bytes.size(), decodedBytes);
+}
+
+namespace {
+Status addNumpyInput(const std::string& name, const NumpyArray& array, ::inference::ModelInferRequest& request) {
+    auto* input = request.add_inputs();
+    input->set_name(name);
+    input->set_datatype(ovmsPrecisionToKFSPrecision(array.precision));
+    for (const auto dim : array.shape) {
+        input->add_shape(dim);
+    }
+    request.add_raw_input_contents()->assign(array.data.data(), array.data.size());
+    return StatusCode::OK;
+}
+}  // namespace
+
+Status makeInferRequestFromNumpy(
+    const std::string& body,
+    NumpyFormat format,
+    const std::string& inputName,
+    ::inference::ModelInferRequest& request) {
+    AllocTrackingScope protoAllocScope(ALLOC_STAGE_PROTO_BUILD);
+    if (format == NumpyFormat::NPY) {
+        NumpyArray array;
+        auto status = parseNpy(body, array);
+        if (!status.ok()) {
+            return status;
+        }
+        return addNumpyInput(inputName, array, request);
+    }
+    numpy_arrays_t arrays;
+    auto status = parseNpz(body, arrays);
     if (!status.ok()) {
         return status;
     }
+    if (arrays.empty()) {
+        return Status(StatusCode::NUMPY_INVALID_FORMAT, "npz archive is empty");
+    }
+    for (const auto& [name, array] : arrays) {
+        addNumpyInput(name, array, request);
+    }
     return StatusCode::OK;
 }
+
+Status makeNumpyFromInferResponse(
+    const ::inference::ModelInferResponse& response_proto,
+    NumpyFormat format,
+    std::string* content) {
+    if (format == NumpyFormat::NPY && response_proto.outputs_size() != 1) {
+        return Status(StatusCode::NUMPY_INVALID_FORMAT, "response with multiple outputs requires " + NPZ_CONTENT_TYPE);
+    }
+    if (response_proto.raw_output_contents_size() != response_proto.outputs_size()) {
+        return StatusCode::REST_SERIALIZE_NO_DATA;
+    }
+    std::vector<std::pair<std::string, std::string>> npyContents;
+    npyContents.reserve(response_proto.outputs_size());
+    for (int i = 0; i < response_proto.outputs_size(); i++) {
+        const auto& output = response_proto.outputs(i);
+        shape_t shape(output.shape().begin(), output.shape().end());
+        std::string npy;
+        auto status = makeNpy(KFSPrecisionToOvmsPrecision(output.datatype()), shape, response_proto.raw_output_contents(i), npy);
+        if (!status.ok()) {
+            return Status(StatusCode::NUMPY_INVALID_FORMAT, "output " + output.name() + " of type " + output.datatype() + " can not be stored in npy");
+        }
+        if (format == NumpyFormat::NPY) {
+            *content = std::move(npy);
+            return StatusCode::OK;
+        }
+        npyContents.emplace_back(output.name(), std::move(npy));
+    }
+    return makeNpz(npyContents, *content);
+}
 }  // namespace ovms
@@ -22,10 +22,12 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 
+#include "numpy_utils.hpp"
 #include "rest_parser.hpp"
 #include "status.hpp"
 
 namespace inference {
+class ModelInferRequest;
 class ModelInferResponse;
 }  // namespace inference
 
@@ -41,4 +43,23 @@ Status makeJsonFromPredictResponse(
 
 Status decodeBase64(std::string& bytes, std::string& decodedBytes);
 
+/**
+ * @brief Creates KServe request from .npy or .npz body. Array data is placed in raw_input_contents,
+ * so inputs are wrapped by ov::Tensor without further conversion. Data type and shape come from array headers.
+ * Array of .npy body is fed to inputName, arrays of .npz body to inputs with the same names.
+ */
+Status makeInferRequestFromNumpy(
+    const std::string& body,
+    NumpyFormat format,
+    const std::string& inputName,
+    ::inference::ModelInferRequest& request);
+
+/**
+ * @brief Serializes outputs of KServe response into .npy (single output) or .npz content
+ */
+Status makeNumpyFromInferResponse(
+    const ::inference::ModelInferResponse& response_proto,
+    NumpyFormat format,
+    std::string* content);
+
 }  // namespace ovms
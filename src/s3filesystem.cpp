@@ -28,7 +28,9 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <map>
 #include <set>
+#include <streambuf>
 #include <string>
 #include <vector>
 
@@ -41,6 +43,7 @@
 #include <aws/s3/model/ListObjectsRequest.h>
 
 #include "logging.hpp"
+#include "model_archive.hpp"
 #include "stringutils.hpp"
 
 namespace ovms {
@@ -389,6 +392,89 @@ StatusCode S3FileSystem::readTextFile(const std::string& path, std::string* cont
     return StatusCode::OK;
 }
 
+namespace {
+/**
+ * @brief Passes response body to consumer as it arrives, instead of buffering whole object in memory
+ */
+class ChunkConsumerStreamBuf : public std::streambuf {
+    const file_chunk_consumer_t& consumer;
+    StatusCode status = StatusCode::OK;
+    uint64_t written = 0;
+
+public:
+    ChunkConsumerStreamBuf(const file_chunk_consumer_t& consumer) :
+        consumer(consumer) {}
+
+    StatusCode getStatus() const { return status; }
+    uint64_t getWritten() const { return written; }
+    void fail(StatusCode failure) { status = failure; }
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        if (status != StatusCode::OK) {
+            return 0;
+        }
+        status = consumer(data, size);
+        if (status != StatusCode::OK) {
+            return 0;
+        }
+        written += size;
+        return size;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+        const char c = traits_type::to_char_type(ch);
+        return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+    }
+};
+}  // namespace
+
+StatusCode S3FileSystem::readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) {
+    bool exists;
+    auto status = fileExists(path, &exists);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+
+    if (!exists) {
+        SPDLOG_LOGGER_ERROR(s3_logger, "File does not exist at {}", path);
+        return StatusCode::S3_FILE_NOT_FOUND;
+    }
+
+    std::string bucket, object;
+    status = parsePath(path, &bucket, &object);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+
+    ChunkConsumerStreamBuf streamBuf(consumer);
+    s3::Model::GetObjectRequest object_request;
+    object_request.SetBucket(bucket.c_str());
+    object_request.SetKey(object.c_str());
+    object_request.SetResponseStreamFactory([&streamBuf, &path]() {
+        // Retried request would pass already consumed part of the object again
+        if (streamBuf.getWritten() > 0) {
+            SPDLOG_LOGGER_ERROR(s3_logger, "Reading object at {} was interrupted", path);
+            streamBuf.fail(StatusCode::S3_FAILED_GET_OBJECT);
+        }
+        return Aws::New<Aws::IOStream>("S3FileSystem", &streamBuf);
+    });
+
+    auto get_object_outcome = client_.GetObject(object_request);
+    if (streamBuf.getStatus() != StatusCode::OK) {
+        return streamBuf.getStatus();
+    }
+    if (!get_object_outcome.IsSuccess()) {
+        SPDLOG_LOGGER_ERROR(s3_logger, "Failed to get object at {}", path);
+        return StatusCode::S3_FAILED_GET_OBJECT;
+    }
+    SPDLOG_LOGGER_TRACE(s3_logger, "Object {} has been read (bytes={})", path, streamBuf.getWritten());
+    return StatusCode::OK;
+}
+
 StatusCode S3FileSystem::downloadFileFolder(const std::string& path, const std::string& local_path) {
     bool exists;
     auto status = fileExists(path, &exists);
@@ -521,7 +607,15 @@ StatusCode S3FileSystem::downloadModelVersions(const std::string& path,
         return sc;
     }
 
+    std::map<model_version_t, std::string> archives;
+    auto archivesStatus = ModelVersionArchive::findVersionArchives(*this, path, archives);
+    if (archivesStatus != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(s3_logger, "Failed to list model version archives in {}", path);
+        return archivesStatus;
+    }
+
     StatusCode result = StatusCode::OK;
+    std::vector<ModelVersionArchive::Extraction> extractions;
     for (auto& ver : versions) {
         std::string versionpath = path;
         if (!endsWith(versionpath, "/")) {
@@ -534,6 +628,11 @@ StatusCode S3FileSystem::downloadModelVersions(const std::string& path,
         }
         lpath.append(std::to_string(ver));
         fs::create_directory(lpath);
+        auto archive = archives.find(ver);
+        if (archive != archives.end()) {
+            extractions.push_back({archive->second, lpath});
+            continue;
+        }
         auto status = downloadFileFolder(versionpath, lpath);
         if (status != StatusCode::OK) {
             result = status;
@@ -541,6 +640,12 @@ StatusCode S3FileSystem::downloadModelVersions(const std::string& path,
         }
     }
 
+    auto status = ModelVersionArchive::extractAll(*this, extractions);
+    if (status != StatusCode::OK) {
+        result = status;
+        SPDLOG_LOGGER_ERROR(s3_logger, "Failed to download model version archives from {}", path);
+    }
+
     return result;
 }
 
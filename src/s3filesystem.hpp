@@ -97,6 +97,15 @@ public:
      */
     StatusCode readTextFile(const std::string& path, std::string* contents) override;
 
+    /**
+     * @brief Read the content of the given file in consecutive chunks
+     * 
+     * @param path 
+     * @param consumer 
+     * @return StatusCode 
+     */
+    StatusCode readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) override;
+
     /**
      * @brief Download a remote directory
      * 
@@ -124,6 +133,10 @@ public:
      */
     StatusCode deleteFileFolder(const std::string& path) override;
 
+    bool supportsModelVersionArchives() const override {
+        return true;
+    }
+
     static const std::string S3_URL_PREFIX;
 
 private:
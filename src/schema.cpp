@@ -77,6 +77,10 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 						"layout": {
 							"type": ["object", "string"]
 						},
+						"color_format": {
+							"type": "object",
+							"additionalProperties": {"type": "string"}
+						},
 						"nireq": {
 							"type": "integer",
 							"minimum": 0
@@ -103,6 +107,33 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 							"type": "integer",
 							"minimum": 0
 						},
+						"overload_fallback": {
+							"type": "object",
+							"required": ["version", "queue_wait_threshold_ms"],
+							"properties": {
+								"version": {
+									"type": "integer",
+									"minimum": 1
+								},
+								"queue_wait_threshold_ms": {
+									"type": "number",
+									"minimum": 0,
+									"exclusiveMinimum": true
+								},
+								"recovery_threshold_ms": {
+									"type": "number",
+									"minimum": 0
+								},
+								"fraction": {
+									"type": "number",
+									"minimum": 0,
+									"exclusiveMinimum": true,
+									"maximum": 1,
+									"exclusiveMaximum": true
+								}
+							},
+							"additionalProperties": false
+						},
 						"custom_loader_options": {
 							"type": "object",
                                                         "required": ["loader_name"],
@@ -160,12 +191,17 @@ const char* MODELS_CONFIG_SCHEMA = R"({
     			{
         			"properties": { "type": { "enum": ["custom"] } },
         			"required": ["library_name"],
-					"not": { "required": ["model_name"] }
+					"not": { "anyOf": [{ "required": ["model_name"] }, { "required": ["condition"] }] }
     			},
     			{
         			"properties": { "type": { "enum": ["DL model"] } },
-        			"not": { "required": ["library_name"] },
+        			"not": { "anyOf": [{ "required": ["library_name"] }, { "required": ["condition"] }] },
 					"required": ["model_name"]
+    			},
+    			{
+        			"properties": { "type": { "enum": ["condition"] } },
+        			"not": { "anyOf": [{ "required": ["model_name"] }, { "required": ["library_name"] }] },
+					"required": ["condition"]
     			}
   			],
 			"properties": {
@@ -180,7 +216,7 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 				},
 				"type": {
 					"type": "string",
-					"enum": ["DL model", "custom"]
+					"enum": ["DL model", "custom", "condition"]
 				},
 				"version": {
 					"type": "integer",
@@ -209,6 +245,30 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 				},
 				"gather_from_node": {
 					"type": "string"
+				},
+				"condition": {
+					"$ref": "#/definitions/node_condition"
+				}
+			},
+			"additionalProperties": false
+		},
+		"node_condition": {
+			"type": "object",
+			"required": ["input", "reduce", "operator", "threshold"],
+			"properties": {
+				"input": {
+					"type": "string"
+				},
+				"reduce": {
+					"type": "string",
+					"enum": ["count", "min", "max", "sum"]
+				},
+				"operator": {
+					"type": "string",
+					"enum": [">", ">=", "<", "<=", "==", "!="]
+				},
+				"threshold": {
+					"type": "number"
 				}
 			},
 			"additionalProperties": false
@@ -258,6 +318,28 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 				}
 			},
 			"additionalProperties": false
+		},
+		"tenant_quota": {
+			"type": "object",
+			"required": ["name"],
+			"properties": {
+				"name": {
+					"type": "string"
+				},
+				"rate_limit": {
+					"type": "number",
+					"minimum": 0
+				},
+				"burst": {
+					"type": "number",
+					"minimum": 0
+				},
+				"max_concurrency": {
+					"type": "integer",
+					"minimum": 0
+				}
+			},
+			"additionalProperties": false
 		}
 	},
 	"type": "object",
@@ -287,6 +369,12 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 				"$ref": "#/definitions/custom_node_library_config"
 			}
 		},
+		"tenant_quotas": {
+			"type": "array",
+			"items": {
+				"$ref": "#/definitions/tenant_quota"
+			}
+		},
 		"monitoring": {
 			"type": "object",
 			"required": ["metrics"],
@@ -298,6 +386,11 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 						"enable": {
 							"type": "boolean"
 						},
+						"scrape_interval_ms": {
+							"type": "integer",
+							"minimum": 0,
+							"maximum": 3600000
+						},
 						"metrics_list": {
 							"type": "array",
 							"items": {
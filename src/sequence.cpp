@@ -21,6 +21,12 @@ using namespace InferenceEngine;
 
 namespace ovms {
 
+Sequence::~Sequence() {
+    if (totalMemoryStateBytes) {
+        *totalMemoryStateBytes -= memoryStateBytes;
+    }
+}
+
 const uint64_t Sequence::getId() const {
     return sequenceId;
 }
@@ -29,6 +35,10 @@ const sequence_memory_state_t& Sequence::getMemoryState() const {
     return memoryState;
 }
 
+uint64_t Sequence::getMemoryStateBytes() const {
+    return memoryStateBytes;
+}
+
 const bool Sequence::isIdle() const {
     return idle;
 }
@@ -48,6 +58,15 @@ Status Sequence::updateMemoryState(model_memory_state_t& newState) {
         }
         memoryState[stateName] = copyTensor;
     }
+    uint64_t newMemoryStateBytes = 0;
+    for (const auto& [stateName, tensor] : memoryState) {
+        newMemoryStateBytes += tensor.get_byte_size();
+    }
+    if (totalMemoryStateBytes) {
+        *totalMemoryStateBytes += newMemoryStateBytes;
+        *totalMemoryStateBytes -= memoryStateBytes;
+    }
+    memoryStateBytes = newMemoryStateBytes;
     setIdle(false);
     return StatusCode::OK;
 }
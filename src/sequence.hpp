@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -37,16 +38,24 @@ class Sequence {
 private:
     uint64_t sequenceId;
     sequence_memory_state_t memoryState;
+    uint64_t memoryStateBytes = 0;
+    std::atomic<uint64_t>* totalMemoryStateBytes;
     std::mutex mutex;
     bool terminated;
     bool idle;
 
 public:
-    Sequence(uint64_t sequenceId) :
+    /**
+     * @brief Size of memory state is added to totalMemoryStateBytes counter, if provided, for the sequence lifetime
+     */
+    Sequence(uint64_t sequenceId, std::atomic<uint64_t>* totalMemoryStateBytes = nullptr) :
         sequenceId(sequenceId),
+        totalMemoryStateBytes(totalMemoryStateBytes),
         terminated(false),
         idle(false) {}
+    ~Sequence();
     const sequence_memory_state_t& getMemoryState() const;
+    uint64_t getMemoryStateBytes() const;
     const uint64_t getId() const;
     const bool isIdle() const;
     void setIdle(bool idle = true);
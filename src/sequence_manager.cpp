@@ -16,6 +16,7 @@
 
 #include "sequence_manager.hpp"
 
+#include <tuple>
 #include <utility>
 
 #include "logging.hpp"
@@ -53,6 +54,7 @@ bool SequenceManager::sequenceExists(const uint64_t sequenceId) const {
 
 Status SequenceManager::removeIdleSequences() {
     std::unique_lock<std::mutex> sequenceManagerLock(mutex);
+    size_t sequencesCount = sequences.size();
     for (auto it = sequences.begin(); it != sequences.end();) {
         Sequence& sequence = it->second;
         // Non blocking try to get mutex
@@ -70,6 +72,9 @@ Status SequenceManager::removeIdleSequences() {
         }
         ++it;
     }
+    if (sequences.size() != sequencesCount) {
+        notifyMemoryStateChanged();
+    }
 
     return StatusCode::OK;
 }
@@ -95,7 +100,7 @@ Status SequenceManager::createSequence(SequenceProcessingSpec& sequenceProcessin
     if (sequenceId == 0) {
         uint64_t uniqueSequenceId = getUniqueSequenceId();
         SPDLOG_LOGGER_DEBUG(sequence_manager_logger, "Model {} version {} Adding new sequence with ID: {}", modelName, modelVersion, uniqueSequenceId);
-        sequences.emplace(uniqueSequenceId, uniqueSequenceId);
+        sequences.emplace(std::piecewise_construct, std::forward_as_tuple(uniqueSequenceId), std::forward_as_tuple(uniqueSequenceId, &memoryStateBytes));
         sequenceProcessingSpec.setSequenceId(uniqueSequenceId);
         return StatusCode::OK;
     }
@@ -109,7 +114,7 @@ Status SequenceManager::createSequence(SequenceProcessingSpec& sequenceProcessin
         return StatusCode::SEQUENCE_ALREADY_EXISTS;
     } else {
         SPDLOG_LOGGER_DEBUG(sequence_manager_logger, "Model {} version {} Adding new sequence with ID: {}", modelName, modelVersion, sequenceId);
-        sequences.emplace(sequenceId, sequenceId);
+        sequences.emplace(std::piecewise_construct, std::forward_as_tuple(sequenceId), std::forward_as_tuple(sequenceId, &memoryStateBytes));
     }
     return StatusCode::OK;
 }
@@ -132,6 +137,7 @@ Status SequenceManager::removeSequence(const uint64_t sequenceId) {
     if (it != sequences.end()) {
         SPDLOG_LOGGER_DEBUG(sequence_manager_logger, "Model {} versions {} Removing sequence with ID: {}", modelName, modelVersion, sequenceId);
         sequences.erase(it);
+        notifyMemoryStateChanged();
     } else {
         SPDLOG_LOGGER_DEBUG(sequence_manager_logger, "Model {} version {} Sequence with provided ID does not exists", modelName, modelVersion);
         return StatusCode::SEQUENCE_MISSING;
@@ -139,6 +145,16 @@ Status SequenceManager::removeSequence(const uint64_t sequenceId) {
     return StatusCode::OK;
 }
 
+void SequenceManager::setMemoryStateObserver(std::function<void(uint64_t)> observer) {
+    this->memoryStateObserver = std::move(observer);
+}
+
+void SequenceManager::notifyMemoryStateChanged() {
+    if (this->memoryStateObserver) {
+        this->memoryStateObserver(getMemoryStateBytes());
+    }
+}
+
 Status SequenceManager::processRequestedSpec(SequenceProcessingSpec& sequenceProcessingSpec) {
     const uint32_t sequenceControlInput = sequenceProcessingSpec.getSequenceControlInput();
     const uint64_t sequenceId = sequenceProcessingSpec.getSequenceId();
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -38,6 +40,9 @@ private:
     std::string modelName;
     model_version_t modelVersion;
     std::mutex mutex;
+    // Declared before sequences, since those decrease it on destruction
+    std::atomic<uint64_t> memoryStateBytes{0};
+    std::function<void(uint64_t)> memoryStateObserver;
 
 protected:
     std::unordered_map<uint64_t, Sequence> sequences;
@@ -79,5 +84,18 @@ public:
     Status removeIdleSequences();
 
     Status processRequestedSpec(SequenceProcessingSpec& sequenceProcessingSpec);
+
+    /**
+     * @brief Total size of memory state tensors saved by all sequences
+     */
+    uint64_t getMemoryStateBytes() const {
+        return memoryStateBytes.load();
+    }
+
+    /**
+     * @brief Observer is called with total memory state size whenever sequences are updated or removed
+     */
+    void setMemoryStateObserver(std::function<void(uint64_t)> observer);
+    void notifyMemoryStateChanged();
 };
 }  // namespace ovms
@@ -35,6 +35,8 @@
 #include <unistd.h>
 
 #include "config.hpp"
+#include "cpu_topology.hpp"
+#include "deserialization_thread_pool.hpp"
 #include "grpcservermodule.hpp"
 #include "http_server.hpp"
 #include "httpservermodule.hpp"
@@ -44,6 +46,7 @@
 #include "model_service.hpp"
 #include "modelmanager.hpp"
 #include "prediction_service.hpp"
+#include "prefork_supervisor.hpp"
 #include "profiler.hpp"
 #include "servablemanagermodule.hpp"
 #include "stringutils.hpp"
@@ -95,6 +98,12 @@ void logConfig(const Config& config) {
     SPDLOG_DEBUG("REST workers: {}", config.restWorkers());
     SPDLOG_DEBUG("gRPC workers: {}", config.grpcWorkers());
     SPDLOG_DEBUG("gRPC channel arguments: {}", config.grpcChannelArguments());
+    SPDLOG_DEBUG("frontend CPU cores: {}", config.frontendCpuCores());
+    SPDLOG_DEBUG("inference CPU cores: {}", config.inferenceCpuCores());
+    SPDLOG_DEBUG("tenant header: {}", config.tenantHeader());
+    SPDLOG_DEBUG("tenant rate limit: {}", config.tenantRateLimit());
+    SPDLOG_DEBUG("tenant burst: {}", config.tenantBurst());
+    SPDLOG_DEBUG("tenant max concurrency: {}", config.tenantMaxConcurrency());
     SPDLOG_DEBUG("log level: {}", config.logLevel());
     SPDLOG_DEBUG("log path: {}", config.logPath());
     SPDLOG_DEBUG("file system poll wait seconds: {}", config.filesystemPollWaitSeconds());
@@ -265,6 +274,27 @@ int Server::startModules(ovms::Config& config) {
     auto retCode = EXIT_SUCCESS;
     bool inserted = false;
     auto it = modules.end();
+    auto& topology = CpuTopology::instance();
+    auto status = topology.configure(config.frontendCpuCores(), config.inferenceCpuCores());
+    if (!status.ok()) {
+        SPDLOG_ERROR("Invalid CPU cores configuration: {}", status.string());
+        return EXIT_FAILURE;
+    }
+    // Main thread mask is what OpenVINO CPU plugin treats as process mask when pinning streams.
+    // Model loading threads are spawned from main thread as well, so they inherit it.
+    // gRPC & REST modules temporarily switch to frontend cores while spawning their threads.
+    if (!topology.getInferenceCores().empty()) {
+        status = CpuTopology::setCurrentThreadAffinity(topology.getInferenceCores());
+        if (!status.ok()) {
+            return EXIT_FAILURE;
+        }
+        SPDLOG_INFO("Inference threads pinned to cores: {}", CpuTopology::toString(topology.getInferenceCores()));
+    }
+    {
+        // Deserialization is a part of request processing, so workers share frontend cores
+        ThreadAffinityGuard affinityGuard(topology.getFrontendCores());
+        DeserializationThreadPool::instance().start(config.deserializationThreads(), config.deserializationParallelThreshold());
+    }
 #if MTR_ENABLED
     INSERT_MODULE(PROFILER_MODULE_NAME, it);
     START_MODULE(it);
@@ -312,6 +342,7 @@ void Server::shutdownModules() {
     // first we should stop incoming new requests
     ensureModuleShutdown(GRPC_SERVER_MODULE_NAME);
     ensureModuleShutdown(HTTP_SERVER_MODULE_NAME);
+    DeserializationThreadPool::instance().stop();
     ensureModuleShutdown(SERVABLE_MANAGER_MODULE_NAME);
     ensureModuleShutdown(PROFILER_MODULE_NAME);
     // we need to be able to quickly start grpc or start it without port
@@ -326,10 +357,26 @@ int Server::start(int argc, char** argv) {
         auto& config = ovms::Config::instance().parse(argc, argv);
         configure_logger(config.logLevel(), config.logPath());
         logConfig(config);
+        // Supervisor forks workers before any server thread is started
+        std::unique_ptr<PreforkSupervisor> supervisor;
+        if (config.workerProcesses() > 1) {
+            if (!isPortAvailable(config.port()) || (config.restPort() != 0 && !isPortAvailable(config.restPort()))) {
+                SPDLOG_ERROR("Ports required by worker processes are already in use");
+                return EXIT_FAILURE;
+            }
+            supervisor = std::make_unique<PreforkSupervisor>(config.workerProcesses(), []() { return shutdown_request != 0; });
+            if (supervisor->run() == PreforkRole::SUPERVISOR) {
+                return supervisor->getExitCode();
+            }
+            SPDLOG_INFO("Worker process {} starting with pid {}", supervisor->getWorkerIndex().value(), getpid());
+        }
         ModulesShutdownGuard shutdownGuard(*this);
         auto retCode = this->startModules(config);
         if (retCode)
             return retCode;
+        if (supervisor) {
+            supervisor->notifyReady();
+        }
 
         while (!shutdown_request) {
             std::this_thread::sleep_for(std::chrono::milliseconds(200));
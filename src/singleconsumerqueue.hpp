@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace ovms {
+
+/**
+ * @brief Lock-free queue with many producers and a single consumer.
+ * Producers push onto an atomic stack. Consumer takes the whole stack at once and pulls
+ * elements from this batch in push order without touching shared state.
+ * Mutex and condition variable are used only when the consumer parks on an empty queue;
+ * then only the first producer pushing afterwards wakes it up.
+ * tryPull() and empty() may be called only from one thread at a time.
+ */
+template <typename T>
+class SingleConsumerQueue {
+    struct Element {
+        T value;
+        Element* next;
+    };
+
+public:
+    SingleConsumerQueue() {}
+    SingleConsumerQueue(const SingleConsumerQueue&) = delete;
+    SingleConsumerQueue& operator=(const SingleConsumerQueue&) = delete;
+    ~SingleConsumerQueue() {
+        release(batch);
+        release(head.load());
+    }
+
+    void push(const T& element) {
+        pushElement(new Element{element, nullptr});
+    }
+
+    void push(T&& element) {
+        pushElement(new Element{std::move(element), nullptr});
+    }
+
+    std::optional<T> tryPull(const uint waitDurationMicroseconds) {
+        if (batch == nullptr) {
+            takeBatch();
+        }
+        if (batch == nullptr) {
+            park(waitDurationMicroseconds);
+            takeBatch();
+            if (batch == nullptr) {
+                return std::nullopt;
+            }
+        }
+        Element* element = batch;
+        batch = element->next;
+        std::optional<T> result{std::move(element->value)};
+        delete element;
+        return result;
+    }
+
+    bool empty() const {
+        return batch == nullptr && head.load() == nullptr;
+    }
+
+private:
+    void pushElement(Element* element) {
+        element->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(element->next, element)) {
+        }
+        // Sequentially consistent push and parked flag check pair with the consumer
+        // setting the flag before checking the stack, so the wake up cannot be lost
+        if (consumerParked.load() && consumerParked.exchange(false)) {
+            std::lock_guard<std::mutex> lock(parkingMtx);
+            parkingSignal.notify_one();
+        }
+    }
+
+    void takeBatch() {
+        Element* stack = head.exchange(nullptr);
+        // Reverse stack to restore push order
+        while (stack != nullptr) {
+            Element* next = stack->next;
+            stack->next = batch;
+            batch = stack;
+            stack = next;
+        }
+    }
+
+    void park(const uint waitDurationMicroseconds) {
+        std::unique_lock<std::mutex> lock(parkingMtx);
+        consumerParked.store(true);
+        parkingSignal.wait_for(lock,
+            std::chrono::microseconds(waitDurationMicroseconds),
+            [this]() { return head.load() != nullptr; });
+        consumerParked.store(false);
+    }
+
+    static void release(Element* element) {
+        while (element != nullptr) {
+            Element* next = element->next;
+            delete element;
+            element = next;
+        }
+    }
+
+    std::atomic<Element*> head{nullptr};
+    // Elements taken by the consumer, accessed only by the consumer thread
+    Element* batch = nullptr;
+    std::atomic<bool> consumerParked{false};
+    std::mutex parkingMtx;
+    std::condition_variable parkingSignal;
+};
+}  // namespace ovms
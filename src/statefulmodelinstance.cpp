@@ -117,20 +117,34 @@ void StatefulModelInstance::retireModel(bool isPermanent) {
     }
     ModelInstance::retireModel(isPermanent);
     sequenceManager.reset();
+    SET_IF_ENABLED(this->getMetricReporter().memorySequences, 0);
 }
 
 void StatefulModelInstance::cleanupFailedLoad() {
     std::lock_guard<std::recursive_mutex> loadingLock(loadingMutex);
     ModelInstance::cleanupFailedLoad();
     sequenceManager.reset();
+    SET_IF_ENABLED(this->getMetricReporter().memorySequences, 0);
 }
 
 Status StatefulModelInstance::loadModelImpl(const ModelConfig& config, const DynamicModelParameter& parameter) {
     performLowLatencyTransformation = config.isLowLatencyTransformationUsed();
     sequenceManager = std::make_shared<SequenceManager>(config.getMaxSequenceNumber(), config.getName(), config.getVersion());
+    observeSequencesMemory();
     return ModelInstance::loadModelImpl(config, parameter);
 }
 
+void StatefulModelInstance::observeSequencesMemory() {
+    MetricGauge* memorySequences = this->getMetricReporter().memorySequences.get();
+    if (!memorySequences) {
+        return;
+    }
+    memorySequences->set(0);
+    sequenceManager->setMemoryStateObserver([memorySequences](uint64_t bytes) {
+        memorySequences->set(bytes);
+    });
+}
+
 Status StatefulModelInstance::loadOVCompiledModel(const ModelConfig& config) {
     if (performLowLatencyTransformation) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "[Model: {} version: {}] Performing Low Latency Transformation on the model", getName(), getVersion());
@@ -234,6 +248,7 @@ Status StatefulModelInstance::infer(const tensorflow::serving::PredictRequest* r
     timer.stop(GET_INFER_REQUEST);
     double getInferRequestTime = timer.elapsed<microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    this->getInferRequestWaitEstimator().observe(getInferRequestTime / 1000);
     SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
         requestProto->model_spec().name(), getVersion(), executingInferId, getInferRequestTime / 1000);
 
@@ -269,6 +284,8 @@ Status StatefulModelInstance::infer(const tensorflow::serving::PredictRequest* r
     timer.stop(SERIALIZE);
     if (!status.ok())
         return status;
+    responseProto->mutable_model_spec()->set_name(getName());
+    responseProto->mutable_model_spec()->mutable_version()->set_value(getVersion());
     SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         requestProto->model_spec().name(), getVersion(), executingInferId, timer.elapsed<microseconds>(SERIALIZE) / 1000);
 
@@ -322,6 +339,7 @@ const Status StatefulModelInstance::postInferenceProcessing(tensorflow::serving:
     } else {
         auto modelState = inferRequest.query_state();
         sequence.updateMemoryState(modelState);
+        sequenceManager->notifyMemoryStateChanged();
     }
 
     // Include sequence_id in server response
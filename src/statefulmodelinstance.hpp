@@ -40,6 +40,7 @@ public:
         ModelInstance(name, version, ieCore, registry, metricsConfig),
         globalSequencesViewer(globalSequencesViewer) {
         sequenceManager = std::make_shared<SequenceManager>(config.getMaxSequenceNumber(), name, version);
+        observeSequencesMemory();
     }
 
     const std::shared_ptr<SequenceManager>& getSequenceManager() const {
@@ -97,6 +98,8 @@ protected:
 
     Status loadOVCompiledModel(const ModelConfig& config) override;
 
+    void observeSequencesMemory();
+
 private:
     template <typename RequestType>
     const Status validateSpecialKeys(const RequestType* request, SequenceProcessingSpec& sequenceProcessingSpec);
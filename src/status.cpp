@@ -33,6 +33,9 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::MODELINSTANCE_NOT_FOUND, "ModelInstance not found"},
     {StatusCode::SHAPE_WRONG_FORMAT, "The provided shape is in wrong format"},
     {StatusCode::LAYOUT_WRONG_FORMAT, "The provided layout is in wrong format"},
+    {StatusCode::COLOR_FORMAT_WRONG_FORMAT, "The provided color format is in wrong format"},
+    {StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT, "The provided overload fallback is in wrong format"},
+    {StatusCode::OVERLOAD_FALLBACK_STATEFUL_MODEL, "Overload fallback is not supported for stateful models"},
     {StatusCode::DIM_WRONG_FORMAT, "The provided dimension is in wrong format"},
     {StatusCode::PLUGIN_CONFIG_WRONG_FORMAT, "Plugin config is in wrong format"},
     {StatusCode::MODEL_VERSION_POLICY_WRONG_FORMAT, "Model version policy is in wrong format"},
@@ -60,6 +63,8 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::INVALID_SIGNATURE_DEF, "Invalid signature name"},
     {StatusCode::CONFIG_SHAPE_IS_NOT_IN_MODEL, "Shape from config not found in model"},
     {StatusCode::CONFIG_LAYOUT_IS_NOT_IN_MODEL, "Layout from config not found in model"},
+    {StatusCode::CONFIG_COLOR_FORMAT_IS_NOT_IN_MODEL, "Color format from config not found in model"},
+    {StatusCode::CONFIG_COLOR_FORMAT_LAYOUT_UNKNOWN, "Cannot determine layout of input with color format, layout parameter is required"},
     {StatusCode::CONFIG_SHAPE_MAPPED_BUT_USED_REAL_NAME, "Shape from config has real name. Use mapped name instead"},
     {StatusCode::CONFIG_LAYOUT_MAPPED_BUT_USED_REAL_NAME, "Layout from config has real name. Use mapped name instead"},
     {StatusCode::INVALID_NIREQ, "Nireq parameter too high"},
@@ -184,6 +189,12 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_GATHER_NODES_ORDER, "Demultiplexer and gather nodes are not in LIFO order"},
     {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, "Pipeline execution aborted due to no content from custom node"},
     {StatusCode::PIPELINE_INPUTS_AMBIGUOUS_METADATA, "Multiple nodes connected to the same pipeline input require different tensor metadata"},
+    {StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED, "Failed to send partial pipeline result to the client"},
+    {StatusCode::PIPELINE_CONDITION_WRONG_FORMAT, "Condition node predicate has invalid format"},
+    {StatusCode::PIPELINE_CONDITION_INPUT_MISSING, "Condition node predicate refers to input which is not connected"},
+    {StatusCode::PIPELINE_CONDITION_OUTPUT_NOT_INPUT, "Condition node output has to be one of its inputs"},
+    {StatusCode::PIPELINE_CONDITION_SKIPPED_NODE_DEMULTIPLEXING, "Nodes skipped by condition node cannot demultiply or gather"},
+    {StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION, "Unsupported precision of condition node predicate input"},
 
     // Storage errors
     // S3
@@ -220,6 +231,9 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::AS_FAILED_GET_OBJECT, "AS Failed to get object from path"},
     {StatusCode::AS_INCORRECT_REQUESTED_OBJECT_TYPE, "AS invalid object type in path"},
 
+    // Model version archives
+    {StatusCode::MODEL_VERSION_ARCHIVE_INVALID, "Model version archive is invalid"},
+
     // Custom Loader
     {StatusCode::CUSTOM_LOADER_LIBRARY_INVALID, "Custom Loader library not found or cannot open"},
     {StatusCode::CUSTOM_LOADER_LIBRARY_LOAD_FAILED, "Cannot load the custom library"},
@@ -259,6 +273,30 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::INVALID_METRICS_ENDPOINT, "Metrics config endpoint path is invalid"},
     {StatusCode::INVALID_METRICS_FAMILY_NAME, "Invalid name in metrics_list"},
     {StatusCode::METRICS_REST_PORT_MISSING, "Missing rest_port parameter in server CLI"},
+
+    // CPU topology
+    {StatusCode::CPU_LIST_WRONG_FORMAT, "Core list has invalid format"},
+    {StatusCode::CPU_AFFINITY_SETTING_FAILED, "Failed to get or set thread affinity"},
+
+    // Tenant isolation
+    {StatusCode::TENANT_QUOTA_EXCEEDED, "Tenant quota exceeded"},
+    {StatusCode::TENANT_QUOTA_WRONG_FORMAT, "Tenant quota has invalid format"},
+
+    // Model profiling
+    {StatusCode::PROFILING_INVALID_REQUEST, "Invalid profiling request"},
+
+    // Streamed upload
+    {StatusCode::STREAMED_UPLOAD_HEADER_MISSING, "First message of streamed upload must carry request header"},
+    {StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, "Streamed upload chunk does not match request header"},
+    {StatusCode::STREAMED_UPLOAD_INCOMPLETE, "Streamed upload finished before all declared input data was received"},
+    {StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED, "Declared size of inputs exceeds streamed upload limit"},
+    {StatusCode::STREAMED_UPLOAD_ALLOCATION_FAILED, "Could not allocate buffer for streamed upload data"},
+
+    // Batch jobs
+    {StatusCode::BATCH_JOB_INVALID_REQUEST, "Invalid batch job request"},
+    {StatusCode::BATCH_JOB_NOT_FOUND, "Batch job not found"},
+    {StatusCode::BATCH_JOB_LIMIT_REACHED, "Too many batch jobs queued"},
+    {StatusCode::NUMPY_INVALID_FORMAT, "Invalid or unsupported NumPy array format"},
 };
 
 const std::unordered_map<const StatusCode, grpc::StatusCode> Status::grpcStatusMap = {
@@ -287,6 +325,8 @@ const std::unordered_map<const StatusCode, grpc::StatusCode> Status::grpcStatusM
     {StatusCode::MODEL_VERSION_INVALID_FORMAT, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::INVALID_SIGNATURE_DEF, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, grpc::StatusCode::ABORTED},
+    {StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED, grpc::StatusCode::CANCELLED},
+    {StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE, grpc::StatusCode::FAILED_PRECONDITION},
 
     // Sequence management
@@ -300,6 +340,25 @@ const std::unordered_map<const StatusCode, grpc::StatusCode> Status::grpcStatusM
     {StatusCode::SPECIAL_INPUT_NO_TENSOR_SHAPE, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, grpc::StatusCode::UNAVAILABLE},
 
+    // Tenant isolation
+    {StatusCode::TENANT_QUOTA_EXCEEDED, grpc::StatusCode::RESOURCE_EXHAUSTED},
+
+    // Model profiling
+    {StatusCode::PROFILING_INVALID_REQUEST, grpc::StatusCode::INVALID_ARGUMENT},
+
+    // Streamed upload
+    {StatusCode::STREAMED_UPLOAD_HEADER_MISSING, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::STREAMED_UPLOAD_INCOMPLETE, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED, grpc::StatusCode::RESOURCE_EXHAUSTED},
+    {StatusCode::STREAMED_UPLOAD_ALLOCATION_FAILED, grpc::StatusCode::RESOURCE_EXHAUSTED},
+
+    // Batch jobs
+    {StatusCode::BATCH_JOB_INVALID_REQUEST, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::BATCH_JOB_NOT_FOUND, grpc::StatusCode::NOT_FOUND},
+    {StatusCode::BATCH_JOB_LIMIT_REACHED, grpc::StatusCode::RESOURCE_EXHAUSTED},
+    {StatusCode::NUMPY_INVALID_FORMAT, grpc::StatusCode::INVALID_ARGUMENT},
+
     // Predict request validation
     {StatusCode::INVALID_NO_OF_INPUTS, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::INVALID_MISSING_INPUT, grpc::StatusCode::INVALID_ARGUMENT},
@@ -388,6 +447,7 @@ const std::unordered_map<const StatusCode, net_http::HTTPStatusCode> Status::htt
     {StatusCode::MODEL_SPEC_MISSING, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::INVALID_SIGNATURE_DEF, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, net_http::HTTPStatusCode::NO_CONTENT},
+    {StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE, net_http::HTTPStatusCode::PRECOND_FAILED},
 
     // Sequence management
@@ -401,6 +461,25 @@ const std::unordered_map<const StatusCode, net_http::HTTPStatusCode> Status::htt
     {StatusCode::SPECIAL_INPUT_NO_TENSOR_SHAPE, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, net_http::HTTPStatusCode::SERVICE_UNAV},
 
+    // Tenant isolation
+    {StatusCode::TENANT_QUOTA_EXCEEDED, net_http::HTTPStatusCode::SERVICE_UNAV},
+
+    // Model profiling
+    {StatusCode::PROFILING_INVALID_REQUEST, net_http::HTTPStatusCode::BAD_REQUEST},
+
+    // Streamed upload
+    {StatusCode::STREAMED_UPLOAD_HEADER_MISSING, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::STREAMED_UPLOAD_INVALID_CHUNK, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::STREAMED_UPLOAD_INCOMPLETE, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::STREAMED_UPLOAD_ALLOCATION_FAILED, net_http::HTTPStatusCode::SERVICE_UNAV},
+
+    // Batch jobs
+    {StatusCode::BATCH_JOB_INVALID_REQUEST, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::BATCH_JOB_NOT_FOUND, net_http::HTTPStatusCode::NOT_FOUND},
+    {StatusCode::BATCH_JOB_LIMIT_REACHED, net_http::HTTPStatusCode::SERVICE_UNAV},
+    {StatusCode::NUMPY_INVALID_FORMAT, net_http::HTTPStatusCode::BAD_REQUEST},
+
     // Predict request validation
     {StatusCode::INVALID_NO_OF_INPUTS, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::INVALID_MISSING_INPUT, net_http::HTTPStatusCode::BAD_REQUEST},
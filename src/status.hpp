@@ -45,6 +45,9 @@ enum class StatusCode {
     MODELINSTANCE_NOT_FOUND,
     SHAPE_WRONG_FORMAT,                   /*!< The provided shape param is in wrong format */
     LAYOUT_WRONG_FORMAT,                  /*!< The provided layout param is in wrong format */
+    COLOR_FORMAT_WRONG_FORMAT,            /*!< The provided color format param is in wrong format */
+    OVERLOAD_FALLBACK_WRONG_FORMAT,       /*!< The provided overload fallback param is in wrong format */
+    OVERLOAD_FALLBACK_STATEFUL_MODEL,     /*!< Overload fallback param used for stateful model */
     DIM_WRONG_FORMAT,                     /*!< The provided dimension param is in wrong format */
     PLUGIN_CONFIG_WRONG_FORMAT,           /*!< Plugin config is in wrong format */
     MODEL_VERSION_POLICY_WRONG_FORMAT,    /*!< Model version policy is in wrong format */
@@ -60,6 +63,8 @@ enum class StatusCode {
     ANONYMOUS_FIXED_LAYOUT_NOT_ALLOWED,   /*!< Anonymous fixed layout is invalid for models with multiple inputs */
     CONFIG_SHAPE_IS_NOT_IN_MODEL,
     CONFIG_LAYOUT_IS_NOT_IN_MODEL,
+    CONFIG_COLOR_FORMAT_IS_NOT_IN_MODEL,
+    CONFIG_COLOR_FORMAT_LAYOUT_UNKNOWN,      /*!< Layout of input with color format is neither configured, set in model nor deducible from shape */
     CONFIG_SHAPE_MAPPED_BUT_USED_REAL_NAME,  /*!< Using old name of input/output in config shape when mapped in mapping_config.json*/
     CONFIG_LAYOUT_MAPPED_BUT_USED_REAL_NAME, /*!< Using old name of input/output in config layout when mapped in mapping_config.json*/
     CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE,
@@ -166,6 +171,9 @@ enum class StatusCode {
     AS_FAILED_GET_OBJECT,
     AS_INCORRECT_REQUESTED_OBJECT_TYPE,
 
+    // Model version archives
+    MODEL_VERSION_ARCHIVE_INVALID, /*!< Compressed model version archive is corrupted or has forbidden entries */
+
     // REST handler
     REST_NOT_FOUND,                  /*!< Requested REST resource not found */
     REST_COULD_NOT_PARSE_VERSION,    /*!< Could not parse model version in request */
@@ -238,6 +246,12 @@ enum class StatusCode {
     PIPELINE_WRONG_DEMULTIPLEXER_GATHER_NODES_ORDER,
     PIPELINE_DEMULTIPLEXER_NO_RESULTS,
     PIPELINE_INPUTS_AMBIGUOUS_METADATA,
+    PIPELINE_PARTIAL_RESULT_SEND_FAILED,
+    PIPELINE_CONDITION_WRONG_FORMAT,
+    PIPELINE_CONDITION_INPUT_MISSING,
+    PIPELINE_CONDITION_OUTPUT_NOT_INPUT,
+    PIPELINE_CONDITION_SKIPPED_NODE_DEMULTIPLEXING,
+    PIPELINE_CONDITION_UNSUPPORTED_PRECISION,
 
     // Custom Loader
     CUSTOM_LOADER_LIBRARY_INVALID,
@@ -280,6 +294,30 @@ enum class StatusCode {
     INVALID_METRICS_FAMILY_NAME,
     METRICS_REST_PORT_MISSING,
 
+    // CPU topology
+    CPU_LIST_WRONG_FORMAT,       /*!< Core list is not in cpuset format (eg. 0-3,8) */
+    CPU_AFFINITY_SETTING_FAILED, /*!< Could not get or set thread affinity */
+
+    // Tenant isolation
+    TENANT_QUOTA_EXCEEDED,     /*!< Tenant exceeded rate limit or concurrency quota */
+    TENANT_QUOTA_WRONG_FORMAT, /*!< Tenant quota in configuration file has invalid format */
+
+    // Model profiling
+    PROFILING_INVALID_REQUEST, /*!< Profiling request body is not valid or number of samples is out of range */
+
+    // Streamed upload
+    STREAMED_UPLOAD_HEADER_MISSING, /*!< First message of streamed upload does not carry request header */
+    STREAMED_UPLOAD_INVALID_CHUNK,  /*!< Chunk does not match inputs declared in request header */
+    STREAMED_UPLOAD_INCOMPLETE,     /*!< Stream closed before all declared input data was received */
+    STREAMED_UPLOAD_SIZE_EXCEEDED,  /*!< Declared size of inputs exceeds streamed upload limit */
+    STREAMED_UPLOAD_ALLOCATION_FAILED, /*!< Buffer for streamed input data could not be allocated */
+
+    // Batch jobs
+    BATCH_JOB_INVALID_REQUEST, /*!< Batch job specification is not valid */
+    BATCH_JOB_NOT_FOUND,       /*!< Batch job with requested id does not exist */
+    BATCH_JOB_LIMIT_REACHED,   /*!< Too many batch jobs are queued */
+    NUMPY_INVALID_FORMAT,      /*!< Content is not a supported npy or npz array */
+
     STATUS_CODE_END
 };
 
@@ -0,0 +1,317 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tenant_limiter.hpp"
+
+#include "logging.hpp"
+#include "metric.hpp"
+#include "metric_config.hpp"
+#include "metric_family.hpp"
+#include "metric_registry.hpp"
+
+namespace ovms {
+
+const std::string DEFAULT_TENANT_NAME = "default";
+const std::string OTHER_TENANT_NAME = "other";
+
+static const std::string TENANT_REQUESTS_ADMITTED = "ovms_tenant_requests_admitted";
+static const std::string TENANT_REQUESTS_REJECTED = "ovms_tenant_requests_rejected";
+static const std::string TENANT_CURRENT_REQUESTS = "ovms_tenant_current_requests";
+// Minimal interval between scans for idle tenants of a servable with all tenant slots taken
+static const std::chrono::seconds TENANT_EVICTION_INTERVAL{1};
+
+static bool isIdle(const std::shared_ptr<TenantState>& state, std::chrono::steady_clock::time_point now) {
+    // State referenced only by the limiter is not held by any request
+    if (state.use_count() != 1) {
+        return false;
+    }
+    std::lock_guard<std::mutex> stateLock(state->mtx);
+    double elapsedSec = std::chrono::duration<double>(now - state->lastRefill).count();
+    bool bucketFull = (state->quota.rateLimit <= 0) ||
+                      (state->tokens + elapsedSec * state->quota.rateLimit >= state->quota.getBucketCapacity());
+    return (state->inFlight == 0) && bucketFull;
+}
+
+Status TenantQuota::parse(const rapidjson::Value& v) {
+    if (v.HasMember("rate_limit")) {
+        if (!v["rate_limit"].IsNumber() || v["rate_limit"].GetDouble() < 0) {
+            return StatusCode::TENANT_QUOTA_WRONG_FORMAT;
+        }
+        this->rateLimit = v["rate_limit"].GetDouble();
+    }
+    if (v.HasMember("burst")) {
+        if (!v["burst"].IsNumber() || v["burst"].GetDouble() < 0) {
+            return StatusCode::TENANT_QUOTA_WRONG_FORMAT;
+        }
+        this->burst = v["burst"].GetDouble();
+    }
+    if (v.HasMember("max_concurrency")) {
+        if (!v["max_concurrency"].IsUint()) {
+            return StatusCode::TENANT_QUOTA_WRONG_FORMAT;
+        }
+        this->maxConcurrency = v["max_concurrency"].GetUint();
+    }
+    return StatusCode::OK;
+}
+
+TenantState::TenantState(const TenantQuota& quota, std::chrono::steady_clock::time_point now) :
+    quota(quota),
+    tokens(quota.getBucketCapacity()),
+    lastRefill(now) {}
+
+TenantState::~TenantState() = default;
+
+TenantQuotaGuard::TenantQuotaGuard(std::shared_ptr<TenantState> state) :
+    state(std::move(state)) {}
+
+TenantQuotaGuard::~TenantQuotaGuard() {
+    std::lock_guard<std::mutex> lock(state->mtx);
+    state->inFlight--;
+    DECREMENT_IF_ENABLED(state->current);
+}
+
+void TenantLimiter::configure(const std::string& headerName, const TenantQuota& defaultQuota, uint32_t maxTrackedTenants) {
+    std::unique_lock lock(mtx);
+    this->headerName = headerName;
+    this->defaultQuota = defaultQuota;
+    this->maxTrackedTenants = maxTrackedTenants;
+    for (auto it = states.begin(); it != states.end();) {
+        it = eraseState(it);
+    }
+    this->servableTenants.clear();
+}
+
+Status TenantLimiter::parseServableQuotas(const rapidjson::Value& v) {
+    if (!v.IsArray()) {
+        return StatusCode::TENANT_QUOTA_WRONG_FORMAT;
+    }
+    std::unordered_map<std::string, TenantQuota> quotas;
+    for (const auto& entry : v.GetArray()) {
+        if (!entry.IsObject() || !entry.HasMember("name") || !entry["name"].IsString()) {
+            return StatusCode::TENANT_QUOTA_WRONG_FORMAT;
+        }
+        TenantQuota quota;
+        auto status = quota.parse(entry);
+        if (!status.ok()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Tenant quota for servable: {} has invalid format", entry["name"].GetString());
+            return status;
+        }
+        quotas[entry["name"].GetString()] = quota;
+    }
+    setServableQuotas(quotas);
+    return StatusCode::OK;
+}
+
+void TenantLimiter::setServableQuotas(const std::unordered_map<std::string, TenantQuota>& quotas) {
+    std::unique_lock lock(mtx);
+    this->servableQuotas = quotas;
+    for (auto& [key, state] : states) {
+        auto it = servableQuotas.find(key.first);
+        const TenantQuota& quota = (it != servableQuotas.end()) ? it->second : defaultQuota;
+        std::lock_guard<std::mutex> stateLock(state->mtx);
+        if (state->quota != quota) {
+            state->quota = quota;
+            state->tokens = std::min(state->tokens, quota.getBucketCapacity());
+        }
+    }
+}
+
+void TenantLimiter::setMetrics(const MetricConfig* metricConfig, MetricRegistry* registry) {
+    std::unique_lock lock(mtx);
+    this->metricConfig = metricConfig;
+    this->registry = registry;
+}
+
+TenantQuota TenantLimiter::getQuota(const std::string& servableName) const {
+    std::shared_lock lock(mtx);
+    auto it = servableQuotas.find(servableName);
+    return (it != servableQuotas.end()) ? it->second : defaultQuota;
+}
+
+void TenantLimiter::createMetrics(TenantState& state, const std::string& servableName, const std::string& tenant) {
+    if (!registry || !metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+    if (metricConfig->isFamilyEnabled(TENANT_REQUESTS_ADMITTED)) {
+        if (!admittedFamily) {
+            admittedFamily = registry->createFamily<MetricCounter>(TENANT_REQUESTS_ADMITTED,
+                "Number of requests of a tenant admitted to a model or a DAG.");
+        }
+        if (admittedFamily) {
+            state.admitted = admittedFamily->addMetric({{"name", servableName}, {"tenant", tenant}});
+        }
+    }
+    if (metricConfig->isFamilyEnabled(TENANT_REQUESTS_REJECTED)) {
+        if (!rejectedFamily) {
+            rejectedFamily = registry->createFamily<MetricCounter>(TENANT_REQUESTS_REJECTED,
+                "Number of requests of a tenant rejected due to exceeded quota.");
+        }
+        if (rejectedFamily) {
+            state.rejectedRate = rejectedFamily->addMetric({{"name", servableName}, {"tenant", tenant}, {"reason", "rate_limit"}});
+            state.rejectedConcurrency = rejectedFamily->addMetric({{"name", servableName}, {"tenant", tenant}, {"reason", "max_concurrency"}});
+        }
+    }
+    if (metricConfig->isFamilyEnabled(TENANT_CURRENT_REQUESTS)) {
+        if (!currentFamily) {
+            currentFamily = registry->createFamily<MetricGauge>(TENANT_CURRENT_REQUESTS,
+                "Number of requests of a tenant being currently processed by a model or a DAG.");
+        }
+        if (currentFamily) {
+            state.current = currentFamily->addMetric({{"name", servableName}, {"tenant", tenant}});
+        }
+    }
+}
+
+void TenantLimiter::removeMetrics(TenantState& state) {
+    if (admittedFamily && state.admitted) {
+        admittedFamily->remove(state.admitted);
+    }
+    if (rejectedFamily && state.rejectedRate) {
+        rejectedFamily->remove(state.rejectedRate);
+    }
+    if (rejectedFamily && state.rejectedConcurrency) {
+        rejectedFamily->remove(state.rejectedConcurrency);
+    }
+    if (currentFamily && state.current) {
+        currentFamily->remove(state.current);
+    }
+}
+
+TenantLimiter::states_map_t::iterator TenantLimiter::eraseState(states_map_t::iterator it) {
+    const auto& [servableName, tenant] = it->first;
+    if (tenant != OTHER_TENANT_NAME) {
+        auto servableIt = servableTenants.find(servableName);
+        if (servableIt != servableTenants.end() && servableIt->second.tracked > 0) {
+            servableIt->second.tracked--;
+        }
+    }
+    removeMetrics(*it->second);
+    return states.erase(it);
+}
+
+void TenantLimiter::evictIdleTenants(const std::string& servableName, std::chrono::steady_clock::time_point now) {
+    size_t evicted = 0;
+    // States are ordered by servable name first
+    for (auto it = states.lower_bound({servableName, ""}); it != states.end() && it->first.first == servableName;) {
+        if (it->first.second != OTHER_TENANT_NAME && isIdle(it->second, now)) {
+            it = eraseState(it);
+            evicted++;
+        } else {
+            ++it;
+        }
+    }
+    SPDLOG_DEBUG("Evicted {} idle tenants of servable: {}", evicted, servableName);
+}
+
+std::shared_ptr<TenantState> TenantLimiter::getState(const std::string& servableName, const std::string& tenant, std::chrono::steady_clock::time_point now) {
+    auto key = std::make_pair(servableName, tenant);
+    {
+        std::shared_lock lock(mtx);
+        auto it = states.find(key);
+        if (it != states.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock lock(mtx);
+    auto it = states.find(key);
+    if (it != states.end()) {
+        return it->second;
+    }
+    auto& servable = servableTenants[servableName];
+    if (tenant != OTHER_TENANT_NAME && servable.tracked >= maxTrackedTenants) {
+        if (now >= servable.nextEviction) {
+            servable.nextEviction = now + TENANT_EVICTION_INTERVAL;
+            evictIdleTenants(servableName, now);
+        }
+        if (servable.tracked >= maxTrackedTenants) {
+            SPDLOG_DEBUG("Limit of {} tracked tenants of servable: {} reached. Tenant: {} shares quota of tenant: {}", maxTrackedTenants, servableName, tenant, OTHER_TENANT_NAME);
+            key.second = OTHER_TENANT_NAME;
+            it = states.find(key);
+            if (it != states.end()) {
+                return it->second;
+            }
+        }
+    }
+    if (key.second != OTHER_TENANT_NAME) {
+        servable.tracked++;
+    }
+    auto quotaIt = servableQuotas.find(servableName);
+    const TenantQuota& quota = (quotaIt != servableQuotas.end()) ? quotaIt->second : defaultQuota;
+    auto state = std::make_shared<TenantState>(quota, now);
+    createMetrics(*state, servableName, key.second);
+    SPDLOG_DEBUG("Started tracking tenant: {} for servable: {}", key.second, servableName);
+    states.emplace(std::move(key), state);
+    return state;
+}
+
+Status TenantLimiter::acquire(const std::string& servableName, const std::string& tenant, std::unique_ptr<TenantQuotaGuard>& guard) {
+    return acquire(servableName, tenant, guard, std::chrono::steady_clock::now());
+}
+
+Status TenantLimiter::acquire(const std::string& servableName, const std::string& tenant, std::unique_ptr<TenantQuotaGuard>& guard, std::chrono::steady_clock::time_point now) {
+    if (!isEnabled()) {
+        return StatusCode::OK;
+    }
+    const std::string& tenantName = tenant.empty() ? DEFAULT_TENANT_NAME : tenant;
+    auto state = getState(servableName, tenantName, now);
+    std::unique_lock<std::mutex> lock(state->mtx);
+    const TenantQuota& quota = state->quota;
+    if (quota.rateLimit > 0) {
+        double elapsedSec = std::chrono::duration<double>(now - state->lastRefill).count();
+        if (elapsedSec > 0) {
+            state->tokens = std::min(quota.getBucketCapacity(), state->tokens + elapsedSec * quota.rateLimit);
+            state->lastRefill = now;
+        }
+        if (state->tokens < 1) {
+            INCREMENT_IF_ENABLED(state->rejectedRate);
+            SPDLOG_DEBUG("Tenant: {} exceeded rate limit: {}/s of servable: {}", tenantName, quota.rateLimit, servableName);
+            return Status(StatusCode::TENANT_QUOTA_EXCEEDED, "rate limit of tenant " + tenantName);
+        }
+    }
+    if (quota.maxConcurrency > 0 && state->inFlight >= quota.maxConcurrency) {
+        INCREMENT_IF_ENABLED(state->rejectedConcurrency);
+        SPDLOG_DEBUG("Tenant: {} exceeded max concurrency: {} of servable: {}", tenantName, quota.maxConcurrency, servableName);
+        return Status(StatusCode::TENANT_QUOTA_EXCEEDED, "max concurrency of tenant " + tenantName);
+    }
+    if (quota.rateLimit > 0) {
+        state->tokens -= 1;
+    }
+    state->inFlight++;
+    INCREMENT_IF_ENABLED(state->admitted);
+    INCREMENT_IF_ENABLED(state->current);
+    lock.unlock();
+    // Previous guard held in the pointer may release the same state
+    guard = std::make_unique<TenantQuotaGuard>(std::move(state));
+    return StatusCode::OK;
+}
+
+void TenantLimiter::cleanupIdleTenants() {
+    auto now = std::chrono::steady_clock::now();
+    std::unique_lock lock(mtx);
+    for (auto it = states.begin(); it != states.end();) {
+        if (isIdle(it->second, now)) {
+            it = eraseState(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+size_t TenantLimiter::getTrackedTenantsCount() const {
+    std::shared_lock lock(mtx);
+    return states.size();
+}
+
+}  // namespace ovms
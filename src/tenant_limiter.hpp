@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <rapidjson/document.h>
+
+#include "status.hpp"
+
+namespace ovms {
+
+class MetricConfig;
+class MetricCounter;
+class MetricGauge;
+template <typename MetricType>
+class MetricFamily;
+class MetricRegistry;
+
+extern const std::string DEFAULT_TENANT_NAME;
+extern const std::string OTHER_TENANT_NAME;
+const uint32_t DEFAULT_MAX_TRACKED_TENANTS = 1000;
+
+/**
+ * @brief Limits applied to each tenant separately. Zero means unlimited.
+ */
+struct TenantQuota {
+    double rateLimit = 0;         // requests per second refilled into token bucket
+    double burst = 0;             // token bucket capacity, when 0 max(rateLimit, 1) is used
+    uint32_t maxConcurrency = 0;  // requests of single tenant executed in parallel
+
+    bool isLimited() const {
+        return rateLimit > 0 || maxConcurrency > 0;
+    }
+
+    double getBucketCapacity() const {
+        return burst > 0 ? burst : std::max(rateLimit, 1.0);
+    }
+
+    bool operator==(const TenantQuota& rhs) const {
+        return rateLimit == rhs.rateLimit && burst == rhs.burst && maxConcurrency == rhs.maxConcurrency;
+    }
+    bool operator!=(const TenantQuota& rhs) const {
+        return !(*this == rhs);
+    }
+
+    Status parse(const rapidjson::Value& v);
+};
+
+/**
+ * @brief Token bucket & in-flight counter of single tenant requesting single servable
+ */
+struct TenantState {
+    std::mutex mtx;
+    TenantQuota quota;
+    double tokens;
+    std::chrono::steady_clock::time_point lastRefill;
+    uint32_t inFlight = 0;
+
+    std::unique_ptr<MetricCounter> admitted;
+    std::unique_ptr<MetricCounter> rejectedRate;
+    std::unique_ptr<MetricCounter> rejectedConcurrency;
+    std::unique_ptr<MetricGauge> current;
+
+    TenantState(const TenantQuota& quota, std::chrono::steady_clock::time_point now);
+    ~TenantState();
+};
+
+/**
+ * @brief Holds concurrency slot of a tenant for the request lifetime
+ */
+class TenantQuotaGuard {
+    std::shared_ptr<TenantState> state;
+
+public:
+    TenantQuotaGuard(std::shared_ptr<TenantState> state);
+    ~TenantQuotaGuard();
+};
+
+/**
+ * @brief Isolates tenants sharing servables. Tenant is identified by gRPC metadata key
+ * or HTTP header configured with tenant_header parameter. Each (servable, tenant) pair
+ * gets its own token bucket and concurrency limit, so a single tenant cannot occupy whole
+ * infer request queue of a model. Requests over quota are rejected.
+ * Tenant names come from clients, so number of tenants tracked per servable is capped.
+ * When the cap is reached idle tenants are evicted, and if none is idle new tenants
+ * share single bucket and metric labels of OTHER_TENANT_NAME.
+ */
+class TenantLimiter {
+    std::string headerName;
+    TenantQuota defaultQuota;
+    uint32_t maxTrackedTenants = DEFAULT_MAX_TRACKED_TENANTS;
+    std::unordered_map<std::string, TenantQuota> servableQuotas;
+
+    mutable std::shared_mutex mtx;
+    using states_map_t = std::map<std::pair<std::string, std::string>, std::shared_ptr<TenantState>>;
+    states_map_t states;
+
+    struct ServableTenants {
+        size_t tracked = 0;  // without OTHER_TENANT_NAME
+        std::chrono::steady_clock::time_point nextEviction;
+    };
+    std::unordered_map<std::string, ServableTenants> servableTenants;
+
+    const MetricConfig* metricConfig = nullptr;
+    MetricRegistry* registry = nullptr;
+    std::shared_ptr<MetricFamily<MetricCounter>> admittedFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> rejectedFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> currentFamily;
+
+    std::shared_ptr<TenantState> getState(const std::string& servableName, const std::string& tenant, std::chrono::steady_clock::time_point now);
+    void createMetrics(TenantState& state, const std::string& servableName, const std::string& tenant);
+    void removeMetrics(TenantState& state);
+    void evictIdleTenants(const std::string& servableName, std::chrono::steady_clock::time_point now);
+    states_map_t::iterator eraseState(states_map_t::iterator it);
+
+public:
+    TenantLimiter() = default;
+    TenantLimiter(const TenantLimiter&) = delete;
+    TenantLimiter& operator=(const TenantLimiter&) = delete;
+
+    /**
+     * @brief Empty header name disables tenant isolation
+     *
+     * @param maxTrackedTenants number of tenants with separate state per servable
+     */
+    void configure(const std::string& headerName, const TenantQuota& defaultQuota, uint32_t maxTrackedTenants = DEFAULT_MAX_TRACKED_TENANTS);
+
+    /**
+     * @brief Parses "tenant_quotas" array of configuration file with per servable overrides
+     */
+    Status parseServableQuotas(const rapidjson::Value& v);
+    void setServableQuotas(const std::unordered_map<std::string, TenantQuota>& quotas);
+
+    void setMetrics(const MetricConfig* metricConfig, MetricRegistry* registry);
+
+    bool isEnabled() const { return !headerName.empty(); }
+    const std::string& getHeaderName() const { return headerName; }
+    TenantQuota getQuota(const std::string& servableName) const;
+
+    /**
+     * @brief Takes a token and a concurrency slot of given tenant. On success guard is set
+     * and keeps the slot until destroyed. Returns TENANT_QUOTA_EXCEEDED otherwise.
+     */
+    Status acquire(const std::string& servableName, const std::string& tenant, std::unique_ptr<TenantQuotaGuard>& guard);
+    Status acquire(const std::string& servableName, const std::string& tenant, std::unique_ptr<TenantQuotaGuard>& guard, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Drops state of tenants which have no requests in flight and full token bucket
+     */
+    void cleanupIdleTenants();
+    size_t getTrackedTenantsCount() const;
+};
+
+}  // namespace ovms
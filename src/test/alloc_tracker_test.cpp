@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <new>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../alloc_tracker.hpp"
+
+using namespace ovms;
+
+TEST(AllocTracker, StageNames) {
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_REST_PARSE)), "rest_parse");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_PROTO_BUILD)), "proto_build");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_VALIDATION)), "validation");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_DESERIALIZE)), "deserialize");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_INFER)), "infer");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_SERIALIZE)), "serialize");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_JSON_WRITE)), "json_write");
+    EXPECT_EQ(std::string(getAllocStageName(ALLOC_STAGE_DAG_NODE)), "dag_node");
+}
+
+TEST(AllocTracker, ScopeCountsAllocationsOfStage) {
+    auto before = AllocTracker::instance().getStageTotals(ALLOC_STAGE_JSON_WRITE);
+    {
+        AllocTrackingScope scope(ALLOC_STAGE_JSON_WRITE);
+        // Direct calls, since compiler may elide allocations of new expressions
+        for (int i = 0; i < 10; i++) {
+            void* buffer = ::operator new(1000);
+            ::operator delete(buffer);
+        }
+    }
+    auto after = AllocTracker::instance().getStageTotals(ALLOC_STAGE_JSON_WRITE);
+    if (!AllocTracker::isCompiledIn()) {
+        EXPECT_EQ(after.count, before.count);
+        EXPECT_EQ(after.bytes, before.bytes);
+        return;
+    }
+    EXPECT_EQ(after.count - before.count, 10);
+    EXPECT_EQ(after.bytes - before.bytes, 10 * 1000);
+}
+
+TEST(AllocTracker, NestedScopeTakesOverAttribution) {
+    if (!AllocTracker::isCompiledIn()) {
+        GTEST_SKIP() << "Allocation tracking is not compiled in";
+    }
+    auto outerBefore = AllocTracker::instance().getStageTotals(ALLOC_STAGE_REST_PARSE);
+    auto innerBefore = AllocTracker::instance().getStageTotals(ALLOC_STAGE_PROTO_BUILD);
+    {
+        AllocTrackingScope outer(ALLOC_STAGE_REST_PARSE);
+        ::operator delete(::operator new(8));
+        {
+            AllocTrackingScope inner(ALLOC_STAGE_PROTO_BUILD);
+            ::operator delete(::operator new(16));
+            ::operator delete(::operator new(16));
+        }
+        ::operator delete(::operator new(8));
+    }
+    EXPECT_EQ(AllocTracker::instance().getStageTotals(ALLOC_STAGE_REST_PARSE).count - outerBefore.count, 2);
+    EXPECT_EQ(AllocTracker::instance().getStageTotals(ALLOC_STAGE_PROTO_BUILD).count - innerBefore.count, 2);
+    EXPECT_EQ(AllocTracker::instance().getStageTotals(ALLOC_STAGE_PROTO_BUILD).bytes - innerBefore.bytes, 32);
+}
+
+TEST(AllocTracker, NestedScopesOfSameStageCountAllocationsOnce) {
+    if (!AllocTracker::isCompiledIn()) {
+        GTEST_SKIP() << "Allocation tracking is not compiled in";
+    }
+    auto outerBefore = AllocTracker::instance().getStageTotals(ALLOC_STAGE_DAG_NODE);
+    auto innerBefore = AllocTracker::instance().getStageTotals(ALLOC_STAGE_INFER);
+    {
+        AllocTrackingScope outer(ALLOC_STAGE_DAG_NODE);
+        ::operator delete(::operator new(8));
+        {
+            AllocTrackingScope sameStage(ALLOC_STAGE_DAG_NODE);
+            ::operator delete(::operator new(8));
+            {
+                AllocTrackingScope otherStage(ALLOC_STAGE_INFER);
+                ::operator delete(::operator new(16));
+                AllocTrackingScope sameStageAgain(ALLOC_STAGE_DAG_NODE);
+                ::operator delete(::operator new(8));
+            }
+        }
+    }
+    EXPECT_EQ(AllocTracker::instance().getStageTotals(ALLOC_STAGE_DAG_NODE).count - outerBefore.count, 3);
+    EXPECT_EQ(AllocTracker::instance().getStageTotals(ALLOC_STAGE_DAG_NODE).bytes - outerBefore.bytes, 24);
+    EXPECT_EQ(AllocTracker::instance().getStageTotals(ALLOC_STAGE_INFER).count - innerBefore.count, 1);
+}
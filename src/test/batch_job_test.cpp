@@ -0,0 +1,189 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../batch_job.hpp"
+#include "../numpy_utils.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+TEST(BatchJobSpec, ParseValid) {
+    BatchJobSpec spec;
+    ASSERT_EQ(BatchJobSpec::fromJson(R"({"servable_name": "dummy", "servable_version": 2, "input_path": "in", "output_path": "out",
+        "input_name": "b", "batch_size": 8, "max_in_flight": 4})",
+                  spec),
+        StatusCode::OK);
+    EXPECT_EQ(spec.servableName, "dummy");
+    EXPECT_EQ(spec.servableVersion, 2);
+    EXPECT_EQ(spec.inputPath, "in");
+    EXPECT_EQ(spec.outputPath, "out");
+    EXPECT_EQ(spec.inputName, "b");
+    EXPECT_EQ(spec.batchSize, 8);
+    EXPECT_EQ(spec.maxInFlight, 4);
+}
+
+TEST(BatchJobSpec, ParseDefaults) {
+    BatchJobSpec spec;
+    ASSERT_EQ(BatchJobSpec::fromJson(R"({"servable_name": "dummy", "input_path": "in", "output_path": "out"})", spec), StatusCode::OK);
+    EXPECT_EQ(spec.servableVersion, 0);
+    EXPECT_EQ(spec.inputName, "");
+    EXPECT_EQ(spec.batchSize, 1);
+    EXPECT_EQ(spec.maxInFlight, 1);
+}
+
+TEST(BatchJobSpec, ParseInvalid) {
+    BatchJobSpec spec;
+    EXPECT_EQ(BatchJobSpec::fromJson("", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson("[]", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson(R"({"input_path": "in", "output_path": "out"})", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson(R"({"servable_name": "dummy", "output_path": "out"})", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson(R"({"servable_name": 1, "input_path": "in", "output_path": "out"})", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson(R"({"servable_name": "dummy", "servable_version": -1, "input_path": "in", "output_path": "out"})", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson(R"({"servable_name": "dummy", "input_path": "in", "output_path": "out", "batch_size": 0})", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(BatchJobSpec::fromJson(R"({"servable_name": "dummy", "input_path": "in", "output_path": "out", "max_in_flight": 1000})", spec), StatusCode::BATCH_JOB_INVALID_REQUEST);
+}
+
+class BatchJobManagerTest : public TestWithTempDir {
+protected:
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        ASSERT_EQ(manager.reloadModelWithVersions(config), StatusCode::OK_RELOADED);
+        std::filesystem::create_directories(directoryPath + "/in");
+    }
+
+    void writeInput(const std::string& name, const std::vector<float>& data) {
+        std::string content;
+        ASSERT_EQ(makeNpy(Precision::FP32, {1, data.size()}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)), content), StatusCode::OK);
+        std::ofstream(directoryPath + "/in/" + name, std::ios::binary) << content;
+    }
+
+    std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    void waitForFinish(const std::shared_ptr<BatchJob>& job) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!job->isFinished() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_TRUE(job->isFinished());
+    }
+
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    ConstructorEnabledModelManager manager;
+};
+
+TEST_F(BatchJobManagerTest, DisabledWithoutRootPath) {
+    BatchJobManager jobs(manager);
+    ASSERT_EQ(jobs.start(""), StatusCode::OK);
+    EXPECT_FALSE(jobs.isEnabled());
+    std::shared_ptr<BatchJob> job;
+    EXPECT_EQ(jobs.submit(BatchJobSpec{"dummy", 0, "in", "out"}, job), StatusCode::REST_INVALID_URL);
+    EXPECT_EQ(jobs.get("1", job), StatusCode::REST_INVALID_URL);
+}
+
+TEST_F(BatchJobManagerTest, RejectsInvalidSubmission) {
+    BatchJobManager jobs(manager);
+    ASSERT_EQ(jobs.start(directoryPath), StatusCode::OK);
+    std::shared_ptr<BatchJob> job;
+    EXPECT_EQ(jobs.submit(BatchJobSpec{"unknown", 0, "in", "out"}, job), StatusCode::MODEL_NAME_MISSING);
+    EXPECT_EQ(jobs.submit(BatchJobSpec{"dummy", 0, "../in", "out"}, job), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(jobs.submit(BatchJobSpec{"dummy", 0, "in", "/tmp/out"}, job), StatusCode::BATCH_JOB_INVALID_REQUEST);
+    EXPECT_EQ(jobs.get("1", job), StatusCode::BATCH_JOB_NOT_FOUND);
+    EXPECT_EQ(jobs.get("abc", job), StatusCode::BATCH_JOB_NOT_FOUND);
+}
+
+TEST_F(BatchJobManagerTest, ProcessesNpyShards) {
+    writeInput("0.npy", std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 1.0));
+    writeInput("1.npy", std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 2.0));
+    std::ofstream(directoryPath + "/in/readme.txt") << "skipped";
+    BatchJobManager jobs(manager);
+    ASSERT_EQ(jobs.start(directoryPath), StatusCode::OK);
+    std::shared_ptr<BatchJob> job;
+    BatchJobSpec spec{"dummy", 0, "in", "out"};
+    spec.maxInFlight = 2;
+    ASSERT_EQ(jobs.submit(spec, job), StatusCode::OK);
+    waitForFinish(job);
+    ASSERT_EQ(job->getState(), BatchJobState::COMPLETED) << job->toJson();
+
+    for (const auto& [item, value] : std::vector<std::pair<std::string, float>>{{"0.npy", 2.0}, {"1.npy", 3.0}}) {
+        const std::string content = readFile(directoryPath + "/out/" + item + "/" + DUMMY_MODEL_OUTPUT_NAME + ".npy");
+        NumpyArray output;
+        ASSERT_EQ(parseNpy(content, output), StatusCode::OK) << item;
+        EXPECT_EQ(output.shape, shape_t({1, DUMMY_MODEL_OUTPUT_SIZE}));
+        ASSERT_EQ(output.data.size(), DUMMY_MODEL_OUTPUT_SIZE * sizeof(float));
+        EXPECT_EQ(reinterpret_cast<const float*>(output.data.data())[0], value);
+    }
+    const std::string manifest = readFile(directoryPath + "/out/manifest.jsonl");
+    EXPECT_EQ(std::count(manifest.begin(), manifest.end(), '\n'), 2);
+    EXPECT_NE(manifest.find(R"({"item":"0.npy","inputs":["0.npy"],"status":"OK"})"), std::string::npos);
+    EXPECT_NE(job->toJson().find(R"("samples_processed":2)"), std::string::npos);
+}
+
+TEST_F(BatchJobManagerTest, ReportsFailedItems) {
+    writeInput("0.npy", std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 1.0));
+    writeInput("1.npy", std::vector<float>(DUMMY_MODEL_INPUT_SIZE + 1, 1.0));
+    BatchJobManager jobs(manager);
+    ASSERT_EQ(jobs.start(directoryPath), StatusCode::OK);
+    std::shared_ptr<BatchJob> job;
+    ASSERT_EQ(jobs.submit(BatchJobSpec{"dummy", 0, "in", "out"}, job), StatusCode::OK);
+    waitForFinish(job);
+    EXPECT_EQ(job->getState(), BatchJobState::COMPLETED);
+    EXPECT_NE(job->toJson().find(R"("items_failed":1)"), std::string::npos);
+    EXPECT_TRUE(std::filesystem::exists(directoryPath + "/out/0.npy"));
+    EXPECT_FALSE(std::filesystem::exists(directoryPath + "/out/1.npy"));
+}
+
+TEST_F(BatchJobManagerTest, FailsWithoutInputs) {
+    BatchJobManager jobs(manager);
+    ASSERT_EQ(jobs.start(directoryPath), StatusCode::OK);
+    std::shared_ptr<BatchJob> job;
+    ASSERT_EQ(jobs.submit(BatchJobSpec{"dummy", 0, "in", "out"}, job), StatusCode::OK);
+    waitForFinish(job);
+    EXPECT_EQ(job->getState(), BatchJobState::FAILED);
+}
+
+TEST_F(BatchJobManagerTest, CancelQueuedJob) {
+    writeInput("0.npy", std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 1.0));
+    BatchJobManager jobs(manager);
+    ASSERT_EQ(jobs.start(directoryPath), StatusCode::OK);
+    std::vector<std::shared_ptr<BatchJob>> submitted(3);
+    for (auto& job : submitted) {
+        ASSERT_EQ(jobs.submit(BatchJobSpec{"dummy", 0, "in", "out"}, job), StatusCode::OK);
+    }
+    std::shared_ptr<BatchJob> cancelled;
+    ASSERT_EQ(jobs.cancel(submitted.back()->getId(), cancelled), StatusCode::OK);
+    EXPECT_TRUE(cancelled->isCancelRequested());
+    for (auto& job : submitted) {
+        waitForFinish(job);
+    }
+    EXPECT_EQ(submitted.back()->getState(), BatchJobState::CANCELLED);
+    EXPECT_EQ(jobs.list().size(), 3);
+}
@@ -445,6 +445,77 @@ TYPED_TEST(BinaryUtilsTest, positive_range_resolution_matching_in_between) {
     }
 }
 
+TYPED_TEST(BinaryUtilsTest, positive_resizing_large_jpeg_decoded_with_reduced_resolution) {
+    // Image 8 times bigger than the target is decoded with 1/8 scale before resizing
+    const cv::Scalar bgr(0x10, 0x80, 0xf0);
+    for (const int channels : {1, 3}) {
+        cv::Mat source(64, 128, channels == 1 ? CV_8UC1 : CV_8UC3, bgr);
+        std::vector<uchar> encoded;
+        ASSERT_TRUE(cv::imencode(".jpg", source, encoded, {cv::IMWRITE_JPEG_QUALITY, 100}));
+        std::string image(encoded.begin(), encoded.end());
+
+        TypeParam requestTensor;
+        this->prepareBinaryTensor(requestTensor, image);
+        std::shared_ptr<TensorInfo> tensorInfo = std::make_shared<TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 4, 8, channels}, Layout{"NHWC"});
+
+        ov::Tensor tensor;
+        ASSERT_EQ(convertBinaryRequestTensorToOVTensor(requestTensor, tensor, tensorInfo), ovms::StatusCode::OK);
+        shape_t tensorDims = tensor.get_shape();
+        ASSERT_EQ(tensorDims, (shape_t{1, 4, 8, static_cast<size_t>(channels)}));
+        uint8_t* ptr = static_cast<uint8_t*>(tensor.data());
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            EXPECT_NEAR(ptr[i], bgr[i % channels], 2) << "channels: " << channels << " index: " << i;
+        }
+    }
+}
+
+std::string encodeImage(const std::string& extension, int height, int width, int type) {
+    cv::Mat source(height, width, type, cv::Scalar(0x10, 0x80, 0xf0));
+    std::vector<uchar> encoded;
+    EXPECT_TRUE(cv::imencode(extension, source, encoded));
+    return std::string(encoded.begin(), encoded.end());
+}
+
+TEST(BinaryUtilsJpegDecodeFlags, ReadJpegHeader) {
+    int height = 0, width = 0, components = 0;
+    ASSERT_TRUE(readJpegHeader(encodeImage(".jpg", 256, 512, CV_8UC3), height, width, components));
+    EXPECT_EQ(height, 256);
+    EXPECT_EQ(width, 512);
+    EXPECT_EQ(components, 3);
+    ASSERT_TRUE(readJpegHeader(encodeImage(".jpg", 120, 40, CV_8UC1), height, width, components));
+    EXPECT_EQ(height, 120);
+    EXPECT_EQ(width, 40);
+    EXPECT_EQ(components, 1);
+    EXPECT_FALSE(readJpegHeader(encodeImage(".png", 256, 512, CV_8UC3), height, width, components));
+    EXPECT_FALSE(readJpegHeader("", height, width, components));
+}
+
+TEST(BinaryUtilsJpegDecodeFlags, LargeJpegIsDecodedWithReducedResolution) {
+    const std::string color = encodeImage(".jpg", 256, 512, CV_8UC3);
+    EXPECT_EQ(getImageDecodeFlags(color, 32, 64), cv::IMREAD_REDUCED_COLOR_8 | cv::IMREAD_IGNORE_ORIENTATION);
+    EXPECT_EQ(getImageDecodeFlags(color, 20, 64), cv::IMREAD_REDUCED_COLOR_8 | cv::IMREAD_IGNORE_ORIENTATION);
+    EXPECT_EQ(getImageDecodeFlags(color, 33, 64), cv::IMREAD_REDUCED_COLOR_4 | cv::IMREAD_IGNORE_ORIENTATION);
+    EXPECT_EQ(getImageDecodeFlags(color, 64, 128), cv::IMREAD_REDUCED_COLOR_4 | cv::IMREAD_IGNORE_ORIENTATION);
+    EXPECT_EQ(getImageDecodeFlags(color, 128, 256), cv::IMREAD_REDUCED_COLOR_2 | cv::IMREAD_IGNORE_ORIENTATION);
+    const std::string grayscale = encodeImage(".jpg", 256, 512, CV_8UC1);
+    EXPECT_EQ(getImageDecodeFlags(grayscale, 32, 64), cv::IMREAD_REDUCED_GRAYSCALE_8 | cv::IMREAD_IGNORE_ORIENTATION);
+}
+
+TEST(BinaryUtilsJpegDecodeFlags, NoReductionWhenTargetIsBiggerThanHalfOfSource) {
+    const std::string color = encodeImage(".jpg", 256, 512, CV_8UC3);
+    EXPECT_EQ(getImageDecodeFlags(color, 129, 256), cv::IMREAD_UNCHANGED);
+    EXPECT_EQ(getImageDecodeFlags(color, 128, 257), cv::IMREAD_UNCHANGED);
+    EXPECT_EQ(getImageDecodeFlags(color, 256, 512), cv::IMREAD_UNCHANGED);
+    EXPECT_EQ(getImageDecodeFlags(color, 1024, 1024), cv::IMREAD_UNCHANGED);
+}
+
+TEST(BinaryUtilsJpegDecodeFlags, NoReductionForDynamicTargetOrNonJpeg) {
+    const std::string color = encodeImage(".jpg", 256, 512, CV_8UC3);
+    EXPECT_EQ(getImageDecodeFlags(color, Dimension::any(), 64), cv::IMREAD_UNCHANGED);
+    EXPECT_EQ(getImageDecodeFlags(color, 32, Dimension(16, 64)), cv::IMREAD_UNCHANGED);
+    EXPECT_EQ(getImageDecodeFlags(encodeImage(".png", 256, 512, CV_8UC3), 32, 64), cv::IMREAD_UNCHANGED);
+}
+
 class BinaryUtilsTFSPrecisionTest : public ::testing::TestWithParam<ovms::Precision> {
 protected:
     void SetUp() override {
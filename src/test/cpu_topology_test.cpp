@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../cpu_topology.hpp"
+#include "../modelconfig.hpp"
+#include "../modelinstance.hpp"
+
+using namespace ovms;
+using testing::ElementsAre;
+
+TEST(CpuTopology, ParseCpuList) {
+    cpu_list_t cores;
+    EXPECT_EQ(CpuTopology::parseCpuList("", cores), StatusCode::OK);
+    EXPECT_TRUE(cores.empty());
+    EXPECT_EQ(CpuTopology::parseCpuList("3", cores), StatusCode::OK);
+    EXPECT_THAT(cores, ElementsAre(3));
+    EXPECT_EQ(CpuTopology::parseCpuList("0-3,8", cores), StatusCode::OK);
+    EXPECT_THAT(cores, ElementsAre(0, 1, 2, 3, 8));
+    EXPECT_EQ(CpuTopology::parseCpuList(" 10-11, 2,2,1-2 ", cores), StatusCode::OK);
+    EXPECT_THAT(cores, ElementsAre(1, 2, 10, 11));
+}
+
+TEST(CpuTopology, ParseCpuListInvalid) {
+    cpu_list_t cores;
+    for (const std::string str : {"a", "1,,2", "3-1", "-1", "1-", "1-2-3", "0-100000", "1;2"}) {
+        EXPECT_EQ(CpuTopology::parseCpuList(str, cores), StatusCode::CPU_LIST_WRONG_FORMAT) << str;
+    }
+}
+
+TEST(CpuTopology, ToString) {
+    EXPECT_EQ(CpuTopology::toString({}), "");
+    EXPECT_EQ(CpuTopology::toString({5}), "5");
+    EXPECT_EQ(CpuTopology::toString({0, 1, 2, 3, 8, 10, 11}), "0-3,8,10-11");
+}
+
+TEST(CpuTopology, ThreadAffinityGuardRestoresAffinity) {
+    cpu_list_t original;
+    ASSERT_EQ(CpuTopology::getCurrentThreadAffinity(original), StatusCode::OK);
+    ASSERT_FALSE(original.empty());
+    {
+        ThreadAffinityGuard guard({original[0]});
+        cpu_list_t current;
+        ASSERT_EQ(CpuTopology::getCurrentThreadAffinity(current), StatusCode::OK);
+        EXPECT_THAT(current, ElementsAre(original[0]));
+        cpu_list_t inherited;
+        std::thread([&inherited]() { CpuTopology::getCurrentThreadAffinity(inherited); }).join();
+        EXPECT_THAT(inherited, ElementsAre(original[0]));
+    }
+    cpu_list_t restored;
+    ASSERT_EQ(CpuTopology::getCurrentThreadAffinity(restored), StatusCode::OK);
+    EXPECT_EQ(restored, original);
+}
+
+TEST(CpuTopology, PluginConfigFollowsInferenceCores) {
+    cpu_list_t available;
+    ASSERT_EQ(CpuTopology::getCurrentThreadAffinity(available), StatusCode::OK);
+    ASSERT_EQ(CpuTopology::instance().configure("", std::to_string(available[0])), StatusCode::OK);
+    ModelConfig config;
+    config.setTargetDevice("CPU");
+    config.setPluginConfig({});
+    plugin_config_t pluginConfig = ModelInstance::prepareDefaultPluginConfig(config);
+    EXPECT_EQ(pluginConfig["CPU_BIND_THREAD"].as<std::string>(), "YES");
+    EXPECT_EQ(pluginConfig["CPU_THREADS_NUM"].as<std::string>(), "1");
+
+    config.setPluginConfig({{"CPU_BIND_THREAD", "NUMA"}});
+    pluginConfig = ModelInstance::prepareDefaultPluginConfig(config);
+    EXPECT_EQ(pluginConfig["CPU_BIND_THREAD"].as<std::string>(), "NUMA");
+
+    config.setTargetDevice("GPU");
+    pluginConfig = ModelInstance::prepareDefaultPluginConfig(config);
+    EXPECT_EQ(pluginConfig.count("CPU_THREADS_NUM"), 0);
+
+    ASSERT_EQ(CpuTopology::instance().configure("", ""), StatusCode::OK);
+    config.setTargetDevice("CPU");
+    config.setPluginConfig({});
+    pluginConfig = ModelInstance::prepareDefaultPluginConfig(config);
+    EXPECT_EQ(pluginConfig.count("CPU_BIND_THREAD"), 0);
+    EXPECT_EQ(pluginConfig.count("CPU_THREADS_NUM"), 0);
+}
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../custom_nodes/tokenizer/wordpiece_tokenizer.hpp"
+
+using ovms::custom_nodes_tokenizer::token_id_t;
+using ovms::custom_nodes_tokenizer::WordpieceTokenizer;
+using testing::ElementsAre;
+
+class CustomNodeTokenizer : public ::testing::Test {
+protected:
+    std::string vocabPath;
+    WordpieceTokenizer tokenizer;
+
+    void SetUp() override {
+        char path[] = "/tmp/ovms_tokenizer_vocab_XXXXXX";
+        int fd = mkstemp(path);
+        ASSERT_NE(fd, -1);
+        close(fd);
+        vocabPath = path;
+        std::ofstream file(vocabPath);
+        // id:     0        1        2        3      4       5       6        7     8     9      10   11     12
+        file << "[PAD]\n[UNK]\n[CLS]\n[SEP]\nhello\nworld\nplay\n##ing\n##s\n,\n!\n\xe4\xb8\xad\nun\n##aff\n##able\n";
+        file.close();
+        std::string error;
+        ASSERT_TRUE(tokenizer.loadVocabulary(vocabPath, error)) << error;
+        ASSERT_TRUE(tokenizer.setSpecialTokens("[UNK]", "[CLS]", "[SEP]", error)) << error;
+    }
+
+    void TearDown() override {
+        std::remove(vocabPath.c_str());
+    }
+
+    std::vector<token_id_t> tokenize(const std::string& text) {
+        std::vector<token_id_t> ids;
+        EXPECT_TRUE(tokenizer.tokenize(reinterpret_cast<const uint8_t*>(text.data()), text.size(), ids));
+        return ids;
+    }
+};
+
+TEST_F(CustomNodeTokenizer, LoadVocabulary) {
+    EXPECT_EQ(tokenizer.getVocabularySize(), 15);
+    EXPECT_EQ(tokenizer.getClsId(), 2);
+    EXPECT_EQ(tokenizer.getSepId(), 3);
+    EXPECT_EQ(tokenizer.findToken("##ing"), 7);
+    EXPECT_EQ(tokenizer.findToken("missing"), -1);
+    std::string error;
+    WordpieceTokenizer other;
+    EXPECT_FALSE(other.loadVocabulary("/not/existing/vocab.txt", error));
+    ASSERT_TRUE(other.loadVocabulary(vocabPath, error));
+    EXPECT_FALSE(other.setSpecialTokens("[MASK]", "[CLS]", "[SEP]", error));
+}
+
+TEST_F(CustomNodeTokenizer, SplitsWordsIntoSubwords) {
+    EXPECT_THAT(tokenize("Hello, WORLD!"), ElementsAre(4, 9, 5, 10));
+    EXPECT_THAT(tokenize("playing plays"), ElementsAre(6, 7, 6, 8));
+    EXPECT_THAT(tokenize("unaffable"), ElementsAre(12, 13, 14));
+    EXPECT_THAT(tokenize("  \t\n"), ElementsAre());
+}
+
+TEST_F(CustomNodeTokenizer, UnknownWords) {
+    EXPECT_THAT(tokenize("hello playx world"), ElementsAre(4, 1, 5));
+    tokenizer.setMaxCharsPerWord(4);
+    EXPECT_THAT(tokenize("play playing"), ElementsAre(6, 1));
+}
+
+TEST_F(CustomNodeTokenizer, LowerCaseLongAsciiText) {
+    // Longer than single 8 byte block to cover vectorized path
+    EXPECT_THAT(tokenize("HELLO WORLD HELLO WORLD PLAYING"), ElementsAre(4, 5, 4, 5, 6, 7));
+    tokenizer.setLowerCase(false);
+    EXPECT_THAT(tokenize("HELLO hello"), ElementsAre(1, 4));
+}
+
+TEST_F(CustomNodeTokenizer, MultibyteCharacters) {
+    // CJK characters are tokenized separately
+    EXPECT_THAT(tokenize("hello\xe4\xb8\xad\xe4\xb8\xadworld"), ElementsAre(4, 11, 11, 5));
+    EXPECT_THAT(tokenize("caf\xc3\xa9 hello"), ElementsAre(1, 4));
+}
+
+TEST_F(CustomNodeTokenizer, InvalidUtf8) {
+    std::vector<token_id_t> ids;
+    for (const std::string text : {"hello \xc3", "\xff world", "hello \xe4\x41\xad"}) {
+        EXPECT_FALSE(tokenizer.tokenize(reinterpret_cast<const uint8_t*>(text.data()), text.size(), ids)) << text;
+    }
+}
+
+TEST_F(CustomNodeTokenizer, TruncateLongestFirst) {
+    std::vector<token_id_t> first{1, 2, 3, 4, 5, 6};
+    std::vector<token_id_t> second{1, 2, 3};
+    WordpieceTokenizer::truncate(first, &second, 10);
+    EXPECT_EQ(first.size(), 4);
+    EXPECT_EQ(second.size(), 3);
+    WordpieceTokenizer::truncate(first, nullptr, 4);
+    EXPECT_THAT(first, ElementsAre(1, 2));
+}
@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../deserialization_thread_pool.hpp"
+
+using namespace ovms;
+
+class DeserializationThreadPoolTest : public ::testing::Test {
+protected:
+    DeserializationThreadPool pool;
+    std::mutex mtx;
+    std::set<std::thread::id> threadIds;
+    std::vector<int> calls;
+
+    void SetUp() override {
+        calls.assign(6, 0);
+    }
+
+    void run(const std::vector<size_t>& sizes) {
+        pool.parallelFor(
+            sizes.size(),
+            [&sizes](size_t i) { return sizes[i]; },
+            [this](size_t i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                std::lock_guard<std::mutex> lock(mtx);
+                threadIds.insert(std::this_thread::get_id());
+                calls[i]++;
+            });
+    }
+};
+
+TEST_F(DeserializationThreadPoolTest, WithoutThreadsRunsOnCallingThread) {
+    run({100, 100, 100, 100, 100, 100});
+    EXPECT_EQ(calls, std::vector<int>(6, 1));
+    ASSERT_EQ(threadIds.size(), 1);
+    EXPECT_EQ(*threadIds.begin(), std::this_thread::get_id());
+}
+
+TEST_F(DeserializationThreadPoolTest, SingleLargeInputRunsOnCallingThread) {
+    pool.start(4, 50);
+    run({10, 100, 10, 10, 10, 10});
+    EXPECT_EQ(calls, std::vector<int>(6, 1));
+    ASSERT_EQ(threadIds.size(), 1);
+    EXPECT_EQ(*threadIds.begin(), std::this_thread::get_id());
+}
+
+TEST_F(DeserializationThreadPoolTest, LargeInputsRunInParallel) {
+    pool.start(4, 50);
+    run({100, 100, 10, 100, 100, 10});
+    EXPECT_EQ(calls, std::vector<int>(6, 1));
+    EXPECT_GT(threadIds.size(), 1);
+    EXPECT_EQ(threadIds.count(std::this_thread::get_id()), 1);
+}
+
+TEST_F(DeserializationThreadPoolTest, WorkerExceptionIsRethrownAfterAllInputsFinished) {
+    pool.start(2, 50);
+    std::atomic<int> finished{0};
+    EXPECT_THROW(pool.parallelFor(
+                     4,
+                     [](size_t) { return 100; },
+                     [&finished](size_t i) {
+                         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                         finished++;
+                         if (i == 2) {
+                             throw std::runtime_error("deserialization failed");
+                         }
+                     }),
+        std::runtime_error);
+    EXPECT_EQ(finished, 4);
+}
+
+TEST_F(DeserializationThreadPoolTest, StopDisablesParallelism) {
+    pool.start(2, 50);
+    EXPECT_EQ(pool.getThreadsCount(), 2);
+    EXPECT_EQ(pool.getThresholdBytes(), 50);
+    pool.stop();
+    EXPECT_EQ(pool.getThreadsCount(), 0);
+    run({100, 100, 100, 100, 100, 100});
+    EXPECT_EQ(calls, std::vector<int>(6, 1));
+    EXPECT_EQ(threadIds.size(), 1);
+}
+
+TEST_F(DeserializationThreadPoolTest, RequestsRacingWithStopAreCompleted) {
+    pool.start(2, 50);
+    const size_t requestThreadsCount = 4;
+    const size_t requestsPerThread = 50;
+    std::atomic<size_t> finished{0};
+    std::vector<std::thread> requestThreads;
+    for (size_t t = 0; t < requestThreadsCount; t++) {
+        requestThreads.emplace_back([this, &finished]() {
+            for (size_t r = 0; r < requestsPerThread; r++) {
+                pool.parallelFor(
+                    4,
+                    [](size_t) { return 100; },
+                    [&finished](size_t) { finished++; });
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pool.stop();
+    for (auto& thread : requestThreads) {
+        thread.join();
+    }
+    EXPECT_EQ(finished, requestThreadsCount * requestsPerThread * 4);
+    EXPECT_EQ(pool.getThreadsCount(), 0);
+}
@@ -16,6 +16,7 @@
 #include <array>
 #include <functional>
 #include <limits>
+#include <map>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -1874,6 +1875,50 @@ TEST_F(EnsembleFlowCustomNodeAndDemultiplexerLoadConfigThenExecuteTest, Differen
     EXPECT_EQ(output->getShape(), Shape({4, 1, 10}));
 }
 
+TEST_F(EnsembleFlowCustomNodeAndDemultiplexerLoadConfigThenExecuteTest, DifferentOpsCustomNodeThenDummyEmitsPartialResults) {
+    std::unique_ptr<Pipeline> pipeline;
+    std::vector<float> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<float> factors{1, 3, 2, 2};  // add/sub/multiply/divide
+    this->prepareRequest(request, input, differentOpsInputName);
+    this->prepareRequest(request, factors, differentOpsFactorsName);
+    this->loadConfiguration(pipelineCustomNodeDifferentOperationsThenDummyConfig);
+    ASSERT_EQ(manager.createPipeline(pipeline, pipelineName, &request, &response), StatusCode::OK);
+    std::map<session_id_t, PredictResponse> partialResponses;
+    static_cast<ExitNode<PredictResponse>&>(pipeline->getExit()).setPartialResultsCallback([&partialResponses](PredictResponse& partialResponse, session_id_t shardId) -> Status {
+        EXPECT_TRUE(partialResponses.find(shardId) == partialResponses.end()) << shardId;
+        partialResponses[shardId] = partialResponse;
+        return StatusCode::OK;
+    });
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    std::vector<float> expectedOutput(4 * DUMMY_MODEL_OUTPUT_SIZE);
+    prepareDifferentOpsExpectedOutput(expectedOutput, input, factors);
+    std::transform(expectedOutput.begin(), expectedOutput.end(), expectedOutput.begin(),
+        [](float f) -> float { return f + 1; });
+    this->checkResponse("pipeline_output", response, expectedOutput, {4, 1, 10});
+
+    ASSERT_EQ(partialResponses.size(), 4);
+    for (session_id_t shardId = 0; shardId < 4; ++shardId) {
+        std::vector<float> expectedShardOutput(
+            expectedOutput.begin() + shardId * DUMMY_MODEL_OUTPUT_SIZE,
+            expectedOutput.begin() + (shardId + 1) * DUMMY_MODEL_OUTPUT_SIZE);
+        this->checkResponse("pipeline_output", partialResponses[shardId], expectedShardOutput, {1, 10});
+    }
+}
+
+TEST_F(EnsembleFlowCustomNodeAndDemultiplexerLoadConfigThenExecuteTest, PartialResultsCallbackFailureAbortsPipeline) {
+    std::unique_ptr<Pipeline> pipeline;
+    std::vector<float> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<float> factors{1, 3, 2, 2};  // add/sub/multiply/divide
+    this->prepareRequest(request, input, differentOpsInputName);
+    this->prepareRequest(request, factors, differentOpsFactorsName);
+    this->loadConfiguration(pipelineCustomNodeDifferentOperationsThenDummyConfig);
+    ASSERT_EQ(manager.createPipeline(pipeline, pipelineName, &request, &response), StatusCode::OK);
+    static_cast<ExitNode<PredictResponse>&>(pipeline->getExit()).setPartialResultsCallback([](PredictResponse& partialResponse, session_id_t shardId) -> Status {
+        return StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED;
+    });
+    EXPECT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::PIPELINE_PARTIAL_RESULT_SEND_FAILED);
+}
+
 static const char* pipelineCustomNodeDifferentOperations2OutputsConfig = R"(
 {
     "custom_node_library_config_list": [
@@ -16,12 +16,15 @@
 #include <cstdio>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <stdlib.h>
 
 #include "../binaryutils.hpp"
+#include "../condition_node.hpp"
 #include "../dl_node.hpp"
 #include "../entry_node.hpp"
 #include "../exit_node.hpp"
@@ -31,6 +34,7 @@
 #include "../model_metric_reporter.hpp"
 #include "../modelconfig.hpp"
 #include "../modelinstance.hpp"
+#include "../nodecondition.hpp"
 #include "../pipeline.hpp"
 #include "../pipeline_factory.hpp"
 #include "../pipelinedefinition.hpp"
@@ -1684,6 +1688,183 @@ TEST_F(EnsembleFlowTest, OrderOfScheduling) {
     */
 }
 
+class DLNodeCountingExecutions : public DLNode {
+    int& executions;
+
+public:
+    DLNodeCountingExecutions(const std::string& nodeName, const std::string& modelName, std::optional<model_version_t> modelVersion,
+        ModelManager& modelManager, int& executions) :
+        DLNode(nodeName, modelName, modelVersion, modelManager),
+        executions(executions) {}
+    ovms::Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override {
+        executions++;
+        return DLNode::execute(sessionId, notifyEndQueue);
+    }
+};
+
+static NodeCondition createMaxGreaterThanCondition(const std::string& inputName, double threshold) {
+    NodeCondition condition;
+    condition.inputName = inputName;
+    condition.reduction = ConditionReduction::MAX;
+    condition.op = ConditionOperator::GREATER;
+    condition.threshold = threshold;
+    return condition;
+}
+
+class EnsembleFlowConditionTest : public EnsembleFlowTest {
+protected:
+    const std::string unconditionalOutputName = "unconditional_dummy_output";
+    int conditionalNodeExecutions = 0;
+
+    // Nodes
+    // request  condition_node  conditional_node  response
+    //  O---------->O-------------->O------------->O
+    //   \                                        /
+    //    \---------->O unconditional_node ------/
+    Status executeConditionalPipeline(ModelManager& manager, double threshold) {
+        const tensor_map_t inputsInfo{{customPipelineInputName, dagDummyModelInputTensorInfo}};
+        auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+        const tensor_map_t outputsInfo{
+            {customPipelineOutputName, dagDummyModelOutputTensorInfo},
+            {unconditionalOutputName, std::make_shared<ovms::TensorInfo>(unconditionalOutputName, ovms::Precision::FP32, DUMMY_MODEL_SHAPE, Layout{"NC"})}};
+        auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo);
+        auto condition_node = std::make_unique<ConditionNode>("condition_node", createMaxGreaterThanCondition("input", threshold),
+            std::unordered_map<std::string, std::string>{{"passed", "input"}});
+        auto conditional_node = std::make_unique<DLNodeCountingExecutions>("conditional_node", dummyModelName, requestedModelVersion, manager, conditionalNodeExecutions);
+        auto unconditional_node = std::make_unique<DLNode>("unconditional_node", dummyModelName, requestedModelVersion, manager);
+
+        Pipeline pipeline(*input_node, *output_node, *this->reporter);
+        pipeline.connect(*input_node, *condition_node, {{customPipelineInputName, "input"}});
+        pipeline.connect(*condition_node, *conditional_node, {{"passed", DUMMY_MODEL_INPUT_NAME}});
+        pipeline.connect(*conditional_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}});
+        pipeline.connect(*input_node, *unconditional_node, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}});
+        pipeline.connect(*unconditional_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, unconditionalOutputName}});
+
+        pipeline.push(std::move(input_node));
+        pipeline.push(std::move(output_node));
+        pipeline.push(std::move(condition_node));
+        pipeline.push(std::move(conditional_node));
+        pipeline.push(std::move(unconditional_node));
+        return pipeline.execute(DEFAULT_TEST_CONTEXT);
+    }
+
+    std::vector<NodeInfo> createConditionalPipelineNodeInfos(const NodeCondition& condition, const std::unordered_map<std::string, std::string>& conditionOutputs = {{"passed", "input"}}) {
+        return {
+            {NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {{customPipelineInputName, customPipelineInputName}}},
+            {NodeKind::CONDITION, "condition_node", "", std::nullopt, conditionOutputs, std::nullopt, {}, {}, {}, condition},
+            {NodeKind::DL, "dummy_node", "dummy", std::nullopt, {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_OUTPUT_NAME}}},
+            {NodeKind::EXIT, EXIT_NODE_NAME},
+        };
+    }
+
+    pipeline_connections_t createConditionalPipelineConnections() {
+        pipeline_connections_t connections;
+        connections["condition_node"] = {
+            {ENTRY_NODE_NAME, {{customPipelineInputName, "input"}}}};
+        connections["dummy_node"] = {
+            {"condition_node", {{"passed", DUMMY_MODEL_INPUT_NAME}}}};
+        connections[EXIT_NODE_NAME] = {
+            {"dummy_node", {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}}}};
+        return connections;
+    }
+};
+
+TEST_F(EnsembleFlowConditionTest, MetConditionExecutesBranch) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    // Max of request data is 102
+    ASSERT_EQ(executeConditionalPipeline(managerWithDummyModel, 100), StatusCode::OK);
+    EXPECT_EQ(conditionalNodeExecutions, 1);
+    checkDummyResponse(1);
+    ::checkDummyResponse(unconditionalOutputName, requestData, request, response, 1);
+}
+
+TEST_F(EnsembleFlowConditionTest, NotMetConditionSkipsDownstreamDLNodes) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    ASSERT_EQ(executeConditionalPipeline(managerWithDummyModel, 1000), StatusCode::OK);
+    EXPECT_EQ(conditionalNodeExecutions, 0);
+    // Output of skipped branch is empty, independent branch is returned as usual
+    ASSERT_EQ(response.outputs().count(customPipelineOutputName), 1);
+    const auto& skippedOutput = response.outputs().at(customPipelineOutputName);
+    EXPECT_EQ(skippedOutput.dtype(), tensorflow::DataType::DT_FLOAT);
+    EXPECT_TRUE(skippedOutput.tensor_content().empty());
+    ASSERT_EQ(skippedOutput.tensor_shape().dim_size(), 2);
+    EXPECT_EQ(skippedOutput.tensor_shape().dim(0).size(), 0);
+    EXPECT_EQ(skippedOutput.tensor_shape().dim(1).size(), DUMMY_MODEL_OUTPUT_SIZE);
+    ::checkDummyResponse(unconditionalOutputName, requestData, request, response, 1);
+}
+
+TEST_F(EnsembleFlowConditionTest, PipelineDefinitionWithSkippedBranchReturnsEmptyOutput) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    PipelineFactory factory;
+    ASSERT_EQ(factory.createDefinition("conditional_pipeline", createConditionalPipelineNodeInfos(createMaxGreaterThanCondition("input", 1000)), createConditionalPipelineConnections(), managerWithDummyModel), StatusCode::OK);
+    ASSERT_EQ(factory.createDefinition("unconditional_pipeline", createConditionalPipelineNodeInfos(createMaxGreaterThanCondition("input", 100)), createConditionalPipelineConnections(), managerWithDummyModel), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(factory.create(pipeline, "unconditional_pipeline", &request, &response, managerWithDummyModel), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    checkDummyResponse(1);
+
+    response.Clear();
+    ASSERT_EQ(factory.create(pipeline, "conditional_pipeline", &request, &response, managerWithDummyModel), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    ASSERT_EQ(response.outputs().count(customPipelineOutputName), 1);
+    const auto& skippedOutput = response.outputs().at(customPipelineOutputName);
+    EXPECT_TRUE(skippedOutput.tensor_content().empty());
+    ASSERT_EQ(skippedOutput.tensor_shape().dim_size(), 2);
+    EXPECT_EQ(skippedOutput.tensor_shape().dim(0).size(), 0);
+    EXPECT_EQ(skippedOutput.tensor_shape().dim(1).size(), DUMMY_MODEL_OUTPUT_SIZE);
+}
+
+TEST_F(EnsembleFlowConditionTest, PipelineDefinitionConditionInputNotConnectedValidation) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    PipelineFactory factory;
+    EXPECT_EQ(factory.createDefinition("conditional_pipeline", createConditionalPipelineNodeInfos(createMaxGreaterThanCondition("scores", 0)), createConditionalPipelineConnections(), managerWithDummyModel),
+        StatusCode::PIPELINE_CONDITION_INPUT_MISSING);
+}
+
+TEST_F(EnsembleFlowConditionTest, PipelineDefinitionConditionOutputNotInputValidation) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    PipelineFactory factory;
+    EXPECT_EQ(factory.createDefinition("conditional_pipeline", createConditionalPipelineNodeInfos(createMaxGreaterThanCondition("input", 0), {{"passed", "scores"}}), createConditionalPipelineConnections(), managerWithDummyModel),
+        StatusCode::PIPELINE_CONDITION_OUTPUT_NOT_INPUT);
+}
+
+TEST_F(EnsembleFlowConditionTest, PipelineDefinitionDemultiplexingAfterConditionValidation) {
+    // request  condition_node  dummy_node  gather_node  response
+    //  O---------->O-------------->O----------->O--------->O
+    //                          demultiply     gather
+    std::vector<NodeInfo> info{
+        {NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {{customPipelineInputName, customPipelineInputName}}},
+        {NodeKind::CONDITION, "condition_node", "", std::nullopt, {{"passed", "input"}}, std::nullopt, {}, {}, {}, createMaxGreaterThanCondition("input", 0)},
+        {NodeKind::DL, "dummy_node", "dummy", std::nullopt, {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_OUTPUT_NAME}}, 1},
+        {NodeKind::DL, "gather_node", "dummy", std::nullopt, {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_OUTPUT_NAME}}, std::nullopt, {"dummy_node"}},
+        {NodeKind::EXIT, EXIT_NODE_NAME},
+    };
+    auto connections = createConditionalPipelineConnections();
+    connections["gather_node"] = {
+        {"dummy_node", {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_INPUT_NAME}}}};
+    connections[EXIT_NODE_NAME] = {
+        {"gather_node", {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}}}};
+
+    PipelineDefinition pipelineDefinition("conditional_pipeline", info, connections);
+    EXPECT_EQ(pipelineDefinition.validateConditionalBranches(), StatusCode::PIPELINE_CONDITION_SKIPPED_NODE_DEMULTIPLEXING);
+
+    // Same graph without condition node is accepted
+    info[1] = {NodeKind::DL, "condition_node", "dummy", std::nullopt, {{"passed", DUMMY_MODEL_OUTPUT_NAME}}};
+    PipelineDefinition pipelineDefinitionWithoutCondition("pipeline", info, connections);
+    EXPECT_EQ(pipelineDefinitionWithoutCondition.validateConditionalBranches(), StatusCode::OK);
+}
+
 TEST_F(EnsembleFlowTest, FailInDLNodeSetInputsMissingInput) {
     // Most basic configuration, just process single dummy model request
 
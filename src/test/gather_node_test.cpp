@@ -44,6 +44,31 @@ using namespace ovms;
 using testing::ElementsAre;
 using testing::Return;
 
+TEST(NodeInputHandler, InputIsReturnedWithItsSource) {
+    std::vector<float> data{1, 2, 3, 4};
+    ov::Tensor source = createSharedTensor(ov::element::Type_t::f32, {1, 4}, data.data());
+    ov::Tensor view = createSharedTensor(ov::element::Type_t::f32, {1, 2}, data.data() + 2);
+    TensorWithSource withSource(view, source);
+    TensorWithSource withoutSource(source);
+    NodeInputHandler inputHandler(2);
+    ASSERT_EQ(inputHandler.setInput("a", withSource, 0), StatusCode::OK);
+    ASSERT_EQ(inputHandler.setInput("b", withoutSource, 0), StatusCode::OK);
+
+    auto a = inputHandler.getInputWithSource("a");
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(a->getActualTensor().data(), view.data());
+    ASSERT_TRUE(a->hasSource());
+    EXPECT_EQ(a->getSourceTensor().data(), source.data());
+    auto b = inputHandler.getInputWithSource("b");
+    ASSERT_TRUE(b.has_value());
+    EXPECT_EQ(b->getActualTensor().data(), source.data());
+    EXPECT_FALSE(b->hasSource());
+    EXPECT_FALSE(inputHandler.getInputWithSource("c").has_value());
+
+    inputHandler.clearInputs();
+    EXPECT_FALSE(inputHandler.getInputWithSource("a").has_value());
+}
+
 class GatherNodeInputHandlerTest : public ::testing::Test {};
 
 TEST_F(GatherNodeInputHandlerTest, ThreePredecessorNodesWithSubsessionSize2) {
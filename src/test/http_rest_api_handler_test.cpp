@@ -13,6 +13,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <functional>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "../config.hpp"
@@ -998,3 +1004,71 @@ TEST_F(ConfigStatus, configWithPipelines) {
     EXPECT_EQ(expectedJson, response);
     EXPECT_EQ(status, ovms::StatusCode::OK);
 }
+
+static const char* configWith1StatefulDummy = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy",
+                "stateful": true
+            }
+        }
+    ]
+})";
+
+TEST_F(ConfigApi, statefulModelPredictIsNotProcessedAsync) {
+    ovms::Server& ovmsServer = ovms::Server::instance();
+    TestHelper1 t(*this, configWith1StatefulDummy);
+    auto handler = ovms::HttpRestApiHandler(ovmsServer, 10);
+    bool continuationScheduled = false;
+    handler.setContinuationScheduler([&continuationScheduled](std::function<void()> continuation) {
+        continuationScheduled = true;
+        continuation();
+    });
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string response;
+    bool responseDeferred = true;
+    bool callbackCalled = false;
+    std::shared_ptr<const std::string> sharedResponse;
+    // Request without sequence_id and sequence_control_input has to be rejected by stateful validation
+    auto status = handler.processRequest("POST", "/v1/models/dummy:predict",
+        "{\"inputs\": {\"b\": [[0,1,2,3,4,5,6,7,8,9]]}}", &headers, &response, sharedResponse,
+        [&callbackCalled](const ovms::Status& status, std::string& output) {
+            callbackCalled = true;
+        },
+        responseDeferred);
+    EXPECT_EQ(status, ovms::StatusCode::SEQUENCE_ID_NOT_PROVIDED);
+    EXPECT_FALSE(responseDeferred);
+    EXPECT_FALSE(callbackCalled);
+    EXPECT_FALSE(continuationScheduled);
+}
+
+TEST_F(ConfigApi, predictResponseCarriesServedModelVersionHeader) {
+    ovms::Server& ovmsServer = ovms::Server::instance();
+    TestHelper1 t(*this, configWith1Dummy);
+    auto handler = ovms::HttpRestApiHandler(ovmsServer, 10);
+    const std::string requestBody = "{\"inputs\": {\"b\": [[0,1,2,3,4,5,6,7,8,9]]}}";
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string response;
+    ASSERT_EQ(handler.processRequest("POST", "/v1/models/dummy:predict", requestBody, &headers, &response), ovms::StatusCode::OK);
+    ASSERT_EQ(headers.size(), 2);
+    EXPECT_EQ(headers[1], std::make_pair(ovms::MODEL_VERSION_HEADER, std::string("1")));
+
+    handler.setContinuationScheduler([](std::function<void()> continuation) { continuation(); });
+    headers.clear();
+    bool responseDeferred = false;
+    std::promise<ovms::Status> asyncStatus;
+    std::shared_ptr<const std::string> sharedResponse;
+    auto status = handler.processRequest("POST", "/v1/models/dummy:predict", requestBody, &headers, &response, sharedResponse,
+        [&asyncStatus](const ovms::Status& status, std::string& output) {
+            asyncStatus.set_value(status);
+        },
+        responseDeferred);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ASSERT_TRUE(responseDeferred);
+    EXPECT_EQ(asyncStatus.get_future().get(), ovms::StatusCode::OK);
+    ASSERT_EQ(headers.size(), 2);
+    EXPECT_EQ(headers[1], std::make_pair(ovms::MODEL_VERSION_HEADER, std::string("1")));
+}
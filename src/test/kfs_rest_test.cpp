@@ -13,8 +13,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <rapidjson/document.h>
@@ -22,6 +28,7 @@
 #include "../config.hpp"
 #include "../grpcservermodule.hpp"
 #include "../http_rest_api_handler.hpp"
+#include "../numpy_utils.hpp"
 #include "../servablemanagermodule.hpp"
 #include "../server.hpp"
 #include "../version.hpp"
@@ -213,6 +220,61 @@ TEST_F(HttpRestApiHandlerTest, RegexParseInferWithBinaryInputsSizeNotInt) {
     ASSERT_EQ(handler->parseRequestComponents(comp, "POST", request, headers), StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_INVALID);
 }
 
+TEST_F(HttpRestApiHandlerTest, RegexParseModelProfile) {
+    ovms::HttpRequestComponents comp;
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v1/models/dummy/versions/1/profile"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::ModelProfile);
+    ASSERT_EQ(comp.model_version, 1);
+    ASSERT_EQ(comp.model_name, "dummy");
+
+    ovms::HttpRequestComponents getComp;
+    ASSERT_EQ(handler->parseRequestComponents(getComp, "GET", "/v1/models/dummy/profile"), StatusCode::OK);
+    ASSERT_EQ(getComp.type, ovms::ModelProfile);
+    ASSERT_EQ(getComp.model_version, std::nullopt);
+    ASSERT_EQ(getComp.model_name, "dummy");
+}
+
+TEST_F(HttpRestApiHandlerTest, modelProfileRequest) {
+    ovms::HttpRequestComponents comp;
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v1/models/dummy/profile"), StatusCode::OK);
+    std::string response;
+    EXPECT_EQ(handler->dispatchToProcessor("{\"requests\": -1}", &response, comp), StatusCode::PROFILING_INVALID_REQUEST);
+    EXPECT_EQ(handler->dispatchToProcessor("[]", &response, comp), StatusCode::PROFILING_INVALID_REQUEST);
+    ASSERT_EQ(handler->dispatchToProcessor("{\"requests\": 2}", &response, comp), StatusCode::OK);
+    rapidjson::Document doc;
+    doc.Parse(response.c_str());
+    EXPECT_EQ(std::string(doc["state"].GetString()), "IN_PROGRESS");
+    EXPECT_EQ(doc["requested_samples"].GetUint(), 2);
+
+    ovms::HttpRequestComponents inferComp;
+    ASSERT_EQ(handler->parseRequestComponents(inferComp, "POST", "/v2/models/dummy/infer"), StatusCode::OK);
+    std::string inferBody = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,10],\"datatype\":\"FP32\",\"data\":[0,1,2,3,4,5,6,7,8,9]}]}";
+    ovms::HttpRequestComponents getComp;
+    ASSERT_EQ(handler->parseRequestComponents(getComp, "GET", "/v1/models/dummy/profile"), StatusCode::OK);
+    // Samples are profiled in background and requests arriving meanwhile are not sampled
+    for (int i = 0; i < 500; i++) {
+        std::string inferResponse;
+        ASSERT_EQ(handler->dispatchToProcessor(inferBody, &inferResponse, inferComp), StatusCode::OK);
+        ASSERT_EQ(handler->dispatchToProcessor(std::string(), &response, getComp), StatusCode::OK);
+        doc.Parse(response.c_str());
+        if (std::string(doc["state"].GetString()) == "FINISHED") {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(std::string(doc["state"].GetString()), "FINISHED");
+    EXPECT_EQ(doc["collected_samples"].GetUint(), 2);
+    ASSERT_GT(doc["layers"].GetArray().Size(), 0);
+    for (auto& layer : doc["layers"].GetArray()) {
+        EXPECT_EQ(layer["count"].GetUint(), 2);
+        EXPECT_FALSE(std::string(layer["exec_type"].GetString()).empty());
+    }
+
+    ovms::HttpRequestComponents missingComp;
+    ASSERT_EQ(handler->parseRequestComponents(missingComp, "GET", "/v1/models/missing/profile"), StatusCode::OK);
+    EXPECT_EQ(handler->dispatchToProcessor(std::string(), &response, missingComp), StatusCode::MODEL_NAME_MISSING);
+}
+
 TEST_F(HttpRestApiHandlerTest, dispatchMetadata) {
     std::string request = "/v2/models/dummy/versions/1";
     ovms::HttpRequestComponents comp;
@@ -308,6 +370,130 @@ TEST_F(HttpRestApiHandlerTest, inferRequest) {
     }
 }
 
+TEST_F(HttpRestApiHandlerTest, inferRequestAsync) {
+    std::vector<std::thread> continuations;
+    handler->setContinuationScheduler([&continuations](std::function<void()> continuation) {
+        continuations.emplace_back(std::move(continuation));
+    });
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,10],\"datatype\":\"FP32\",\"data\":[0,1,2,3,4,5,6,7,8,9]}], \"id\":\"1\"}";
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string response;
+    std::promise<std::pair<ovms::Status, std::string>> asyncResponse;
+    bool responseDeferred = false;
+    std::shared_ptr<const std::string> sharedResponse;
+    auto status = handler->processRequest("POST", request, request_body, &headers, &response, sharedResponse,
+        [&asyncResponse](const ovms::Status& status, std::string& output) {
+            asyncResponse.set_value({status, output});
+        },
+        responseDeferred);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ASSERT_TRUE(responseDeferred);
+    auto future = asyncResponse.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    auto [asyncStatus, output] = future.get();
+    for (auto& continuation : continuations) {
+        continuation.join();
+    }
+    ASSERT_EQ(asyncStatus, ovms::StatusCode::OK);
+    EXPECT_TRUE(response.empty());
+
+    rapidjson::Document doc;
+    doc.Parse(output.c_str());
+    ASSERT_EQ(doc["model_name"].GetString(), std::string("dummy"));
+    ASSERT_EQ(doc["id"].GetString(), std::string("1"));
+    auto outputData = doc["outputs"].GetArray()[0].GetObject()["data"].GetArray();
+    int i = 1;
+    for (auto& data : outputData) {
+        ASSERT_EQ(data.GetFloat(), i++);
+    }
+}
+
+TEST_F(HttpRestApiHandlerTest, inferRequestAsyncInvalidInputNotDeferred) {
+    handler->setContinuationScheduler([](std::function<void()> continuation) { continuation(); });
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,3],\"datatype\":\"FP32\",\"data\":[0,1,2]}]}";
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string response;
+    bool responseDeferred = true;
+    bool callbackCalled = false;
+    std::shared_ptr<const std::string> sharedResponse;
+    auto status = handler->processRequest("POST", request, request_body, &headers, &response, sharedResponse,
+        [&callbackCalled](const ovms::Status& status, std::string& output) {
+            callbackCalled = true;
+        },
+        responseDeferred);
+    EXPECT_NE(status, ovms::StatusCode::OK);
+    EXPECT_FALSE(responseDeferred);
+    EXPECT_FALSE(callbackCalled);
+}
+
+TEST_F(HttpRestApiHandlerTest, RegexParseInferWithNumpyContentTypes) {
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    ovms::HttpRequestComponents comp;
+    std::vector<std::pair<std::string, std::string>> headers{{"content-type", "application/x-npy"}, {"Accept", "application/x-npz; q=1"}};
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", request, headers), StatusCode::OK);
+    EXPECT_EQ(comp.request_format, ovms::NumpyFormat::NPY);
+    EXPECT_EQ(comp.response_format, ovms::NumpyFormat::NPZ);
+
+    ovms::HttpRequestComponents jsonComp;
+    headers = {{"Content-Type", "application/json"}};
+    ASSERT_EQ(handler->parseRequestComponents(jsonComp, "POST", request, headers), StatusCode::OK);
+    EXPECT_EQ(jsonComp.request_format, ovms::NumpyFormat::NONE);
+    EXPECT_EQ(jsonComp.response_format, ovms::NumpyFormat::NONE);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferRequestNumpy) {
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    std::vector<float> data{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::string request_body;
+    ASSERT_EQ(ovms::makeNpy(ovms::Precision::FP32, {1, 10}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)), request_body), StatusCode::OK);
+    std::vector<std::pair<std::string, std::string>> headers{{"Content-Type", "application/x-npy"}, {"Accept", "application/x-npy"}};
+    std::string response;
+    ASSERT_EQ(handler->processRequest("POST", request, request_body, &headers, &response), StatusCode::OK);
+    ASSERT_EQ(headers.size(), 1);
+    EXPECT_EQ(headers[0].second, "application/x-npy");
+
+    ovms::NumpyArray output;
+    ASSERT_EQ(ovms::parseNpy(response, output), StatusCode::OK);
+    EXPECT_EQ(output.precision, ovms::Precision::FP32);
+    EXPECT_EQ(output.shape, ovms::shape_t({1, 10}));
+    ASSERT_EQ(output.data.size(), 10 * sizeof(float));
+    for (size_t i = 0; i < 10; i++) {
+        EXPECT_EQ(reinterpret_cast<const float*>(output.data.data())[i], i + 1);
+    }
+}
+
+TEST_F(HttpRestApiHandlerTest, inferRequestNpzWithJsonResponse) {
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    std::vector<float> data(10, 1);
+    std::string npy, request_body;
+    ASSERT_EQ(ovms::makeNpy(ovms::Precision::FP32, {1, 10}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)), npy), StatusCode::OK);
+    ASSERT_EQ(ovms::makeNpz({{"b", npy}}, request_body), StatusCode::OK);
+    std::vector<std::pair<std::string, std::string>> headers{{"Content-Type", "application/x-npz"}};
+    std::string response;
+    ASSERT_EQ(handler->processRequest("POST", request, request_body, &headers, &response), StatusCode::OK);
+    EXPECT_EQ(headers[0].second, "application/json");
+    rapidjson::Document doc;
+    doc.Parse(response.c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    EXPECT_EQ(doc["outputs"].GetArray()[0].GetObject()["data"].GetArray()[0].GetFloat(), 2);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferRequestNumpyValidatedAgainstModel) {
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    std::vector<int32_t> data(10, 1);
+    std::string request_body;
+    ASSERT_EQ(ovms::makeNpy(ovms::Precision::I32, {1, 10}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t)), request_body), StatusCode::OK);
+    std::vector<std::pair<std::string, std::string>> headers{{"Content-Type", "application/x-npy"}, {"Accept", "application/x-npy"}};
+    std::string response;
+    EXPECT_EQ(handler->processRequest("POST", request, request_body, &headers, &response), StatusCode::INVALID_PRECISION);
+    EXPECT_EQ(headers[0].second, "application/json");
+
+    headers = {{"Content-Type", "application/x-npy"}};
+    EXPECT_EQ(handler->processRequest("POST", request, "not numpy", &headers, &response), StatusCode::NUMPY_INVALID_FORMAT);
+}
+
 TEST_F(HttpRestApiHandlerTest, inferPreprocess) {
     std::string request_body("{\"inputs\":[{\"name\":\"b\",\"shape\":[1,10],\"datatype\":\"FP32\",\"data\":[0,1,2,3,4,5,6,7,8,9]}],\"parameters\":{\"binary_data_output\":1, \"bool_test\":true, \"string_test\":\"test\"}}");
 
@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../kfs_streamed_upload.hpp"
+
+using namespace ovms;
+
+class KFSStreamedUploadTest : public ::testing::Test {
+protected:
+    tensor_map_t inputsInfo;
+    ::inference::ModelInferRequest header;
+    ::inference::ModelInferRequest request;
+
+    void SetUp() override {
+        inputsInfo["a"] = std::make_shared<TensorInfo>("a", Precision::FP32, Shape{1, 4}, Layout{"NC"});
+        inputsInfo["b"] = std::make_shared<TensorInfo>("b", Precision::U8, Shape{1, 3}, Layout{"NC"});
+        header.set_model_name("model");
+        addInput("a", "FP32", {1, 4});
+        addInput("b", "UINT8", {1, 3});
+    }
+
+    void addInput(const std::string& name, const std::string& datatype, std::initializer_list<int64_t> shape) {
+        auto input = header.add_inputs();
+        input->set_name(name);
+        input->set_datatype(datatype);
+        for (auto dim : shape) {
+            input->add_shape(dim);
+        }
+    }
+
+    static ::inference::ModelInferUploadChunk makeChunk(uint32_t inputIndex, uint64_t offset, const std::string& data) {
+        ::inference::ModelInferUploadChunk chunk;
+        chunk.set_input_index(inputIndex);
+        chunk.set_offset(offset);
+        chunk.set_data(data);
+        return chunk;
+    }
+};
+
+TEST_F(KFSStreamedUploadTest, InterleavedChunksAssembleRawInputContents) {
+    KFSStreamedRequestAssembler assembler(request);
+    ASSERT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::OK);
+    EXPECT_EQ(assembler.getRemainingBytes(), 16 + 3);
+    ASSERT_EQ(request.raw_input_contents_size(), 2);
+    EXPECT_EQ(assembler.addChunk(makeChunk(0, 0, std::string(10, 'x'))), StatusCode::OK);
+    EXPECT_EQ(assembler.addChunk(makeChunk(1, 0, "abc")), StatusCode::OK);
+    EXPECT_FALSE(assembler.isComplete());
+    EXPECT_EQ(assembler.addChunk(makeChunk(0, 10, std::string(6, 'y'))), StatusCode::OK);
+    EXPECT_TRUE(assembler.isComplete());
+    EXPECT_EQ(request.model_name(), "model");
+    EXPECT_EQ(request.raw_input_contents(0), std::string(10, 'x') + std::string(6, 'y'));
+    EXPECT_EQ(request.raw_input_contents(1), "abc");
+}
+
+TEST_F(KFSStreamedUploadTest, ChunkBeforeHeaderIsRejected) {
+    KFSStreamedRequestAssembler assembler(request);
+    EXPECT_EQ(assembler.addChunk(makeChunk(0, 0, "abcd")), StatusCode::STREAMED_UPLOAD_HEADER_MISSING);
+}
+
+TEST_F(KFSStreamedUploadTest, InvalidChunksAreRejected) {
+    KFSStreamedRequestAssembler assembler(request);
+    ASSERT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::OK);
+    EXPECT_EQ(assembler.addChunk(makeChunk(2, 0, "abc")), StatusCode::STREAMED_UPLOAD_INVALID_CHUNK);
+    EXPECT_EQ(assembler.addChunk(makeChunk(1, 1, "abc")), StatusCode::STREAMED_UPLOAD_INVALID_CHUNK);
+    EXPECT_EQ(assembler.addChunk(makeChunk(1, 0, "abcd")), StatusCode::STREAMED_UPLOAD_INVALID_CHUNK);
+    EXPECT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::STREAMED_UPLOAD_INVALID_CHUNK);
+}
+
+TEST_F(KFSStreamedUploadTest, HeaderIsValidatedAgainstServableInputs) {
+    {
+        KFSStreamedRequestAssembler assembler(request);
+        header.mutable_inputs(0)->set_datatype("INT32");
+        EXPECT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::INVALID_PRECISION);
+        EXPECT_FALSE(assembler.hasHeader());
+        header.mutable_inputs(0)->set_datatype("FP32");
+    }
+    {
+        KFSStreamedRequestAssembler assembler(request);
+        header.mutable_inputs(1)->set_name("c");
+        EXPECT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::INVALID_MISSING_INPUT);
+        header.mutable_inputs(1)->set_name("b");
+    }
+    {
+        KFSStreamedRequestAssembler assembler(request);
+        header.mutable_inputs(1)->set_shape(1, -3);
+        EXPECT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::INVALID_SHAPE);
+        header.mutable_inputs(1)->set_shape(1, 3);
+    }
+    {
+        KFSStreamedRequestAssembler assembler(request);
+        header.mutable_inputs(1)->mutable_contents()->add_uint_contents(1);
+        EXPECT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::STREAMED_UPLOAD_INVALID_CHUNK);
+        header.mutable_inputs(1)->clear_contents();
+    }
+    {
+        KFSStreamedRequestAssembler assembler(request);
+        header.add_raw_input_contents();
+        EXPECT_EQ(assembler.setHeader(header, inputsInfo, 1024), StatusCode::STREAMED_UPLOAD_INVALID_CHUNK);
+    }
+}
+
+TEST_F(KFSStreamedUploadTest, DeclaredSizeAboveLimitIsRejected) {
+    KFSStreamedRequestAssembler assembler(request);
+    EXPECT_EQ(assembler.setHeader(header, inputsInfo, 18), StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED);
+    EXPECT_EQ(assembler.setHeader(header, inputsInfo, 19), StatusCode::OK);
+}
+
+TEST_F(KFSStreamedUploadTest, OverflowingShapeIsRejected) {
+    KFSStreamedRequestAssembler assembler(request);
+    header.mutable_inputs(0)->set_shape(0, INT64_MAX);
+    header.mutable_inputs(0)->set_shape(1, INT64_MAX);
+    EXPECT_EQ(assembler.setHeader(header, inputsInfo, UINT64_MAX), StatusCode::STREAMED_UPLOAD_SIZE_EXCEEDED);
+}
+
+TEST_F(KFSStreamedUploadTest, BufferIsReservedOnceWithDeclaredSize) {
+    const int64_t declaredElements = 1024 * 1024;
+    const size_t declaredBytes = declaredElements * sizeof(float);
+    header.mutable_inputs(0)->set_shape(1, declaredElements);
+    KFSStreamedRequestAssembler assembler(request);
+    ASSERT_EQ(assembler.setHeader(header, inputsInfo, std::numeric_limits<uint64_t>::max()), StatusCode::OK);
+    EXPECT_EQ(assembler.getRemainingBytes(), declaredBytes + 3);
+    // Header alone does not allocate buffers
+    EXPECT_LT(request.raw_input_contents(0).capacity(), 1024);
+
+    const size_t chunkBytes = 64 * 1024;
+    ASSERT_EQ(assembler.addChunk(makeChunk(0, 0, std::string(chunkBytes, 'x'))), StatusCode::OK);
+    const char* data = request.raw_input_contents(0).data();
+    EXPECT_GE(request.raw_input_contents(0).capacity(), declaredBytes);
+    for (size_t offset = chunkBytes; offset < declaredBytes; offset += chunkBytes) {
+        ASSERT_EQ(assembler.addChunk(makeChunk(0, offset, std::string(chunkBytes, 'y'))), StatusCode::OK);
+        ASSERT_LE(request.raw_input_contents(0).capacity(), declaredBytes);
+        ASSERT_EQ(request.raw_input_contents(0).data(), data);
+    }
+    EXPECT_EQ(request.raw_input_contents(0).size(), declaredBytes);
+    EXPECT_EQ(request.raw_input_contents(0).substr(0, chunkBytes), std::string(chunkBytes, 'x'));
+    EXPECT_EQ(assembler.getRemainingBytes(), 3);
+}
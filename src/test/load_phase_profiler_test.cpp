@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../load_phase_profiler.hpp"
+
+using namespace ovms;
+
+class LoadPhaseProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        LoadPhaseProfiler::instance().reset();
+    }
+    void TearDown() override {
+        LoadPhaseProfiler::instance().reset();
+    }
+};
+
+TEST_F(LoadPhaseProfilerTest, RecordAccumulatesPerPhase) {
+    auto& profiler = LoadPhaseProfiler::instance();
+    profiler.record(LoadPhase::COMPILE, 2.0);
+    profiler.record(LoadPhase::COMPILE, 5.0);
+    profiler.record(LoadPhase::READ, 1.0);
+    auto compile = profiler.getStatistics(LoadPhase::COMPILE);
+    EXPECT_EQ(compile.count, 2);
+    EXPECT_DOUBLE_EQ(compile.totalMs, 7.0);
+    EXPECT_DOUBLE_EQ(compile.maxMs, 5.0);
+    EXPECT_EQ(profiler.getStatistics(LoadPhase::READ).count, 1);
+    EXPECT_EQ(profiler.getStatistics(LoadPhase::RESHAPE).count, 0);
+
+    profiler.reset();
+    EXPECT_EQ(profiler.getStatistics(LoadPhase::COMPILE).count, 0);
+    EXPECT_DOUBLE_EQ(profiler.getStatistics(LoadPhase::COMPILE).totalMs, 0);
+}
+
+TEST_F(LoadPhaseProfilerTest, ScopedTimerRecordsElapsedTime) {
+    {
+        ScopedLoadPhaseTimer timer(LoadPhase::PIPELINE_VALIDATION);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    auto statistics = LoadPhaseProfiler::instance().getStatistics(LoadPhase::PIPELINE_VALIDATION);
+    EXPECT_EQ(statistics.count, 1);
+    EXPECT_GE(statistics.totalMs, 5.0);
+}
+
+TEST(LoadPhase, ToString) {
+    EXPECT_STREQ(toString(LoadPhase::INFER_REQUESTS_CREATION), "infer_requests_creation");
+    EXPECT_STREQ(toString(LoadPhase::CUSTOM_NODE_LIBRARY_LOADING), "custom_node_library_loading");
+}
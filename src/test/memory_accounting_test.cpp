@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "../memory_accounting.hpp"
+
+using namespace ovms;
+
+namespace {
+std::shared_ptr<ov::Model> createAddModel() {
+    auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 100});
+    auto constant = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 100}, std::vector<float>(100, 1.0f));
+    auto add = std::make_shared<ov::opset8::Add>(input, constant);
+    add->set_friendly_name("add");
+    return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input}, "add_model");
+}
+}  // namespace
+
+TEST(MemoryAccounting, ProcessRss) {
+    EXPECT_GT(getProcessRssBytes(), 0);
+}
+
+TEST(MemoryAccounting, ModelWeights) {
+    EXPECT_EQ(getModelWeightsBytes(nullptr), 0);
+    EXPECT_EQ(getModelWeightsBytes(createAddModel()), 100 * sizeof(float));
+}
+
+TEST(MemoryAccounting, InferRequestTensors) {
+    ov::Core ieCore;
+    auto compiledModel = ieCore.compile_model(createAddModel(), "CPU");
+    auto inferRequest = compiledModel.create_infer_request();
+    // One input and one output of 100 floats
+    EXPECT_EQ(getInferRequestTensorsBytes(inferRequest, compiledModel), 2 * 100 * sizeof(float));
+}
+
+TEST(MemoryAccounting, CompiledModelProbeMeasuresRssGrowth) {
+    ov::Core ieCore;
+    CompiledModelMemoryProbe probe(ieCore, "CPU");
+    std::vector<char> allocation(16 * 1024 * 1024, 1);
+    EXPECT_EQ(allocation.back(), 1);
+    EXPECT_GT(probe.getAllocatedBytes(), 0);
+}
@@ -99,6 +99,7 @@ static const char* modelMetricsChangedConfig = R"(
             "metrics":
             {
                 "enable" : true,
+                "scrape_interval_ms": 500,
                 "metrics_list": ["ovms_requests_success", "ovms_infer_req_queue_size"]
             }
         }
@@ -144,6 +145,7 @@ TEST_F(MetricsConfigTest, DefaultValues) {
     auto& metricConfig = static_cast<const PublicMetricConfig&>(manager.getMetricConfig());
     ASSERT_EQ(metricConfig.metricsEnabled, false);
     ASSERT_EQ(metricConfig.endpointsPath, "/metrics");
+    ASSERT_EQ(metricConfig.scrapeIntervalMs, DEFAULT_METRICS_SCRAPE_INTERVAL_MS);
     ASSERT_EQ(metricConfig.getEnabledFamiliesList().size(), 0);
 }
 
@@ -161,6 +163,7 @@ TEST_F(MetricsConfigTest, ChangedValues) {
     ASSERT_EQ(metricConfig.metricsEnabled, true);
 
     // ASSERT_EQ(metricConfig.endpointsPath, "/newmetrics");
+    ASSERT_EQ(metricConfig.scrapeIntervalMs, 500);
     ASSERT_TRUE(metricConfig.isFamilyEnabled("ovms_requests_success"));
     ASSERT_TRUE(metricConfig.isFamilyEnabled("ovms_infer_req_queue_size"));
     ASSERT_EQ(metricConfig.isFamilyEnabled("ovms_requests_fail"), false);
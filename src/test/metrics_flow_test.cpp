@@ -86,7 +86,13 @@ const char* pipelineDummyDemux = R"({
                 "ovms_request_time_us",
                 "ovms_streams",
                 "ovms_inference_time_us",
-                "ovms_wait_for_infer_req_time_us"
+                "ovms_wait_for_infer_req_time_us",
+                "ovms_infer_req_waiting",
+                "ovms_infer_req_busy_time_us",
+                "ovms_inference_batch_size",
+                "ovms_dag_executor_threads",
+                "ovms_dag_deferred_node_sessions",
+                "ovms_hw_events"
             ]
         }
     },
@@ -257,6 +263,29 @@ TEST_F(MetricFlowTest, GrpcPredict) {
 
     EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_infer_req_queue_size{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(2)));
     EXPECT_THAT(server.collect(), Not(HasSubstr(std::string{"ovms_infer_req_queue_size{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
+
+    EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_infer_req_waiting{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(0)));
+    EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_infer_req_busy_time_us{name=\""} + modelName + std::string{"\",version=\"1\"} "}));
+    EXPECT_THAT(server.collect(), Not(HasSubstr(std::string{"ovms_infer_req_busy_time_us{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
+
+    // Demultiplexer splits DAG requests into batch 1 inferences
+    EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_inference_batch_size_bucket{name=\""} + modelName + std::string{"\",version=\"1\",le=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests + numberOfSuccessRequests)));
+    EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_inference_batch_size_count{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests + numberOfSuccessRequests)));
+
+    EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_dag_executor_threads{name=\""} + dagName + std::string{"\",version=\"1\"} "} + std::to_string(0)));
+    EXPECT_THAT(server.collect(), HasSubstr(std::string{"ovms_dag_deferred_node_sessions{name=\""} + dagName + std::string{"\",version=\"1\"} "} + std::to_string(0)));
+    EXPECT_THAT(server.collect(), Not(HasSubstr(std::string{"ovms_dag_executor_threads{name=\""} + modelName + std::string{"\",version=\"1\"} "})));
+
+    // Values depend on perf_event_open availability on the host
+    for (const std::string event : {"cycles", "instructions", "llc_misses", "context_switches"}) {
+        for (const std::string stage : {"deserialize", "infer", "serialize"}) {
+            EXPECT_THAT(server.collect(), HasSubstr("ovms_hw_events{event=\"" + event + "\",name=\"" + modelName + "\",stage=\"" + stage + "\",version=\"1\"} "));
+        }
+        for (const std::string stage : {"deserialize", "dag_node", "serialize"}) {
+            EXPECT_THAT(server.collect(), HasSubstr("ovms_hw_events{event=\"" + event + "\",name=\"" + dagName + "\",stage=\"" + stage + "\",version=\"1\"} "));
+        }
+        EXPECT_THAT(server.collect(), Not(HasSubstr("ovms_hw_events{event=\"" + event + "\",name=\"" + dagName + "\",stage=\"infer\"")));
+    }
 }
 
 TEST_F(MetricFlowTest, GrpcGetModelMetadata) {
@@ -13,7 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <chrono>
 #include <future>
+#include <string>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -25,6 +27,7 @@
 #include "../metric.hpp"
 #include "../metric_family.hpp"
 #include "../metric_registry.hpp"
+#include "../metric_snapshot_collector.hpp"
 
 using namespace ovms;
 
@@ -969,3 +972,121 @@ TEST(MetricsManyOps, MultipleThreads) {
         }
     }
 }
+
+TEST(Metrics, CollectIntoBufferMatchesTextCollect) {
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("counter_name", "desc")->addMetric({{"label", "value"}});
+    auto histogram = registry.createFamily<MetricHistogram>("histogram_name", "desc")->addMetric({{"label", "value"}}, {1.0, 10.0});
+    counter->increment(3);
+    histogram->observe(5.0);
+    std::string buffer(1024, 'x');
+    registry.collect(buffer, MetricExpositionFormat::TEXT);
+    EXPECT_EQ(buffer, registry.collect());
+}
+
+TEST(Metrics, CollectProtobufDelimited) {
+    MetricRegistry registry;
+    auto gauge = registry.createFamily<MetricGauge>("g", "d")->addMetric({{"l", "v"}});
+    gauge->set(1.0);
+    std::string buffer;
+    registry.collect(buffer, MetricExpositionFormat::PROTOBUF_DELIMITED);
+    // MetricFamily{name: "g", help: "d", type: GAUGE, metric: {label: {name: "l", value: "v"}, gauge: {value: 1.0}}}
+    const std::string expected{
+        "\x1D"
+        "\x0A\x01g"
+        "\x12\x01"
+        "d"
+        "\x18\x01"
+        "\x22\x13"
+        "\x0A\x06\x0A\x01l\x12\x01v"
+        "\x12\x09\x09\x00\x00\x00\x00\x00\x00\xF0\x3F",
+        30};
+    EXPECT_EQ(buffer, expected);
+}
+
+TEST(Metrics, ExpositionFormatFromAcceptHeader) {
+    EXPECT_EQ(getMetricExpositionFormat(""), MetricExpositionFormat::TEXT);
+    EXPECT_EQ(getMetricExpositionFormat("text/plain;version=0.0.4;q=0.5,*/*;q=0.1"), MetricExpositionFormat::TEXT);
+    EXPECT_EQ(getMetricExpositionFormat("application/vnd.google.protobuf;proto=io.prometheus.client.MetricFamily;encoding=delimited;q=0.7,text/plain;version=0.0.4;q=0.3"),
+        MetricExpositionFormat::PROTOBUF_DELIMITED);
+    EXPECT_EQ(getMetricContentType(MetricExpositionFormat::PROTOBUF_DELIMITED), METRICS_PROTOBUF_CONTENT_TYPE);
+}
+
+class MetricsSnapshotCollectorTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(MetricsSnapshotCollectorTest, RegeneratesOnlyStaleSnapshot) {
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("name", "desc")->addMetric({{"label", "value"}});
+    MetricSnapshotCollector collector(registry);
+    if (GetParam()) {
+        collector.start();
+    }
+    auto first = collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::hours(1));
+    EXPECT_THAT(*first, HasSubstr("name{label=\"value\"} 0\n"));
+    counter->increment();
+    auto cached = collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::hours(1));
+    EXPECT_EQ(cached, first);
+    EXPECT_EQ(collector.getGeneration(MetricExpositionFormat::TEXT), 1);
+    EXPECT_EQ(collector.getGeneration(MetricExpositionFormat::PROTOBUF_DELIMITED), 0);
+
+    auto fresh = collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::milliseconds(0));
+    EXPECT_THAT(*fresh, HasSubstr("name{label=\"value\"} 1\n"));
+    EXPECT_THAT(*first, HasSubstr("name{label=\"value\"} 0\n"));
+    EXPECT_EQ(collector.getGeneration(MetricExpositionFormat::TEXT), 2);
+    collector.stop();
+}
+
+TEST_P(MetricsSnapshotCollectorTest, ReusesReleasedBuffer) {
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("name", "desc")->addMetric({{"label", "value"}});
+    MetricSnapshotCollector collector(registry);
+    if (GetParam()) {
+        collector.start();
+    }
+    auto snapshot = collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::milliseconds(0));
+    const std::string* address = snapshot.get();
+    snapshot.reset();
+    // First snapshot is released to the pool once replaced
+    snapshot = collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::milliseconds(0));
+    EXPECT_NE(snapshot.get(), address);
+    snapshot.reset();
+    counter->increment();
+    snapshot = collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::milliseconds(0));
+    EXPECT_EQ(snapshot.get(), address);
+    EXPECT_THAT(*snapshot, HasSubstr("name{label=\"value\"} 1\n"));
+}
+
+TEST_P(MetricsSnapshotCollectorTest, ConcurrentScrapes) {
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("name", "desc")->addMetric({{"label", "value"}});
+    MetricSnapshotCollector collector(registry);
+    if (GetParam()) {
+        collector.start();
+    }
+    const int numberOfScrapers = 8;
+    const int numberOfScrapes = 100;
+    std::vector<std::thread> scrapers;
+    for (int i = 0; i < numberOfScrapers; i++) {
+        scrapers.emplace_back([&collector, i]() {
+            auto format = (i % 2) ? MetricExpositionFormat::TEXT : MetricExpositionFormat::PROTOBUF_DELIMITED;
+            for (int j = 0; j < numberOfScrapes; j++) {
+                auto snapshot = collector.getSnapshot(format, std::chrono::milliseconds(j % 3));
+                ASSERT_NE(snapshot, nullptr);
+                EXPECT_THAT(*snapshot, HasSubstr("name"));
+            }
+        });
+    }
+    for (int j = 0; j < numberOfScrapes; j++) {
+        counter->increment();
+    }
+    std::for_each(scrapers.begin(), scrapers.end(), [](auto& thread) { thread.join(); });
+    EXPECT_THAT(*collector.getSnapshot(MetricExpositionFormat::TEXT, std::chrono::milliseconds(0)), HasSubstr("name{label=\"value\"} 100\n"));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Metrics,
+    MetricsSnapshotCollectorTest,
+    ::testing::Values(false, true),
+    [](const ::testing::TestParamInfo<MetricsSnapshotCollectorTest::ParamType>& info) {
+        return info.param ? "CollectorThread" : "CallingThread";
+    });
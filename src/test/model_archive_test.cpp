@@ -0,0 +1,306 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+#include <zstd.h>
+
+#include "../localfilesystem.hpp"
+#include "../model_archive.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+namespace {
+void appendTarEntry(std::string& tar, const std::string& name, const std::string& content, char type = '0') {
+    std::array<char, 512> header{};
+    std::strncpy(header.data(), name.c_str(), 99);
+    std::snprintf(header.data() + 100, 8, "%07o", 0644);
+    std::snprintf(header.data() + 124, 12, "%011llo", static_cast<unsigned long long>(content.size()));
+    std::snprintf(header.data() + 136, 12, "%011o", 0);
+    header[156] = type;
+    std::memcpy(header.data() + 257, "ustar\0" "00", 8);
+    std::memset(header.data() + 148, ' ', 8);
+    unsigned int checksum = 0;
+    for (char c : header) {
+        checksum += static_cast<unsigned char>(c);
+    }
+    std::snprintf(header.data() + 148, 7, "%06o", checksum);
+    tar.append(header.data(), header.size());
+    tar.append(content);
+    tar.append((512 - content.size() % 512) % 512, '\0');
+}
+
+void finishTar(std::string& tar) {
+    tar.append(1024, '\0');
+}
+
+std::string compressGzip(const std::string& data) {
+    z_stream stream{};
+    EXPECT_EQ(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    std::string compressed(deflateBound(&stream, data.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = data.size();
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = compressed.size();
+    EXPECT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+
+std::string compressZstd(const std::string& data) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const size_t size = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), 3);
+    EXPECT_FALSE(ZSTD_isError(size));
+    compressed.resize(size);
+    return compressed;
+}
+
+// Weights-like content spanning multiple read and decompression chunks
+std::string createBinContent() {
+    std::string content(3 * 1024 * 1024 + 123, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>((i * 31) % 251);
+    }
+    return content;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+class ModelVersionArchiveTest : public TestWithTempDir {
+protected:
+    LocalFileSystem lfs;
+    std::string extractPath;
+    std::string binContent = createBinContent();
+
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        extractPath = directoryPath + "/extracted";
+        std::filesystem::create_directories(extractPath);
+    }
+
+    std::string createModelTar() {
+        std::string tar;
+        appendTarEntry(tar, "./", "", '5');
+        appendTarEntry(tar, "./model.xml", "<net></net>");
+        appendTarEntry(tar, "./model.bin", binContent);
+        appendTarEntry(tar, "./sub/mapping_config.json", "{}");
+        appendTarEntry(tar, "./README.md", "skipped");
+        finishTar(tar);
+        return tar;
+    }
+
+    std::string writeArchive(const std::string& name, const std::string& content) {
+        const std::string path = directoryPath + "/" + name;
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        return path;
+    }
+
+    void expectModelExtracted() {
+        EXPECT_EQ(readFile(extractPath + "/model.xml"), "<net></net>");
+        EXPECT_EQ(readFile(extractPath + "/model.bin"), binContent);
+        EXPECT_EQ(readFile(extractPath + "/sub/mapping_config.json"), "{}");
+        EXPECT_FALSE(std::filesystem::exists(extractPath + "/README.md"));
+    }
+};
+
+TEST(ModelVersionArchive, ParseVersion) {
+    model_version_t version = 0;
+    EXPECT_TRUE(ModelVersionArchive::parseVersion("1.tar.gz", version));
+    EXPECT_EQ(version, 1);
+    EXPECT_TRUE(ModelVersionArchive::parseVersion("23.tar.zst", version));
+    EXPECT_EQ(version, 23);
+    EXPECT_TRUE(ModelVersionArchive::parseVersion("4.tgz", version));
+    EXPECT_EQ(version, 4);
+    EXPECT_FALSE(ModelVersionArchive::parseVersion("0.tar.gz", version));
+    EXPECT_FALSE(ModelVersionArchive::parseVersion("model.tar.gz", version));
+    EXPECT_FALSE(ModelVersionArchive::parseVersion("1a.tar.zst", version));
+    EXPECT_FALSE(ModelVersionArchive::parseVersion(".tar.zst", version));
+    EXPECT_FALSE(ModelVersionArchive::parseVersion("1.tar", version));
+    EXPECT_FALSE(ModelVersionArchive::parseVersion("99999999999999999999.tar.gz", version));
+    EXPECT_EQ(ModelVersionArchive::getCompression("1.tar"), ArchiveCompression::NONE);
+}
+
+TEST_F(ModelVersionArchiveTest, FindVersionArchivesPrefersDirectories) {
+    std::filesystem::create_directories(directoryPath + "/1");
+    writeArchive("1.tar.gz", "");
+    writeArchive("2.tar.zst", "");
+    writeArchive("model.tar.gz", "");
+    std::map<model_version_t, std::string> archives;
+    ASSERT_EQ(ModelVersionArchive::findVersionArchives(lfs, directoryPath, archives), StatusCode::OK);
+    ASSERT_EQ(archives.size(), 1);
+    EXPECT_EQ(archives[2], directoryPath + "/2.tar.zst");
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractGzip) {
+    auto path = writeArchive("1.tar.gz", compressGzip(createModelTar()));
+    ASSERT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::OK);
+    expectModelExtracted();
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractZstd) {
+    auto path = writeArchive("1.tar.zst", compressZstd(createModelTar()));
+    ASSERT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::OK);
+    expectModelExtracted();
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractConcatenatedGzipMembers) {
+    const std::string tar = createModelTar();
+    const size_t half = tar.size() / 2;
+    auto path = writeArchive("1.tgz", compressGzip(tar.substr(0, half)) + compressGzip(tar.substr(half)));
+    ASSERT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::OK);
+    expectModelExtracted();
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractGnuLongName) {
+    const std::string longName = std::string(120, 'a') + ".xml";
+    std::string tar;
+    appendTarEntry(tar, "././@LongLink", longName + '\0', 'L');
+    appendTarEntry(tar, longName.substr(0, 99), "<net></net>");
+    finishTar(tar);
+    auto path = writeArchive("1.tar.zst", compressZstd(tar));
+    ASSERT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::OK);
+    EXPECT_EQ(readFile(extractPath + "/" + longName), "<net></net>");
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractAllInParallel) {
+    std::filesystem::create_directories(directoryPath + "/1");
+    std::filesystem::create_directories(directoryPath + "/2");
+    auto gzip = writeArchive("1.tar.gz", compressGzip(createModelTar()));
+    auto zstd = writeArchive("2.tar.zst", compressZstd(createModelTar()));
+    ASSERT_EQ(ModelVersionArchive::extractAll(lfs, {{gzip, directoryPath + "/1"}, {zstd, directoryPath + "/2"}}), StatusCode::OK);
+    EXPECT_EQ(readFile(directoryPath + "/1/model.bin"), binContent);
+    EXPECT_EQ(readFile(directoryPath + "/2/model.bin"), binContent);
+}
+
+namespace {
+class ConcurrencyTrackingFileSystem : public LocalFileSystem {
+public:
+    std::atomic<int> active{0};
+    std::atomic<int> maxActive{0};
+
+    StatusCode readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) override {
+        const int current = ++active;
+        int observed = maxActive.load();
+        while (observed < current && !maxActive.compare_exchange_weak(observed, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        auto status = LocalFileSystem::readFileChunks(path, consumer);
+        --active;
+        return status;
+    }
+};
+
+class ThrowingFileSystem : public LocalFileSystem {
+public:
+    StatusCode readFileChunks(const std::string& path, const file_chunk_consumer_t& consumer) override {
+        return LocalFileSystem::readFileChunks(path, [&consumer](const char* data, size_t size) -> StatusCode {
+            auto status = consumer(data, size);
+            if (status != StatusCode::OK) {
+                return status;
+            }
+            throw std::bad_alloc();
+        });
+    }
+};
+}  // namespace
+
+TEST_F(ModelVersionArchiveTest, ExtractJoinsExtractionWhenReadThrows) {
+    ThrowingFileSystem fs;
+    auto path = writeArchive("1.tar.gz", compressGzip(createModelTar()));
+    EXPECT_EQ(ModelVersionArchive::extract(fs, path, extractPath), StatusCode::INTERNAL_ERROR);
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractAllBoundsParallelExtractions) {
+    ConcurrencyTrackingFileSystem fs;
+    std::vector<ModelVersionArchive::Extraction> extractions;
+    for (int version = 1; version <= 6; version++) {
+        const std::string localPath = directoryPath + "/" + std::to_string(version);
+        std::filesystem::create_directories(localPath);
+        extractions.push_back({writeArchive(std::to_string(version) + ".tar.gz", compressGzip(createModelTar())), localPath});
+    }
+    ASSERT_EQ(ModelVersionArchive::extractAll(fs, extractions, 2), StatusCode::OK);
+    EXPECT_LE(fs.maxActive.load(), 2);
+    EXPECT_GE(fs.maxActive.load(), 1);
+    for (const auto& extraction : extractions) {
+        EXPECT_EQ(readFile(extraction.localPath + "/model.bin"), binContent);
+    }
+}
+
+TEST_F(ModelVersionArchiveTest, ExtractAllReportsFailureOfAnyArchive) {
+    std::filesystem::create_directories(directoryPath + "/1");
+    std::filesystem::create_directories(directoryPath + "/2");
+    auto valid = writeArchive("1.tar.gz", compressGzip(createModelTar()));
+    auto corrupted = writeArchive("2.tar.zst", "not an archive");
+    EXPECT_EQ(ModelVersionArchive::extractAll(lfs, {{valid, directoryPath + "/1"}, {corrupted, directoryPath + "/2"}}, 1), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+    EXPECT_EQ(readFile(directoryPath + "/1/model.bin"), binContent);
+}
+
+TEST_F(ModelVersionArchiveTest, RejectsPathEscape) {
+    std::string tar;
+    appendTarEntry(tar, "../escaped.xml", "<net></net>");
+    finishTar(tar);
+    auto path = writeArchive("1.tar.gz", compressGzip(tar));
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+    EXPECT_FALSE(std::filesystem::exists(directoryPath + "/escaped.xml"));
+
+    tar.clear();
+    appendTarEntry(tar, "/tmp/absolute.xml", "<net></net>");
+    finishTar(tar);
+    path = writeArchive("1.tar.zst", compressZstd(tar));
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+}
+
+TEST_F(ModelVersionArchiveTest, RejectsCorruptedArchives) {
+    const std::string gzip = compressGzip(createModelTar());
+    auto path = writeArchive("1.tar.gz", gzip.substr(0, gzip.size() / 2));
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+
+    const std::string zstd = compressZstd(createModelTar());
+    path = writeArchive("1.tar.zst", zstd.substr(0, zstd.size() - 10));
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+
+    path = writeArchive("2.tar.zst", "not an archive");
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+
+    std::string tar = createModelTar();
+    tar[148] = '7';  // breaks checksum of first header
+    path = writeArchive("3.tar.gz", compressGzip(tar));
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, path, extractPath), StatusCode::MODEL_VERSION_ARCHIVE_INVALID);
+}
+
+TEST_F(ModelVersionArchiveTest, MissingArchive) {
+    EXPECT_EQ(ModelVersionArchive::extract(lfs, directoryPath + "/5.tar.gz", extractPath), StatusCode::PATH_INVALID);
+}
@@ -191,6 +191,49 @@ TEST(ModelConfig, parseLayoutParam_multi) {
     }
 }
 
+TEST(ModelConfig, parseColorFormatParam) {
+    using namespace ovms;
+    ModelConfig config;
+    // Valid
+    std::string valid_str1 = " { \"image\": \"nv12\", \"frame\": \"NV12_TWO_PLANES:rgb\", \"other\": \"I420\" } ";
+
+    ASSERT_EQ(config.parseColorFormatParameter(valid_str1), StatusCode::OK);
+    EXPECT_EQ(config.getColorFormats().size(), 3);
+    ASSERT_EQ(config.getColorFormats().count("image"), 1);
+    ASSERT_EQ(config.getColorFormats().count("frame"), 1);
+    ASSERT_EQ(config.getColorFormats().count("other"), 1);
+    EXPECT_EQ(config.getColorFormats().at("image"), ColorFormatConfiguration(SourceColorFormat::NV12, TargetColorFormat::BGR));
+    EXPECT_EQ(config.getColorFormats().at("frame"), ColorFormatConfiguration(SourceColorFormat::NV12_TWO_PLANES, TargetColorFormat::RGB));
+    EXPECT_EQ(config.getColorFormats().at("other"), ColorFormatConfiguration(SourceColorFormat::I420, TargetColorFormat::BGR));
+    EXPECT_EQ(config.getColorFormats().at("frame").getPlaneNames(), (std::vector<std::string>{"y", "uv"}));
+    EXPECT_EQ(config.getColorFormats().at("image").getPlaneNames().size(), 0);
+
+    // Invalid
+    std::vector<std::string> invalid_str{
+        std::string{" { \"image\": \"yuv\" } "},
+        std::string{" { \"image\": \"nv12:hsv\" } "},
+        std::string{" { \"image\": \"nv12:bgr:rgb\" } "},
+        std::string{" { \"image\": \"nv12:\" } "},
+        std::string{" { \"image\": 12 } "},
+        std::string{"nv12"},
+    };
+
+    for (std::string str : invalid_str) {
+        auto status = config.parseColorFormatParameter(str);
+        EXPECT_EQ(status, ovms::StatusCode::COLOR_FORMAT_WRONG_FORMAT) << " Failed for: " << str;
+        EXPECT_EQ(config.getColorFormats().size(), 0);
+    }
+}
+
+TEST(ModelConfig, colorFormatChangeRequiresReload) {
+    ovms::ModelConfig config;
+    ovms::ModelConfig changed;
+    ASSERT_EQ(config.parseColorFormatParameter("{\"image\": \"NV12\"}"), ovms::StatusCode::OK);
+    ASSERT_EQ(changed.parseColorFormatParameter("{\"image\": \"NV12:RGB\"}"), ovms::StatusCode::OK);
+    EXPECT_FALSE(config.isReloadRequired(config));
+    EXPECT_TRUE(config.isReloadRequired(changed));
+}
+
 TEST(ModelConfig, shape) {
     ovms::ModelConfig config;
 
@@ -846,6 +889,36 @@ TEST(ModelConfig, ConfigParseNodeWithForbiddenShapeName) {
     EXPECT_EQ(modelConfig.getShapes().size(), 0);
 }
 
+TEST(ModelConfig, ConfigParseNodeOverloadFallbackForStatefulModel) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "stateful": true,
+                    "overload_fallback": {"version": 1, "queue_wait_threshold_ms": 20}
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    EXPECT_EQ(status, ovms::StatusCode::OVERLOAD_FALLBACK_STATEFUL_MODEL);
+}
+
 TEST(ModelConfig, ConfigParseNodeWithInvalidShapeFormatArray) {
     std::string config = R"#(
         {
@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+#include <rapidjson/document.h>
+
+#include "../nodecondition.hpp"
+
+using namespace ovms;
+
+static NodeCondition parseCondition(const char* json, Status& status) {
+    rapidjson::Document doc;
+    doc.Parse(json);
+    NodeCondition condition;
+    status = condition.parse(doc);
+    return condition;
+}
+
+TEST(NodeCondition, Parse) {
+    Status status;
+    auto condition = parseCondition(R"({"input": "scores", "reduce": "max", "operator": ">=", "threshold": 0.5})", status);
+    ASSERT_EQ(status, StatusCode::OK);
+    EXPECT_EQ(condition.inputName, "scores");
+    EXPECT_EQ(condition.reduction, ConditionReduction::MAX);
+    EXPECT_EQ(condition.op, ConditionOperator::GREATER_EQUAL);
+    EXPECT_EQ(condition.threshold, 0.5);
+}
+
+TEST(NodeCondition, ParseInvalid) {
+    for (const char* json : {
+             R"({"reduce": "max", "operator": ">=", "threshold": 0.5})",
+             R"({"input": "scores", "reduce": "avg", "operator": ">=", "threshold": 0.5})",
+             R"({"input": "scores", "reduce": "max", "operator": "=>", "threshold": 0.5})",
+             R"({"input": "scores", "reduce": "max", "operator": ">=", "threshold": "0.5"})"}) {
+        Status status;
+        parseCondition(json, status);
+        EXPECT_EQ(status, StatusCode::PIPELINE_CONDITION_WRONG_FORMAT) << json;
+    }
+}
+
+TEST(NodeCondition, CountUsesFirstDimension) {
+    Status status;
+    auto condition = parseCondition(R"({"input": "boxes", "reduce": "count", "operator": ">", "threshold": 0})", status);
+    ASSERT_EQ(status, StatusCode::OK);
+    bool result = false;
+    ov::Tensor detections(ov::element::f32, ov::Shape{3, 4});
+    ASSERT_EQ(condition.evaluate(detections, result), StatusCode::OK);
+    EXPECT_TRUE(result);
+    ov::Tensor noDetections(ov::element::f32, ov::Shape{0, 4});
+    ASSERT_EQ(condition.evaluate(noDetections, result), StatusCode::OK);
+    EXPECT_FALSE(result);
+}
+
+TEST(NodeCondition, ReduceElements) {
+    ov::Tensor tensor(ov::element::i32, ov::Shape{2, 2});
+    std::vector<int32_t> values{1, -3, 7, 2};
+    std::copy(values.begin(), values.end(), tensor.data<int32_t>());
+    const std::vector<std::pair<const char*, bool>> cases{
+        {R"({"input": "x", "reduce": "max", "operator": "==", "threshold": 7})", true},
+        {R"({"input": "x", "reduce": "min", "operator": "<", "threshold": -3})", false},
+        {R"({"input": "x", "reduce": "min", "operator": "<=", "threshold": -3})", true},
+        {R"({"input": "x", "reduce": "sum", "operator": "!=", "threshold": 7})", false},
+        {R"({"input": "x", "reduce": "sum", "operator": ">", "threshold": 6.5})", true}};
+    for (const auto& [json, expected] : cases) {
+        Status status;
+        auto condition = parseCondition(json, status);
+        ASSERT_EQ(status, StatusCode::OK) << json;
+        bool result = !expected;
+        ASSERT_EQ(condition.evaluate(tensor, result), StatusCode::OK) << json;
+        EXPECT_EQ(result, expected) << json;
+    }
+}
+
+TEST(NodeCondition, ReduceEmptyTensorIsFalse) {
+    Status status;
+    auto condition = parseCondition(R"({"input": "x", "reduce": "max", "operator": "<", "threshold": 1})", status);
+    ASSERT_EQ(status, StatusCode::OK);
+    bool result = true;
+    ov::Tensor tensor(ov::element::f32, ov::Shape{0, 10});
+    ASSERT_EQ(condition.evaluate(tensor, result), StatusCode::OK);
+    EXPECT_FALSE(result);
+}
+
+TEST(NodeCondition, UnsupportedPrecision) {
+    Status status;
+    auto condition = parseCondition(R"({"input": "x", "reduce": "max", "operator": ">", "threshold": 0})", status);
+    ASSERT_EQ(status, StatusCode::OK);
+    bool result = false;
+    ov::Tensor tensor(ov::element::boolean, ov::Shape{2});
+    EXPECT_EQ(condition.evaluate(tensor, result), StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION);
+}
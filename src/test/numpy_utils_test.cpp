@@ -0,0 +1,198 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../numpy_utils.hpp"
+
+using namespace ovms;
+
+namespace {
+void appendLittleEndian(std::string& content, uint32_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        content.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+// Builds zip archive in the same layout as numpy.savez, with entries stored without compression
+std::string makeStoredZip(const std::vector<std::pair<std::string, std::string>>& entries, uint16_t method = 0) {
+    std::string content;
+    std::string directory;
+    for (const auto& [name, data] : entries) {
+        const uint32_t localHeaderOffset = content.size();
+        appendLittleEndian(content, 0x04034b50, 4);
+        appendLittleEndian(content, 20, 2);  // version needed
+        appendLittleEndian(content, 0, 2);   // flags
+        appendLittleEndian(content, method, 2);
+        appendLittleEndian(content, 0, 4);  // time & date
+        appendLittleEndian(content, 0, 4);  // crc is not verified
+        appendLittleEndian(content, data.size(), 4);
+        appendLittleEndian(content, data.size(), 4);
+        appendLittleEndian(content, name.size(), 2);
+        appendLittleEndian(content, 0, 2);
+        content += name;
+        content += data;
+
+        appendLittleEndian(directory, 0x02014b50, 4);
+        appendLittleEndian(directory, 20, 2);  // version made by
+        appendLittleEndian(directory, 20, 2);  // version needed
+        appendLittleEndian(directory, 0, 2);
+        appendLittleEndian(directory, method, 2);
+        appendLittleEndian(directory, 0, 4);
+        appendLittleEndian(directory, 0, 4);
+        appendLittleEndian(directory, data.size(), 4);
+        appendLittleEndian(directory, data.size(), 4);
+        appendLittleEndian(directory, name.size(), 2);
+        appendLittleEndian(directory, 0, 2);  // extra
+        appendLittleEndian(directory, 0, 2);  // comment
+        appendLittleEndian(directory, 0, 2);  // disk
+        appendLittleEndian(directory, 0, 2);  // internal attributes
+        appendLittleEndian(directory, 0, 4);  // external attributes
+        appendLittleEndian(directory, localHeaderOffset, 4);
+        directory += name;
+    }
+    const uint32_t directoryOffset = content.size();
+    content += directory;
+    appendLittleEndian(content, 0x06054b50, 4);
+    appendLittleEndian(content, 0, 2);
+    appendLittleEndian(content, 0, 2);
+    appendLittleEndian(content, entries.size(), 2);
+    appendLittleEndian(content, entries.size(), 2);
+    appendLittleEndian(content, directory.size(), 4);
+    appendLittleEndian(content, directoryOffset, 4);
+    appendLittleEndian(content, 0, 2);
+    return content;
+}
+
+std::string makeNpyWithHeader(const std::string& header, size_t dataSize) {
+    std::string content("\x93NUMPY\x01\x00", 8);
+    std::string paddedHeader = header;
+    paddedHeader.append(64 - (10 + header.size() + 1) % 64, ' ');
+    paddedHeader.push_back('\n');
+    appendLittleEndian(content, paddedHeader.size(), 2);
+    content += paddedHeader;
+    content.append(dataSize, '\0');
+    return content;
+}
+}  // namespace
+
+TEST(NumpyUtils, MakeAndParseNpy) {
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    std::string content;
+    ASSERT_EQ(makeNpy(Precision::FP32, {2, 3}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)), content), StatusCode::OK);
+    EXPECT_EQ(content.find("{'descr': '<f4', 'fortran_order': False, 'shape': (2, 3), }"), 10);
+    // Data is aligned to 64 bytes
+    EXPECT_EQ((content.size() - data.size() * sizeof(float)) % 64, 0);
+
+    NumpyArray array;
+    ASSERT_EQ(parseNpy(content, array), StatusCode::OK);
+    EXPECT_EQ(array.precision, Precision::FP32);
+    EXPECT_EQ(array.shape, shape_t({2, 3}));
+    ASSERT_EQ(array.data.size(), data.size() * sizeof(float));
+    EXPECT_EQ(std::memcmp(array.data.data(), data.data(), array.data.size()), 0);
+}
+
+TEST(NumpyUtils, MakeNpyOneDimensionalAndScalar) {
+    std::vector<uint8_t> data{1, 2, 3};
+    std::string content;
+    ASSERT_EQ(makeNpy(Precision::U8, {3}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size()), content), StatusCode::OK);
+    EXPECT_NE(content.find("{'descr': '|u1', 'fortran_order': False, 'shape': (3,), }"), std::string::npos);
+    NumpyArray array;
+    ASSERT_EQ(parseNpy(content, array), StatusCode::OK);
+    EXPECT_EQ(array.shape, shape_t({3}));
+
+    ASSERT_EQ(makeNpy(Precision::U8, {}, std::string_view(reinterpret_cast<const char*>(data.data()), 1), content), StatusCode::OK);
+    ASSERT_EQ(parseNpy(content, array), StatusCode::OK);
+    EXPECT_TRUE(array.shape.empty());
+    EXPECT_EQ(array.data.size(), 1);
+}
+
+TEST(NumpyUtils, MakeNpyRejectsDataSizeMismatch) {
+    std::string data(10, '\0');
+    std::string content;
+    EXPECT_EQ(makeNpy(Precision::FP32, {1, 3}, data, content), StatusCode::NUMPY_INVALID_FORMAT);
+}
+
+TEST(NumpyUtils, ParseNpyRejectsInvalidContent) {
+    std::string content;
+    ASSERT_EQ(makeNpy(Precision::I32, {2}, std::string(8, '\0'), content), StatusCode::OK);
+    NumpyArray array;
+    std::string invalidMagic = content;
+    invalidMagic[1] = 'X';
+    EXPECT_EQ(parseNpy(invalidMagic, array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy(content.substr(0, content.size() - 1), array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy(content.substr(0, 9), array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy("", array), StatusCode::NUMPY_INVALID_FORMAT);
+}
+
+TEST(NumpyUtils, ParseNpyRejectsUnsupportedLayouts) {
+    NumpyArray array;
+    EXPECT_EQ(parseNpy(makeNpyWithHeader("{'descr': '<f4', 'fortran_order': True, 'shape': (2, 2), }", 16), array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy(makeNpyWithHeader("{'descr': '>f4', 'fortran_order': False, 'shape': (2, 2), }", 16), array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy(makeNpyWithHeader("{'descr': '<U8', 'fortran_order': False, 'shape': (1,), }", 32), array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy(makeNpyWithHeader("{'descr': '<f4', 'fortran_order': False, 'shape': (2, -2), }", 16), array), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpy(makeNpyWithHeader("{'descr': '<f4', 'fortran_order': False, 'shape': (2, 2), }", 16), array), StatusCode::OK);
+}
+
+TEST(NumpyUtils, ParseNpz) {
+    std::string first, second;
+    ASSERT_EQ(makeNpy(Precision::FP32, {1, 2}, std::string(8, '\0'), first), StatusCode::OK);
+    ASSERT_EQ(makeNpy(Precision::I64, {3}, std::string(24, '\0'), second), StatusCode::OK);
+    numpy_arrays_t arrays;
+    ASSERT_EQ(parseNpz(makeStoredZip({{"b.npy", first}, {"input:1.npy", second}}), arrays), StatusCode::OK);
+    ASSERT_EQ(arrays.size(), 2);
+    EXPECT_EQ(arrays[0].first, "b");
+    EXPECT_EQ(arrays[0].second.precision, Precision::FP32);
+    EXPECT_EQ(arrays[0].second.shape, shape_t({1, 2}));
+    EXPECT_EQ(arrays[1].first, "input:1");
+    EXPECT_EQ(arrays[1].second.precision, Precision::I64);
+    EXPECT_EQ(arrays[1].second.shape, shape_t({3}));
+}
+
+TEST(NumpyUtils, ParseNpzRejectsCompressedEntries) {
+    std::string content;
+    ASSERT_EQ(makeNpy(Precision::FP32, {1, 2}, std::string(8, '\0'), content), StatusCode::OK);
+    numpy_arrays_t arrays;
+    const uint16_t deflated = 8;
+    EXPECT_EQ(parseNpz(makeStoredZip({{"b.npy", content}}, deflated), arrays), StatusCode::NUMPY_INVALID_FORMAT);
+    EXPECT_EQ(parseNpz(content, arrays), StatusCode::NUMPY_INVALID_FORMAT);
+}
+
+TEST(NumpyUtils, MakeAndParseNpz) {
+    std::string first, second, content;
+    ASSERT_EQ(makeNpy(Precision::FP32, {1, 2}, std::string(8, '\0'), first), StatusCode::OK);
+    ASSERT_EQ(makeNpy(Precision::U8, {3}, std::string(3, '\0'), second), StatusCode::OK);
+    ASSERT_EQ(makeNpz({{"a", first}, {"b:0", second}}, content), StatusCode::OK);
+    numpy_arrays_t arrays;
+    ASSERT_EQ(parseNpz(content, arrays), StatusCode::OK);
+    ASSERT_EQ(arrays.size(), 2);
+    EXPECT_EQ(arrays[0].first, "a");
+    EXPECT_EQ(arrays[0].second.shape, shape_t({1, 2}));
+    EXPECT_EQ(arrays[1].first, "b:0");
+    EXPECT_EQ(arrays[1].second.precision, Precision::U8);
+}
+
+TEST(NumpyUtils, GetNumpyFormat) {
+    EXPECT_EQ(getNumpyFormat("application/x-npy"), NumpyFormat::NPY);
+    EXPECT_EQ(getNumpyFormat("Application/X-NPZ; charset=binary"), NumpyFormat::NPZ);
+    EXPECT_EQ(getNumpyFormat("application/json"), NumpyFormat::NONE);
+    EXPECT_EQ(getNumpyFormat(""), NumpyFormat::NONE);
+}
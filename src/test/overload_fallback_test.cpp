@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <string>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "../overload_fallback.hpp"
+
+using namespace ovms;
+
+namespace {
+Status parsePolicy(const std::string& json, OverloadFallbackPolicy& policy) {
+    rapidjson::Document doc;
+    doc.Parse(json.c_str());
+    return OverloadFallbackPolicy::fromJson(doc, policy);
+}
+}  // namespace
+
+TEST(OverloadFallbackPolicy, ParseValid) {
+    OverloadFallbackPolicy policy;
+    ASSERT_EQ(parsePolicy(R"({"version": 1, "queue_wait_threshold_ms": 20, "recovery_threshold_ms": 5, "fraction": 0.25})", policy), StatusCode::OK);
+    EXPECT_TRUE(policy.isEnabled());
+    EXPECT_EQ(policy.getFallbackVersion(), 1);
+    EXPECT_EQ(policy.getQueueWaitThresholdMs(), 20);
+    EXPECT_EQ(policy.getRecoveryThresholdMs(), 5);
+    EXPECT_EQ(policy.getFraction(), 0.25);
+}
+
+TEST(OverloadFallbackPolicy, ParseDefaults) {
+    OverloadFallbackPolicy policy;
+    EXPECT_FALSE(policy.isEnabled());
+    ASSERT_EQ(parsePolicy(R"({"version": 2, "queue_wait_threshold_ms": 10.5})", policy), StatusCode::OK);
+    EXPECT_EQ(policy.getRecoveryThresholdMs(), 5.25);
+    EXPECT_EQ(policy.getFraction(), OverloadFallbackPolicy::DEFAULT_FRACTION);
+}
+
+TEST(OverloadFallbackPolicy, ParseInvalid) {
+    OverloadFallbackPolicy policy;
+    EXPECT_EQ(parsePolicy(R"([])", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"queue_wait_threshold_ms": 10})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"version": 0, "queue_wait_threshold_ms": 10})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"version": 1})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"version": 1, "queue_wait_threshold_ms": 0})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"version": 1, "queue_wait_threshold_ms": 10, "recovery_threshold_ms": 10})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"version": 1, "queue_wait_threshold_ms": 10, "fraction": 1})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_EQ(parsePolicy(R"({"version": 1, "queue_wait_threshold_ms": 10, "fraction": 0})", policy), StatusCode::OVERLOAD_FALLBACK_WRONG_FORMAT);
+    EXPECT_FALSE(policy.isEnabled());
+}
+
+TEST(InferRequestWaitEstimator, ConvergesToObservedWait) {
+    InferRequestWaitEstimator estimator;
+    EXPECT_EQ(estimator.getAverageMs(), 0);
+    estimator.observe(10);
+    EXPECT_DOUBLE_EQ(estimator.getAverageMs(), 10 * InferRequestWaitEstimator::SMOOTHING_FACTOR);
+    for (int i = 0; i < 200; ++i) {
+        estimator.observe(10);
+    }
+    EXPECT_NEAR(estimator.getAverageMs(), 10, 0.01);
+}
+
+TEST(OverloadFallbackRouter, DisabledPolicyAlwaysRoutesToDefault) {
+    OverloadFallbackRouter router("model");
+    EXPECT_EQ(router.route(3, 1000), 3);
+    EXPECT_FALSE(router.isDegraded());
+}
+
+TEST(OverloadFallbackRouter, RoutesFractionOfRequestsWithHysteresis) {
+    OverloadFallbackRouter router("model");
+    router.setPolicy(OverloadFallbackPolicy(1, 20, 5, 0.25));
+
+    EXPECT_EQ(router.route(3, 10), 3);
+    EXPECT_FALSE(router.isDegraded());
+
+    int fallbackCount = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (router.route(3, 25) == 1) {
+            fallbackCount++;
+        }
+    }
+    EXPECT_TRUE(router.isDegraded());
+    EXPECT_EQ(fallbackCount, 25);
+
+    // Wait between recovery threshold and threshold keeps the current state
+    router.route(3, 10);
+    EXPECT_TRUE(router.isDegraded());
+    EXPECT_EQ(router.route(3, 4), 3);
+    EXPECT_FALSE(router.isDegraded());
+    router.route(3, 10);
+    EXPECT_FALSE(router.isDegraded());
+}
+
+TEST(OverloadFallbackRouter, IgnoresFallbackEqualToDefaultVersion) {
+    OverloadFallbackRouter router("model");
+    router.setPolicy(OverloadFallbackPolicy(1, 20, 5, 0.5));
+    EXPECT_EQ(router.route(1, 100), 1);
+    EXPECT_FALSE(router.isDegraded());
+}
+
+TEST(OverloadFallbackRouter, PolicyChangeResetsState) {
+    OverloadFallbackRouter router("model");
+    router.setPolicy(OverloadFallbackPolicy(1, 20, 5, 0.5));
+    router.route(3, 100);
+    ASSERT_TRUE(router.isDegraded());
+    router.setPolicy(OverloadFallbackPolicy(1, 20, 5, 0.5));
+    EXPECT_TRUE(router.isDegraded());
+    router.setPolicy(OverloadFallbackPolicy(2, 50, 5, 0.5));
+    EXPECT_FALSE(router.isDegraded());
+    EXPECT_EQ(router.getPolicy()->getFallbackVersion(), 2);
+}
@@ -16,13 +16,18 @@
 
 #include <chrono>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <random>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "../executingstreamidguard.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../ovinferrequestsqueue.hpp"
 #include "../timer.hpp"
 
@@ -131,3 +136,95 @@ TEST(OVInferRequestQueue, AsyncGetInferRequest) {
     const int secondStreamId = secondStreamRequest.get();
     EXPECT_EQ(firstStreamId, secondStreamId);
 }
+
+TEST(OVInferRequestQueue, WaitersObserver) {
+    ov::Core ieCore;
+    auto model = ieCore.read_model(DUMMY_MODEL_PATH);
+    ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
+    const int nireq = 1;
+    ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, nireq);
+    std::vector<size_t> waitersHistory;
+    inferRequestsQueue.setWaitersObserver([&waitersHistory](size_t waiters) { waitersHistory.push_back(waiters); });
+
+    std::future<int> firstStreamRequest = inferRequestsQueue.getIdleStream();
+    EXPECT_TRUE(waitersHistory.empty());
+    std::future<int> secondStreamRequest = inferRequestsQueue.getIdleStream();
+    std::future<int> thirdStreamRequest = inferRequestsQueue.getIdleStream();
+    EXPECT_THAT(waitersHistory, ElementsAre(1, 2));
+
+    inferRequestsQueue.returnStream(firstStreamRequest.get());
+    inferRequestsQueue.returnStream(secondStreamRequest.get());
+    EXPECT_THAT(waitersHistory, ElementsAre(1, 2, 1, 0));
+    inferRequestsQueue.returnStream(thirdStreamRequest.get());
+    EXPECT_THAT(waitersHistory, ElementsAre(1, 2, 1, 0));
+}
+
+TEST(OVInferRequestQueue, LowPriorityWaitersAreServedAfterRegularOnes) {
+    ov::Core ieCore;
+    auto model = ieCore.read_model(DUMMY_MODEL_PATH);
+    ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
+    const int nireq = 1;
+    ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, nireq);
+
+    std::future<int> busyStream = inferRequestsQueue.getIdleStream();
+    std::future<int> lowPriorityStream = inferRequestsQueue.getIdleStream(true);
+    std::future<int> regularStream = inferRequestsQueue.getIdleStream();
+    EXPECT_EQ(inferRequestsQueue.getWaitersCount(), 2);
+    EXPECT_EQ(inferRequestsQueue.getLowPriorityWaitersCount(), 1);
+
+    inferRequestsQueue.returnStream(busyStream.get());
+    EXPECT_EQ(std::future_status::ready, regularStream.wait_for(std::chrono::microseconds(1)));
+    EXPECT_EQ(std::future_status::timeout, lowPriorityStream.wait_for(std::chrono::milliseconds(1)));
+    inferRequestsQueue.returnStream(regularStream.get());
+    EXPECT_EQ(std::future_status::ready, lowPriorityStream.wait_for(std::chrono::microseconds(1)));
+    inferRequestsQueue.returnStream(lowPriorityStream.get());
+    EXPECT_EQ(inferRequestsQueue.getWaitersCount(), 0);
+}
+
+TEST(OVInferRequestQueue, OnlineRequestGetsAheadOfSaturatedBatchJob) {
+    ov::Core ieCore;
+    auto model = ieCore.read_model(DUMMY_MODEL_PATH);
+    ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
+    const int nireq = 1;
+    const size_t batchJobWorkers = 3;
+    ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, nireq);
+    ovms::ModelMetricReporter reporter(nullptr, nullptr, "dummy", 1);
+
+    std::mutex orderMutex;
+    std::vector<std::string> order;
+    auto acquire = [&](const std::string& name, bool batchJob) {
+        std::unique_ptr<ovms::LowPriorityInferenceScope> scope;
+        if (batchJob) {
+            scope = std::make_unique<ovms::LowPriorityInferenceScope>();
+        }
+        ovms::ExecutingStreamIdGuard guard(inferRequestsQueue, reporter);
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(name);
+    };
+    auto waitForWaiters = [&inferRequestsQueue](size_t count) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (inferRequestsQueue.getWaitersCount() < count && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_EQ(inferRequestsQueue.getWaitersCount(), count);
+    };
+
+    std::vector<std::thread> threads;
+    {
+        // Infer request is busy, batch job workers queue up first
+        ovms::ExecutingStreamIdGuard busy(inferRequestsQueue, reporter);
+        for (size_t i = 0; i < batchJobWorkers; i++) {
+            threads.emplace_back(acquire, "batch", true);
+        }
+        waitForWaiters(batchJobWorkers);
+        EXPECT_EQ(inferRequestsQueue.getLowPriorityWaitersCount(), batchJobWorkers);
+        threads.emplace_back(acquire, "online", false);
+        waitForWaiters(batchJobWorkers + 1);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(order.size(), batchJobWorkers + 1);
+    EXPECT_EQ(order.front(), "online");
+    EXPECT_FALSE(ovms::LowPriorityInferenceScope::isActive());
+}
@@ -206,6 +206,18 @@ TEST_F(OvmsConfigDeathTest, negativeGrpcWorkersMax) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_workers count should be from 1");
 }
 
+TEST_F(OvmsConfigDeathTest, negativeWorkerProcessesZero) {
+    char* n_argv[] = {"ovms", "--model_path", "/path1", "--model_name", "model", "--worker_processes", "0"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "worker_processes count should be from 1");
+}
+
+TEST_F(OvmsConfigDeathTest, negativeWorkerProcessesWithBatchJobs) {
+    char* n_argv[] = {"ovms", "--model_path", "/path1", "--model_name", "model", "--rest_port", "8080", "--batch_job_path", "/jobs", "--worker_processes", "2"};
+    int arg_count = 11;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "batch_job_path cannot be used with worker_processes");
+}
+
 TEST_F(OvmsConfigDeathTest, negativeUint64Max) {
     char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_port", "0xffffffffffffffff"};
     int arg_count = 5;
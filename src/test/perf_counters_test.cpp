@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../perf_counters.hpp"
+
+using namespace ovms;
+
+TEST(PerfCounters, EventAndStageNames) {
+    EXPECT_EQ(std::string(getPerfEventName(PERF_EVENT_CYCLES)), "cycles");
+    EXPECT_EQ(std::string(getPerfEventName(PERF_EVENT_INSTRUCTIONS)), "instructions");
+    EXPECT_EQ(std::string(getPerfEventName(PERF_EVENT_LLC_MISSES)), "llc_misses");
+    EXPECT_EQ(std::string(getPerfEventName(PERF_EVENT_CONTEXT_SWITCHES)), "context_switches");
+    EXPECT_EQ(std::string(getPerfStageName(PERF_STAGE_DESERIALIZE)), "deserialize");
+    EXPECT_EQ(std::string(getPerfStageName(PERF_STAGE_INFER)), "infer");
+    EXPECT_EQ(std::string(getPerfStageName(PERF_STAGE_SERIALIZE)), "serialize");
+    EXPECT_EQ(std::string(getPerfStageName(PERF_STAGE_DAG_NODE)), "dag_node");
+}
+
+TEST(PerfCounters, CountersOfCurrentThreadGrow) {
+    auto& counters = ThreadPerfCounters::current();
+    if (!counters.isAnyAvailable()) {
+        GTEST_SKIP() << "perf_event_open is not available";
+    }
+    perf_values_t before, after;
+    counters.read(before);
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < 1000000; i++) {
+        sum += i;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    counters.read(after);
+    for (size_t i = 0; i < PERF_EVENTS_COUNT; i++) {
+        auto event = static_cast<PerfEvent>(i);
+        if (!counters.isAvailable(event)) {
+            EXPECT_EQ(after[i], 0) << getPerfEventName(event);
+        } else if (event != PERF_EVENT_LLC_MISSES) {
+            EXPECT_GT(after[i], before[i]) << getPerfEventName(event);
+        }
+    }
+}
+
+TEST(PerfCounters, CountersAreOpenedPerThread) {
+    auto* mainThreadCounters = &ThreadPerfCounters::current();
+    ThreadPerfCounters* otherThreadCounters = nullptr;
+    std::thread t([&otherThreadCounters]() {
+        otherThreadCounters = &ThreadPerfCounters::current();
+        EXPECT_EQ(otherThreadCounters, &ThreadPerfCounters::current());
+    });
+    t.join();
+    EXPECT_NE(mainThreadCounters, otherThreadCounters);
+}
+
+TEST(PerfCounters, ScopeWithoutMetricsDoesNothing) {
+    PerfCountersScope scope(nullptr);
+    scope.stop();
+    scope.stop();
+}
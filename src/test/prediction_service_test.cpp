@@ -1301,4 +1301,52 @@ TYPED_TEST(TestPredict, PerformInferenceWithBinaryInputResolutionRange) {
     this->checkOutputValues(response, {37.0, 28.0, 238.0}, INCREMENT_1x3x4x5_MODEL_OUTPUT_NAME);
 }
 
+
+TEST(PredictWithColorFormat, NV12FrameIsConvertedAndResizedInsideModel) {
+    using namespace ovms;
+    ConstructorEnabledModelManager manager;
+    // Model input has no layout, NCHW is deduced from 3 channels in its (1,3,4,5) shape
+    ModelConfig config = INCREMENT_1x3x4x5_MODEL_CONFIG;
+    ASSERT_EQ(config.parseColorFormatParameter("{\"input\":\"NV12\"}"), StatusCode::OK);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), StatusCode::OK_RELOADED);
+
+    // Gray 6x8 frame, single plane NV12 holds Y plane followed by interleaved half resolution UV plane
+    const size_t height = 6, width = 8;
+    tensorflow::serving::PredictRequest request;
+    auto& input = (*request.mutable_inputs())[INCREMENT_1x3x4x5_MODEL_INPUT_NAME];
+    input.set_dtype(tensorflow::DataType::DT_UINT8);
+    for (auto dim : {size_t(1), height * 3 / 2, width, size_t(1)}) {
+        input.mutable_tensor_shape()->add_dim()->set_size(dim);
+    }
+    input.mutable_tensor_content()->assign(height * 3 / 2 * width, char(128));
+
+    std::shared_ptr<ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(manager.getModelInstance("increment_1x3x4x5", 0, modelInstance, unloadGuard), StatusCode::OK);
+    tensorflow::serving::PredictResponse response;
+    ASSERT_EQ(modelInstance->infer(&request, &response, unloadGuard), StatusCode::OK);
+
+    // Frame is resized to model resolution, each channel of gray pixel is 1.164 * (Y - 16) before increment
+    ASSERT_EQ(response.outputs().count(INCREMENT_1x3x4x5_MODEL_OUTPUT_NAME), 1);
+    const auto& output = response.outputs().at(INCREMENT_1x3x4x5_MODEL_OUTPUT_NAME);
+    ASSERT_EQ(output.tensor_shape().dim_size(), 4);
+    EXPECT_EQ(output.tensor_shape().dim(1).size(), 3);
+    EXPECT_EQ(output.tensor_shape().dim(2).size(), 4);
+    EXPECT_EQ(output.tensor_shape().dim(3).size(), 5);
+    ASSERT_EQ(output.tensor_content().size(), 3 * 4 * 5 * sizeof(float));
+    const float* values = reinterpret_cast<const float*>(output.tensor_content().data());
+    for (size_t i = 0; i < 3 * 4 * 5; i++) {
+        EXPECT_NEAR(values[i], 1.164 * (128 - 16) + 1, 1.0) << "at position: " << i;
+    }
+}
+
+TEST(PredictWithColorFormat, LoadFailsWhenLayoutCannotBeDetermined) {
+    using namespace ovms;
+    ConstructorEnabledModelManager manager;
+    // Dummy model input (1,10) has neither layout nor channels dimension
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    ASSERT_EQ(config.parseColorFormatParameter("{\"b\":\"NV12\"}"), StatusCode::OK);
+    EXPECT_EQ(manager.reloadModelWithVersions(config), StatusCode::CONFIG_COLOR_FORMAT_LAYOUT_UNKNOWN);
+}
+
 #pragma GCC diagnostic pop
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <cstdlib>
+#include <set>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "../prefork_supervisor.hpp"
+
+using namespace ovms;
+
+namespace {
+// Worker processes must never return into the test runner
+[[noreturn]] void runWorker(PreforkSupervisor& supervisor, bool ready) {
+    if (!ready) {
+        _exit(EXIT_FAILURE);
+    }
+    supervisor.notifyReady();
+    while (true) {
+        pause();
+    }
+}
+}  // namespace
+
+TEST(PreforkSupervisor, StartsAndStopsWorkers) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    PreforkSupervisor supervisor(3, [deadline]() { return std::chrono::steady_clock::now() > deadline; });
+    if (supervisor.run() == PreforkRole::WORKER) {
+        runWorker(supervisor, true);
+    }
+    EXPECT_EQ(supervisor.getExitCode(), EXIT_SUCCESS);
+    EXPECT_FALSE(supervisor.getWorkerIndex().has_value());
+}
+
+TEST(PreforkSupervisor, FailsWhenFirstWorkerCannotStart) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    PreforkSupervisor supervisor(2, [deadline]() { return std::chrono::steady_clock::now() > deadline; });
+    if (supervisor.run() == PreforkRole::WORKER) {
+        runWorker(supervisor, false);
+    }
+    EXPECT_EQ(supervisor.getExitCode(), EXIT_FAILURE);
+    EXPECT_LT(std::chrono::steady_clock::now(), deadline);
+}
@@ -13,14 +13,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <random>
+#include <string>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "../base64.hpp"
 #include "../logging.hpp"
 #include "../rest_utils.hpp"
+#include "absl/strings/escaping.h"
 #include "test_utils.hpp"
 
 using namespace ovms;
+using testing::ElementsAre;
 
 class Base64DecodeTest : public ::testing::Test {};
 
@@ -37,6 +43,47 @@ TEST_F(Base64DecodeTest, WrongLength) {
     EXPECT_EQ(decodeBase64(bytes, decodedBytes), StatusCode::REST_BASE64_DECODE_ERROR);
 }
 
+TEST_F(Base64DecodeTest, MatchesGenericDecoderForAllLengths) {
+    // Long enough inputs to go through vectorized path followed by scalar tail
+    std::mt19937 generator(42);
+    for (size_t length = 0; length < 300; length++) {
+        std::string data(length, '\0');
+        for (auto& c : data) {
+            c = static_cast<char>(generator());
+        }
+        std::string encoded = absl::Base64Escape(data);
+        std::string decoded;
+        ASSERT_EQ(decodeBase64(encoded.data(), encoded.size(), decoded), StatusCode::OK) << "length: " << length;
+        EXPECT_EQ(decoded, data) << "length: " << length;
+
+        std::string unpadded = encoded.substr(0, encoded.find('='));
+        ASSERT_EQ(decodeBase64(unpadded.data(), unpadded.size(), decoded), StatusCode::OK) << "length: " << length;
+        EXPECT_EQ(decoded, data) << "length: " << length;
+    }
+}
+
+TEST_F(Base64DecodeTest, InvalidCharacterAtAnyPosition) {
+    std::string data(120, 'x');
+    std::string encoded = absl::Base64Escape(data);
+    for (size_t position = 0; position < encoded.size(); position++) {
+        for (char invalid : {'-', '_', '*', '\x80', '\0'}) {
+            std::string corrupted = encoded;
+            corrupted[position] = invalid;
+            std::string decoded;
+            EXPECT_EQ(decodeBase64(corrupted.data(), corrupted.size(), decoded), StatusCode::REST_BASE64_DECODE_ERROR) << "position: " << position;
+        }
+    }
+}
+
+TEST_F(Base64DecodeTest, StrictDecoderRejectsWhitespaceHandledByGenericDecoder) {
+    std::string encoded = "aW1hZ2Ug\nYnl0ZXM=";
+    std::string decoded(getBase64DecodedSizeUpperBound(encoded.size()), '\0');
+    size_t decodedSize = 0;
+    EXPECT_FALSE(decodeBase64Strict(encoded.data(), encoded.size(), decoded.data(), decodedSize));
+    EXPECT_EQ(decodeBase64(encoded.data(), encoded.size(), decoded), StatusCode::OK);
+    EXPECT_EQ(decoded, "image bytes");
+}
+
 class TFSMakeJsonFromPredictResponseRawTest : public ::testing::TestWithParam<ovms::Order> {
 protected:
     TFSResponseType proto;
@@ -1054,3 +1101,63 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Option
         }]
 })");
 }
+
+class KFSMakeNumpyFromInferResponseTest : public ::testing::Test {
+protected:
+    KFSResponseType proto;
+    std::string content;
+
+    void addOutput(const std::string& name, const std::string& datatype, const std::vector<int64_t>& shape, const std::string& data) {
+        auto output = proto.add_outputs();
+        output->set_name(name);
+        output->set_datatype(datatype);
+        for (const auto dim : shape) {
+            output->add_shape(dim);
+        }
+        proto.add_raw_output_contents()->assign(data);
+    }
+};
+
+TEST_F(KFSMakeNumpyFromInferResponseTest, SingleOutputNpy) {
+    std::vector<float> data{1, 2, 3, 4};
+    addOutput("a", "FP32", {2, 2}, std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)));
+    ASSERT_EQ(makeNumpyFromInferResponse(proto, NumpyFormat::NPY, &content), StatusCode::OK);
+    NumpyArray array;
+    ASSERT_EQ(parseNpy(content, array), StatusCode::OK);
+    EXPECT_EQ(array.precision, Precision::FP32);
+    EXPECT_EQ(array.shape, shape_t({2, 2}));
+    EXPECT_EQ(array.data, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)));
+}
+
+TEST_F(KFSMakeNumpyFromInferResponseTest, MultipleOutputsNpz) {
+    addOutput("a", "FP32", {1}, std::string(4, '\0'));
+    addOutput("b:0", "INT64", {2}, std::string(16, '\0'));
+    EXPECT_EQ(makeNumpyFromInferResponse(proto, NumpyFormat::NPY, &content), StatusCode::NUMPY_INVALID_FORMAT);
+    ASSERT_EQ(makeNumpyFromInferResponse(proto, NumpyFormat::NPZ, &content), StatusCode::OK);
+    numpy_arrays_t arrays;
+    ASSERT_EQ(parseNpz(content, arrays), StatusCode::OK);
+    ASSERT_EQ(arrays.size(), 2);
+    EXPECT_EQ(arrays[0].first, "a");
+    EXPECT_EQ(arrays[1].first, "b:0");
+    EXPECT_EQ(arrays[1].second.precision, Precision::I64);
+}
+
+TEST_F(KFSMakeNumpyFromInferResponseTest, UnsupportedOutputType) {
+    addOutput("a", "BYTES", {1}, std::string(4, '\0'));
+    EXPECT_EQ(makeNumpyFromInferResponse(proto, NumpyFormat::NPY, &content), StatusCode::NUMPY_INVALID_FORMAT);
+}
+
+TEST(KFSMakeInferRequestFromNumpy, Npy) {
+    std::vector<int32_t> data{1, 2, 3};
+    std::string body;
+    ASSERT_EQ(makeNpy(Precision::I32, {1, 3}, std::string_view(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t)), body), StatusCode::OK);
+    KFSRequestType request;
+    ASSERT_EQ(makeInferRequestFromNumpy(body, NumpyFormat::NPY, "input", request), StatusCode::OK);
+    ASSERT_EQ(request.inputs_size(), 1);
+    EXPECT_EQ(request.inputs(0).name(), "input");
+    EXPECT_EQ(request.inputs(0).datatype(), "INT32");
+    EXPECT_THAT(request.inputs(0).shape(), ElementsAre(1, 3));
+    ASSERT_EQ(request.raw_input_contents_size(), 1);
+    EXPECT_EQ(request.raw_input_contents(0).size(), data.size() * sizeof(int32_t));
+    EXPECT_EQ(makeInferRequestFromNumpy("{}", NumpyFormat::NPY, "input", request), StatusCode::NUMPY_INVALID_FORMAT);
+}
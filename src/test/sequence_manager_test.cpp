@@ -16,6 +16,7 @@
 #include <chrono>
 #include <limits>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -263,6 +264,43 @@ TEST(SequenceManager, RemoveOneIdleSequence) {
     ASSERT_FALSE(sequenceManager.sequenceExists(sequenceId2));
 }
 
+TEST(SequenceManager, MemoryStateBytesAccounting) {
+    ovms::model_memory_state_t newState;
+    DummyStatefulModel realModel;
+    std::vector<float> state{10};
+
+    ov::InferRequest auxInferRequest = realModel.createInferRequest();
+    realModel.setVariableState(auxInferRequest, state);
+    newState.push_back(realModel.getVariableState(auxInferRequest));
+
+    MockedSequenceManager sequenceManager(24, "dummy", 1);
+    std::vector<uint64_t> observedBytes;
+    sequenceManager.setMemoryStateObserver([&observedBytes](uint64_t bytes) {
+        observedBytes.push_back(bytes);
+    });
+    uint64_t sequenceId1 = 42;
+    ovms::SequenceProcessingSpec spec1(ovms::SEQUENCE_START, sequenceId1);
+    uint64_t sequenceId2 = 314;
+    ovms::SequenceProcessingSpec spec2(ovms::SEQUENCE_START, sequenceId2);
+    sequenceManager.mockCreateSequence(spec1);
+    sequenceManager.mockCreateSequence(spec2);
+    EXPECT_EQ(sequenceManager.getMemoryStateBytes(), 0);
+
+    sequenceManager.getSequence(sequenceId1).updateMemoryState(newState);
+    sequenceManager.getSequence(sequenceId2).updateMemoryState(newState);
+    EXPECT_EQ(sequenceManager.getMemoryStateBytes(), 2 * sizeof(float));
+    // Updating state of the same sequence does not accumulate
+    sequenceManager.getSequence(sequenceId1).updateMemoryState(newState);
+    EXPECT_EQ(sequenceManager.getMemoryStateBytes(), 2 * sizeof(float));
+
+    ASSERT_EQ(sequenceManager.removeSequence(sequenceId1), ovms::StatusCode::OK);
+    EXPECT_EQ(sequenceManager.getMemoryStateBytes(), sizeof(float));
+    sequenceManager.getSequence(sequenceId2).setIdle();
+    sequenceManager.removeIdleSequences();
+    EXPECT_EQ(sequenceManager.getMemoryStateBytes(), 0);
+    EXPECT_EQ(observedBytes, std::vector<uint64_t>({sizeof(float), 0}));
+}
+
 TEST(SequenceManager, RemoveAllIdleSequences) {
     MockedSequenceManager sequenceManager(24, "dummy", 1);
     uint64_t sequenceId1 = 42;
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../singleconsumerqueue.hpp"
+
+using ovms::SingleConsumerQueue;
+
+namespace {
+const uint WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS = 1'000'000;
+}  // namespace
+
+TEST(SingleConsumerQueue, SeveralElementsInFIFOOrder) {
+    const std::vector<int> elements = {1, 2, 3, 4, 5, 6};
+    SingleConsumerQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    for (size_t i = 0; i < 3; ++i) {
+        queue.push(elements[i]);
+    }
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ(elements[0], queue.tryPull(WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS));
+    // Elements pushed while consumer processes previous batch are pulled after it
+    for (size_t i = 3; i < elements.size(); ++i) {
+        queue.push(elements[i]);
+    }
+    for (size_t i = 1; i < elements.size(); ++i) {
+        EXPECT_EQ(elements[i], queue.tryPull(WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS));
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SingleConsumerQueue, NoElementsPushed) {
+    SingleConsumerQueue<int> queue;
+    EXPECT_EQ(std::nullopt, queue.tryPull(1000));
+}
+
+TEST(SingleConsumerQueue, MoveOnlyElementsReleasedOnDestruction) {
+    auto counter = std::make_shared<int>(0);
+    {
+        SingleConsumerQueue<std::unique_ptr<std::shared_ptr<int>>> queue;
+        queue.push(std::make_unique<std::shared_ptr<int>>(counter));
+        queue.push(std::make_unique<std::shared_ptr<int>>(counter));
+        queue.push(std::make_unique<std::shared_ptr<int>>(counter));
+        auto element = queue.tryPull(WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS);
+        ASSERT_TRUE(element);
+        EXPECT_EQ(**element.value(), 0);
+        EXPECT_EQ(counter.use_count(), 4);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SingleConsumerQueue, ParkedConsumerIsWokenUpByPush) {
+    SingleConsumerQueue<int> queue;
+    std::promise<void> consumerStarted;
+    auto consumer = std::async(std::launch::async, [&queue, &consumerStarted]() {
+        consumerStarted.set_value();
+        return queue.tryPull(10 * WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS);
+    });
+    consumerStarted.get_future().get();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto start = std::chrono::steady_clock::now();
+    queue.push(7);
+    EXPECT_EQ(consumer.get(), 7);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(SingleConsumerQueue, SeveralProducersAllElementsPresent) {
+    const uint NUMBER_OF_PRODUCERS = 80;
+    const uint ELEMENTS_TO_INSERT = 500;
+    SingleConsumerQueue<std::pair<uint, uint>> queue;
+    std::promise<void> startSignal;
+    std::shared_future<void> start = startSignal.get_future().share();
+    std::vector<std::thread> producers;
+    for (uint producer = 0; producer < NUMBER_OF_PRODUCERS; ++producer) {
+        producers.emplace_back([&queue, start, producer]() {
+            start.wait();
+            for (uint i = 0; i < ELEMENTS_TO_INSERT; ++i) {
+                queue.push({producer, i});
+            }
+        });
+    }
+    startSignal.set_value();
+    // Elements of each producer have to be pulled in the order of pushing
+    std::vector<uint> nextExpected(NUMBER_OF_PRODUCERS, 0);
+    for (uint i = 0; i < NUMBER_OF_PRODUCERS * ELEMENTS_TO_INSERT; ++i) {
+        auto element = queue.tryPull(WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS);
+        ASSERT_TRUE(element);
+        auto [producer, value] = element.value();
+        EXPECT_EQ(nextExpected[producer]++, value);
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(std::nullopt, queue.tryPull(1000));
+}
@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright 2022 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "../tenant_limiter.hpp"
+
+using namespace ovms;
+using namespace std::chrono_literals;
+
+TEST(TenantLimiter, DisabledWithoutHeader) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 1;
+    limiter.configure("", quota);
+    std::vector<std::unique_ptr<TenantQuotaGuard>> guards(3);
+    for (auto& guard : guards) {
+        EXPECT_EQ(limiter.acquire("model", "tenantA", guard), StatusCode::OK);
+        EXPECT_EQ(guard, nullptr);
+    }
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 0);
+}
+
+TEST(TenantLimiter, MaxConcurrencyIsPerTenant) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 2;
+    limiter.configure("tenant-id", quota);
+    std::unique_ptr<TenantQuotaGuard> a1, a2, a3, b1;
+    EXPECT_EQ(limiter.acquire("model", "tenantA", a1), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", a2), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", a3), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(a3, nullptr);
+    EXPECT_EQ(limiter.acquire("model", "tenantB", b1), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("other_model", "tenantA", a3), StatusCode::OK);
+    a3.reset();
+    a1.reset();
+    EXPECT_EQ(limiter.acquire("model", "tenantA", a1), StatusCode::OK);
+}
+
+TEST(TenantLimiter, TokenBucketRefills) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.rateLimit = 10;
+    quota.burst = 2;
+    limiter.configure("tenant-id", quota);
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<TenantQuotaGuard> guard;
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(limiter.acquire("model", "tenantB", guard, start), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start + 50ms), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start + 100ms), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start + 100ms), StatusCode::TENANT_QUOTA_EXCEEDED);
+    // Bucket does not grow above burst
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start + 10s), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start + 10s), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantA", guard, start + 10s), StatusCode::TENANT_QUOTA_EXCEEDED);
+}
+
+TEST(TenantLimiter, RequestsWithoutTenantShareDefaultTenant) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 1;
+    limiter.configure("tenant-id", quota);
+    std::unique_ptr<TenantQuotaGuard> first, second, third;
+    EXPECT_EQ(limiter.acquire("model", "", first), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "", second), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(limiter.acquire("model", DEFAULT_TENANT_NAME, third), StatusCode::TENANT_QUOTA_EXCEEDED);
+}
+
+TEST(TenantLimiter, ServableQuotasOverrideDefault) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 1;
+    limiter.configure("tenant-id", quota);
+    rapidjson::Document doc;
+    doc.Parse(R"([{"name": "dag", "max_concurrency": 2}, {"name": "model", "rate_limit": 0.5}])");
+    ASSERT_EQ(limiter.parseServableQuotas(doc), StatusCode::OK);
+    EXPECT_EQ(limiter.getQuota("dag").maxConcurrency, 2);
+    EXPECT_EQ(limiter.getQuota("model").maxConcurrency, 0);
+    EXPECT_EQ(limiter.getQuota("model").rateLimit, 0.5);
+    EXPECT_EQ(limiter.getQuota("unknown").maxConcurrency, 1);
+
+    std::unique_ptr<TenantQuotaGuard> g1, g2, g3;
+    EXPECT_EQ(limiter.acquire("dag", "tenantA", g1), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("dag", "tenantA", g2), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("dag", "tenantA", g3), StatusCode::TENANT_QUOTA_EXCEEDED);
+
+    // Reload applies new quota to already tracked tenants
+    limiter.setServableQuotas({});
+    g1.reset();
+    EXPECT_EQ(limiter.acquire("dag", "tenantA", g3), StatusCode::TENANT_QUOTA_EXCEEDED);
+    g2.reset();
+    EXPECT_EQ(limiter.acquire("dag", "tenantA", g3), StatusCode::OK);
+}
+
+TEST(TenantLimiter, ServableQuotasInvalid) {
+    TenantLimiter limiter;
+    for (const char* json : {R"({"name": "model"})", R"([{"rate_limit": 1}])", R"([{"name": "model", "rate_limit": -1}])", R"([{"name": "model", "max_concurrency": "2"}])"}) {
+        rapidjson::Document doc;
+        doc.Parse(json);
+        EXPECT_EQ(limiter.parseServableQuotas(doc), StatusCode::TENANT_QUOTA_WRONG_FORMAT) << json;
+    }
+}
+
+TEST(TenantLimiter, CleanupIdleTenants) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 1;
+    limiter.configure("tenant-id", quota);
+    std::unique_ptr<TenantQuotaGuard> busy, idle;
+    ASSERT_EQ(limiter.acquire("model", "busy", busy), StatusCode::OK);
+    ASSERT_EQ(limiter.acquire("model", "idle", idle), StatusCode::OK);
+    idle.reset();
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 2);
+    limiter.cleanupIdleTenants();
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 1);
+    busy.reset();
+    limiter.cleanupIdleTenants();
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 0);
+}
+
+TEST(TenantLimiter, TenantsAboveTrackedLimitShareOtherTenant) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 1;
+    limiter.configure("tenant-id", quota, 2);
+    std::unique_ptr<TenantQuotaGuard> a, b, c, d;
+    ASSERT_EQ(limiter.acquire("model", "tenantA", a), StatusCode::OK);
+    ASSERT_EQ(limiter.acquire("model", "tenantB", b), StatusCode::OK);
+    EXPECT_EQ(limiter.acquire("model", "tenantC", c), StatusCode::OK);
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 3);
+    // Busy tenants are not evicted, so tenantD shares quota with tenantC
+    EXPECT_EQ(limiter.acquire("model", "tenantD", d), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(limiter.acquire("model", OTHER_TENANT_NAME, d), StatusCode::TENANT_QUOTA_EXCEEDED);
+    c.reset();
+    EXPECT_EQ(limiter.acquire("model", "tenantD", d), StatusCode::OK);
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 3);
+    // Limit is applied per servable
+    EXPECT_EQ(limiter.acquire("other_model", "tenantC", c), StatusCode::OK);
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 4);
+}
+
+TEST(TenantLimiter, IdleTenantsAreEvictedWhenTrackedLimitIsReached) {
+    TenantLimiter limiter;
+    TenantQuota quota;
+    quota.maxConcurrency = 1;
+    limiter.configure("tenant-id", quota, 2);
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<TenantQuotaGuard> a, b, c, c2, d, e;
+    ASSERT_EQ(limiter.acquire("model", "tenantA", a, start), StatusCode::OK);
+    ASSERT_EQ(limiter.acquire("model", "tenantB", b, start), StatusCode::OK);
+    a.reset();
+    EXPECT_EQ(limiter.acquire("model", "tenantC", c, start), StatusCode::OK);
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 2);
+    // tenantC replaced idle tenantA and has its own quota
+    EXPECT_EQ(limiter.acquire("model", "tenantC", c2, start), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(limiter.acquire("model", "tenantD", d, start), StatusCode::OK);
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 3);
+    // Idle tenants are searched at most once per eviction interval
+    b.reset();
+    EXPECT_EQ(limiter.acquire("model", "tenantE", e, start), StatusCode::TENANT_QUOTA_EXCEEDED);
+    EXPECT_EQ(limiter.acquire("model", "tenantE", e, start + 2s), StatusCode::OK);
+    EXPECT_EQ(limiter.getTrackedTenantsCount(), 3);
+}